@@ -0,0 +1,641 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_aw_bench.c
+ * \brief   Sigfox End-Point Atlas WiFi addon host benchmark.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2025, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_BENCH_THREADS
+#include <pthread.h>
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sigfox_ep_addon_aw_api.h"
+#include "sigfox_ep_addon_aw_test_common.h"
+#include "sigfox_ep_addon_aw_version.h"
+
+/*** SIGFOX EP ADDON AW BENCH local macros ***/
+
+#ifdef SIGFOX_EP_ADDON_AW_WIDE_INDEX
+#define SIGFOX_EP_ADDON_AW_BENCH_LIST_SIZE_MAX      16384
+#else
+#define SIGFOX_EP_ADDON_AW_BENCH_LIST_SIZE_MAX      255
+#endif
+// Number of access points processed per measurement (the number of runs is deduced from the list size).
+#define SIGFOX_EP_ADDON_AW_BENCH_AP_PER_MEASUREMENT 400000
+#define SIGFOX_EP_ADDON_AW_BENCH_RUNS_MIN           64
+// Batch of lists given to the batch builder (copies of the same scan, stored at different addresses).
+#define SIGFOX_EP_ADDON_AW_BENCH_BATCH_NB_LISTS     64
+#ifdef SIGFOX_EP_ADDON_AW_BENCH_THREADS
+#define SIGFOX_EP_ADDON_AW_BENCH_NB_THREADS_MAX     4
+#else
+#define SIGFOX_EP_ADDON_AW_BENCH_NB_THREADS_MAX     1
+#endif
+// Only the configuration fixed at compilation time is measured when the static flags are enabled.
+#ifdef SIGFOX_EP_ADDON_AW_STATIC_FILTERS
+#ifdef SIGFOX_EP_ADDON_AW_FILTER_LOCALLY_ADMINISTERED
+#define SIGFOX_EP_ADDON_AW_BENCH_FILTER_LA_MASK     (1 << SIGFOX_EP_ADDON_AW_API_FILTER_LOCALLY_ADMINISTERED)
+#else
+#define SIGFOX_EP_ADDON_AW_BENCH_FILTER_LA_MASK     0
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_FILTER_SSID_EMPTY
+#define SIGFOX_EP_ADDON_AW_BENCH_FILTER_SE_MASK     (1 << SIGFOX_EP_ADDON_AW_API_FILTER_SSID_EMPTY)
+#else
+#define SIGFOX_EP_ADDON_AW_BENCH_FILTER_SE_MASK     0
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST
+#define SIGFOX_EP_ADDON_AW_BENCH_FILTER_BL_MASK     (1 << SIGFOX_EP_ADDON_AW_API_FILTER_SSID_BLACK_LIST)
+#else
+#define SIGFOX_EP_ADDON_AW_BENCH_FILTER_BL_MASK     0
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_FILTER_RSSI_MIN
+#define SIGFOX_EP_ADDON_AW_BENCH_FILTER_RM_MASK     (1 << SIGFOX_EP_ADDON_AW_API_FILTER_RSSI_MIN)
+#else
+#define SIGFOX_EP_ADDON_AW_BENCH_FILTER_RM_MASK     0
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST
+#define SIGFOX_EP_ADDON_AW_BENCH_FILTER_OB_MASK     (1 << SIGFOX_EP_ADDON_AW_API_FILTER_OUI_BLACK_LIST)
+#else
+#define SIGFOX_EP_ADDON_AW_BENCH_FILTER_OB_MASK     0
+#endif
+#define SIGFOX_EP_ADDON_AW_BENCH_FILTERS_FIRST      (SIGFOX_EP_ADDON_AW_BENCH_FILTER_LA_MASK | SIGFOX_EP_ADDON_AW_BENCH_FILTER_SE_MASK | SIGFOX_EP_ADDON_AW_BENCH_FILTER_BL_MASK | SIGFOX_EP_ADDON_AW_BENCH_FILTER_RM_MASK | SIGFOX_EP_ADDON_AW_BENCH_FILTER_OB_MASK)
+#define SIGFOX_EP_ADDON_AW_BENCH_FILTERS_LAST       SIGFOX_EP_ADDON_AW_BENCH_FILTERS_FIRST
+#else
+#define SIGFOX_EP_ADDON_AW_BENCH_FILTERS_FIRST      0
+#define SIGFOX_EP_ADDON_AW_BENCH_FILTERS_LAST       ((1 << SIGFOX_EP_ADDON_AW_API_FILTER_LAST) - 1)
+#endif
+#if (defined SIGFOX_EP_ADDON_AW_STATIC_SORTING) && (defined SIGFOX_EP_ADDON_AW_SORTING_NONE)
+#define SIGFOX_EP_ADDON_AW_BENCH_SORTING_FIRST      SIGFOX_EP_ADDON_AW_API_SORTING_NONE
+#define SIGFOX_EP_ADDON_AW_BENCH_SORTING_LAST       SIGFOX_EP_ADDON_AW_API_SORTING_NONE
+#elif (defined SIGFOX_EP_ADDON_AW_STATIC_SORTING) && (defined SIGFOX_EP_ADDON_AW_SORTING_RSSI)
+#define SIGFOX_EP_ADDON_AW_BENCH_SORTING_FIRST      SIGFOX_EP_ADDON_AW_API_SORTING_RSSI
+#define SIGFOX_EP_ADDON_AW_BENCH_SORTING_LAST       SIGFOX_EP_ADDON_AW_API_SORTING_RSSI
+#elif (defined SIGFOX_EP_ADDON_AW_STATIC_SORTING) && (defined SIGFOX_EP_ADDON_AW_SORTING_SCANS)
+#define SIGFOX_EP_ADDON_AW_BENCH_SORTING_FIRST      SIGFOX_EP_ADDON_AW_API_SORTING_SCANS
+#define SIGFOX_EP_ADDON_AW_BENCH_SORTING_LAST       SIGFOX_EP_ADDON_AW_API_SORTING_SCANS
+#elif (defined SIGFOX_EP_ADDON_AW_STATIC_SORTING) && (defined SIGFOX_EP_ADDON_AW_SORTING_DEVICES)
+#define SIGFOX_EP_ADDON_AW_BENCH_SORTING_FIRST      SIGFOX_EP_ADDON_AW_API_SORTING_DEVICES
+#define SIGFOX_EP_ADDON_AW_BENCH_SORTING_LAST       SIGFOX_EP_ADDON_AW_API_SORTING_DEVICES
+#else
+#define SIGFOX_EP_ADDON_AW_BENCH_SORTING_FIRST      0
+#define SIGFOX_EP_ADDON_AW_BENCH_SORTING_LAST       (SIGFOX_EP_ADDON_AW_API_SORTING_LAST - 1)
+#endif
+#define SIGFOX_EP_ADDON_AW_BENCH_SEED               0x5F0A3C21
+#define SIGFOX_EP_ADDON_AW_BENCH_RSSI_MIN_DBM       (-80)
+// OUI black list of the size of the main mobile devices vendors registrations, spread over the whole OUI range.
+#define SIGFOX_EP_ADDON_AW_BENCH_NB_OUIS            1024
+#define SIGFOX_EP_ADDON_AW_BENCH_OUI_STEP           0x3FF1
+
+#ifdef SIGFOX_EP_ERROR_CODES
+#define SIGFOX_EP_ADDON_AW_BENCH_ERROR_CODES        1
+#else
+#define SIGFOX_EP_ADDON_AW_BENCH_ERROR_CODES        0
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+#define SIGFOX_EP_ADDON_AW_BENCH_PARAMETERS_CHECK   1
+#else
+#define SIGFOX_EP_ADDON_AW_BENCH_PARAMETERS_CHECK   0
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_WIDE_INDEX
+#define SIGFOX_EP_ADDON_AW_BENCH_WIDE_INDEX         1
+#else
+#define SIGFOX_EP_ADDON_AW_BENCH_WIDE_INDEX         0
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_LAZY_FILTERS
+#define SIGFOX_EP_ADDON_AW_BENCH_LAZY_FILTERS       1
+#else
+#define SIGFOX_EP_ADDON_AW_BENCH_LAZY_FILTERS       0
+#endif
+
+/*** SIGFOX EP ADDON AW BENCH local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    const char *name;
+    sfx_u8 locally_administered_percent;
+    sfx_u8 multicast_percent;
+    sfx_u8 ssid_empty_percent;
+    sfx_u8 ssid_black_listed_percent;
+    sfx_u8 ssid_hostile;
+    sfx_s16 rssi_mean_dbm;
+    sfx_s16 rssi_spread_dbm;
+    sfx_u8 rssi_ascending;
+    sfx_u8 multi_bssid_percent;
+} SIGFOX_EP_ADDON_AW_BENCH_scenario_t;
+
+/*******************************************************************/
+typedef struct {
+#ifdef SIGFOX_EP_ADDON_AW_BENCH_THREADS
+    pthread_t thread;
+#endif
+    SIGFOX_EP_ADDON_AW_API_context_t context;
+    SIGFOX_EP_ADDON_AW_API_input_data_t *input_data_list;
+    SIGFOX_EP_ADDON_AW_API_output_data_t *output_data_list;
+    sfx_u32 nb_lists;
+    sfx_u32 nb_runs;
+    sfx_u8 build;
+} SIGFOX_EP_ADDON_AW_BENCH_slice_t;
+
+/*** SIGFOX EP ADDON AW BENCH local global variables ***/
+
+static const SIGFOX_EP_ADDON_AW_BENCH_scenario_t SIGFOX_EP_ADDON_AW_BENCH_SCENARIOS[] = {
+    // Urban scan: mostly infrastructure access points, a few phones and repeaters.
+    { "nominal", 5, 1, 10, 5, 0, -72, 12, 0, 0 },
+    // Long SSIDs which are near-misses of the black listed words.
+    { "hostile_ssid", 5, 1, 0, 2, 1, -72, 12, 0, 0 },
+    // Dense indoor scan with many repeaters and virtual access points.
+    { "locally_administered", 40, 10, 10, 5, 0, -65, 8, 0, 0 },
+    // RSSI increasing along the list (worst case of the best access points selection).
+    { "ascending_rssi", 5, 1, 10, 5, 0, -72, 12, 1, 0 },
+    // Enterprise scan where most devices broadcast several BSSIDs (bands and SSIDs) with nearly the same RSSI.
+    { "multi_bssid", 5, 1, 10, 5, 0, -72, 12, 0, 60 },
+};
+
+static const SIGFOX_EP_ADDON_AW_API_index_t SIGFOX_EP_ADDON_AW_BENCH_LIST_SIZES[] = {
+    1, 2, 8, 32, 64, 128, 255,
+#ifdef SIGFOX_EP_ADDON_AW_WIDE_INDEX
+    512, 1024, 2048, 4096, 8192, 16384,
+#endif
+};
+
+static const char *SIGFOX_EP_ADDON_AW_BENCH_SSID_NOMINAL[] = {
+    "Livebox-4F2A", "FreeWifi_secure", "eduroam", "TP-Link_88C1", "NETGEAR47", "Bbox-0F3E21", "CoffeeShop Guest", "SFR_7A90",
+};
+
+static const char *SIGFOX_EP_ADDON_AW_BENCH_SSID_BLACK_LISTED[] = {
+    "iPhone de Marie", "Galaxy S21 (Samsung)", "HUAWEI P30", "AndroidAP_4521", "Apple Network 42",
+};
+
+static const char *SIGFOX_EP_ADDON_AW_BENCH_SSID_HOSTILE_PREFIXES[] = {
+    "phon", "huawe", "samsun", "androi", "appl", "sam", "and", "pho",
+};
+
+static SIGFOX_EP_ADDON_AW_API_access_point_t sigfox_ep_addon_aw_bench_access_points[SIGFOX_EP_ADDON_AW_BENCH_LIST_SIZE_MAX];
+static SIGFOX_EP_ADDON_AW_API_access_point_t *sigfox_ep_addon_aw_bench_access_point_list[SIGFOX_EP_ADDON_AW_BENCH_LIST_SIZE_MAX];
+#ifdef SIGFOX_EP_ADDON_AW_PACKED_INPUT
+static SIGFOX_EP_ADDON_AW_API_packed_access_point_t sigfox_ep_addon_aw_bench_packed_access_points[SIGFOX_EP_ADDON_AW_BENCH_LIST_SIZE_MAX];
+#endif
+static SIGFOX_EP_ADDON_AW_API_access_point_t *sigfox_ep_addon_aw_bench_batch_access_points = SIGFOX_NULL;
+static SIGFOX_EP_ADDON_AW_API_access_point_t **sigfox_ep_addon_aw_bench_batch_access_point_list = SIGFOX_NULL;
+static SIGFOX_EP_ADDON_AW_API_input_data_t sigfox_ep_addon_aw_bench_batch_input_data_list[SIGFOX_EP_ADDON_AW_BENCH_BATCH_NB_LISTS];
+static SIGFOX_EP_ADDON_AW_API_output_data_t sigfox_ep_addon_aw_bench_batch_output_data_list[SIGFOX_EP_ADDON_AW_BENCH_BATCH_NB_LISTS];
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST))
+static sfx_u8 sigfox_ep_addon_aw_bench_oui_table[SIGFOX_EP_ADDON_AW_BENCH_NB_OUIS * 3];
+static SIGFOX_EP_ADDON_AW_API_oui_table_t sigfox_ep_addon_aw_bench_oui_black_list;
+#endif
+
+/*** SIGFOX EP ADDON AW BENCH local functions ***/
+
+/*******************************************************************/
+static sfx_u8 _random_percent(sfx_u8 percent) {
+    return (((SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 100) < percent) ? 1 : 0);
+}
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST))
+/*******************************************************************/
+static void _generate_oui_black_list(void) {
+    // Local variables.
+    sfx_u32 oui = 0;
+    sfx_u32 oui_idx = 0;
+    // Increasing OUIs, as given by the generator tool.
+    for (oui_idx = 0; oui_idx < SIGFOX_EP_ADDON_AW_BENCH_NB_OUIS; oui_idx++) {
+        oui = (oui_idx * SIGFOX_EP_ADDON_AW_BENCH_OUI_STEP);
+        sigfox_ep_addon_aw_bench_oui_table[(3 * oui_idx) + 0] = (sfx_u8) ((oui >> 16) & 0xFF);
+        sigfox_ep_addon_aw_bench_oui_table[(3 * oui_idx) + 1] = (sfx_u8) ((oui >> 8) & 0xFF);
+        sigfox_ep_addon_aw_bench_oui_table[(3 * oui_idx) + 2] = (sfx_u8) (oui & 0xFF);
+    }
+    sigfox_ep_addon_aw_bench_oui_black_list.oui_table = sigfox_ep_addon_aw_bench_oui_table;
+    sigfox_ep_addon_aw_bench_oui_black_list.nb_ouis = SIGFOX_EP_ADDON_AW_BENCH_NB_OUIS;
+}
+#endif
+
+/*******************************************************************/
+static void _generate_ssid(const SIGFOX_EP_ADDON_AW_BENCH_scenario_t *scenario, sfx_u8 *ssid) {
+    // Local variables.
+    const char *word = SIGFOX_NULL;
+    sfx_u8 idx = 0;
+    sfx_u8 len = 0;
+    memset(ssid, 0, SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR);
+    if (_random_percent(scenario->ssid_empty_percent) != 0) {
+        return;
+    }
+    if (_random_percent(scenario->ssid_black_listed_percent) != 0) {
+        word = SIGFOX_EP_ADDON_AW_BENCH_SSID_BLACK_LISTED[SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % (sizeof(SIGFOX_EP_ADDON_AW_BENCH_SSID_BLACK_LISTED) / sizeof(char*))];
+        memcpy(ssid, word, strlen(word));
+        return;
+    }
+    if (scenario->ssid_hostile == 0) {
+        word = SIGFOX_EP_ADDON_AW_BENCH_SSID_NOMINAL[SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % (sizeof(SIGFOX_EP_ADDON_AW_BENCH_SSID_NOMINAL) / sizeof(char*))];
+        memcpy(ssid, word, strlen(word));
+        return;
+    }
+    // Fill the whole SSID (without null character) with mixed case near-misses of the black listed words.
+    while (idx < SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR) {
+        word = SIGFOX_EP_ADDON_AW_BENCH_SSID_HOSTILE_PREFIXES[SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % (sizeof(SIGFOX_EP_ADDON_AW_BENCH_SSID_HOSTILE_PREFIXES) / sizeof(char*))];
+        len = (sfx_u8) strlen(word);
+        while ((len > 0) && (idx < SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR)) {
+            ssid[idx] = (sfx_u8) (((SIGFOX_EP_ADDON_AW_TEST_COMMON_random() & 0x01) != 0) ? ((*word) - ('a' - 'A')) : (*word));
+            word++;
+            len--;
+            idx++;
+        }
+    }
+}
+
+/*******************************************************************/
+static void _generate_list(const SIGFOX_EP_ADDON_AW_BENCH_scenario_t *scenario, SIGFOX_EP_ADDON_AW_API_index_t list_size) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_point = SIGFOX_NULL;
+    sfx_u8 mac_address[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES];
+    sfx_s32 rssi_dbm = 0;
+    sfx_u32 idx = 0;
+    sfx_u8 byte_idx = 0;
+    sfx_u8 multi_bssid = 0;
+    // Same lists for all flags builds.
+    SIGFOX_EP_ADDON_AW_TEST_COMMON_set_seed(SIGFOX_EP_ADDON_AW_BENCH_SEED);
+    for (idx = 0; idx < list_size; idx++) {
+        access_point = &(sigfox_ep_addon_aw_bench_access_points[idx]);
+        memset(access_point, 0, sizeof(SIGFOX_EP_ADDON_AW_API_access_point_t));
+        // MAC address (the random sequence of the other scenarios is not changed).
+        multi_bssid = (((scenario->multi_bssid_percent) != 0) && (idx > 0) && (_random_percent(scenario->multi_bssid_percent) != 0)) ? 1 : 0;
+        if (multi_bssid != 0) {
+            // Other radio of the previous device: only the last byte (and sometimes the U/L bit) differs.
+            mac_address[5] = (sfx_u8) (mac_address[5] + 1 + (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 15));
+            if ((SIGFOX_EP_ADDON_AW_TEST_COMMON_random() & 0x01) != 0) {
+                mac_address[0] ^= 0x02;
+            }
+        }
+        else {
+            for (byte_idx = 0; byte_idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES; byte_idx++) {
+                mac_address[byte_idx] = (sfx_u8) (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() & 0xFF);
+            }
+            mac_address[0] &= 0xFC;
+            if (_random_percent(scenario->locally_administered_percent) != 0) {
+                mac_address[0] |= 0x02;
+            }
+            if (_random_percent(scenario->multicast_percent) != 0) {
+                mac_address[0] |= 0x01;
+            }
+        }
+        // Both cases are used by WiFi modules.
+        SIGFOX_EP_ADDON_AW_TEST_COMMON_write_mac_address(mac_address, (((idx & 0x01) != 0) ? SIGFOX_TRUE : SIGFOX_FALSE), access_point->mac_address);
+        // SSID.
+        _generate_ssid(scenario, access_point->ssid);
+        // RSSI (sum of uniform draws to approximate a bell curve).
+        if (scenario->rssi_ascending != 0) {
+            rssi_dbm = -100 + (sfx_s32) ((70 * idx) / list_size);
+        }
+        else if (multi_bssid != 0) {
+            rssi_dbm += (sfx_s32) (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 5) - 2;
+        }
+        else {
+            rssi_dbm = (sfx_s32) ((SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % (2 * scenario->rssi_spread_dbm + 1)) + (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % (2 * scenario->rssi_spread_dbm + 1)));
+            rssi_dbm = scenario->rssi_mean_dbm + (rssi_dbm / 2) - scenario->rssi_spread_dbm;
+        }
+        access_point->rssi_dbm = (sfx_s16) rssi_dbm;
+        sigfox_ep_addon_aw_bench_access_point_list[idx] = access_point;
+#ifdef SIGFOX_EP_ADDON_AW_PACKED_INPUT
+        // Same access point in the packed array (packing is done once, when the scan is received).
+        SIGFOX_EP_ADDON_AW_API_pack_access_point((access_point->mac_address), (access_point->ssid), (access_point->rssi_dbm), &(sigfox_ep_addon_aw_bench_packed_access_points[idx]));
+#endif
+    }
+}
+
+/*******************************************************************/
+static void _reset_list(SIGFOX_EP_ADDON_AW_API_index_t list_size) {
+    // Local variables.
+    sfx_u32 idx = 0;
+    for (idx = 0; idx < list_size; idx++) {
+        sigfox_ep_addon_aw_bench_access_points[idx].status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_NEW;
+    }
+}
+
+/*******************************************************************/
+static void _generate_batch(SIGFOX_EP_ADDON_AW_API_index_t list_size) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_points = SIGFOX_NULL;
+    SIGFOX_EP_ADDON_AW_API_access_point_t **access_point_list = SIGFOX_NULL;
+    sfx_u32 list_idx = 0;
+    for (list_idx = 0; list_idx < SIGFOX_EP_ADDON_AW_BENCH_BATCH_NB_LISTS; list_idx++) {
+        access_points = &(sigfox_ep_addon_aw_bench_batch_access_points[list_idx * SIGFOX_EP_ADDON_AW_BENCH_LIST_SIZE_MAX]);
+        access_point_list = &(sigfox_ep_addon_aw_bench_batch_access_point_list[list_idx * SIGFOX_EP_ADDON_AW_BENCH_LIST_SIZE_MAX]);
+        memcpy(access_points, sigfox_ep_addon_aw_bench_access_points, (list_size * sizeof(SIGFOX_EP_ADDON_AW_API_access_point_t)));
+        SIGFOX_EP_ADDON_AW_TEST_COMMON_init_list(&(sigfox_ep_addon_aw_bench_batch_input_data_list[list_idx]), access_points, access_point_list, list_size);
+    }
+}
+
+/*******************************************************************/
+static void _reset_batch(SIGFOX_EP_ADDON_AW_API_input_data_t *input_data_list, sfx_u32 nb_lists) {
+    // Local variables.
+    sfx_u32 list_idx = 0;
+    sfx_u32 idx = 0;
+    for (list_idx = 0; list_idx < nb_lists; list_idx++) {
+        for (idx = 0; idx < input_data_list[list_idx].access_point_list_size; idx++) {
+            input_data_list[list_idx].access_point_list[idx]->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_NEW;
+        }
+    }
+}
+
+#ifdef SIGFOX_EP_ADDON_AW_PACKED_INPUT
+/*******************************************************************/
+static void _reset_packed_list(SIGFOX_EP_ADDON_AW_API_index_t list_size) {
+    // Local variables.
+    sfx_u32 idx = 0;
+    for (idx = 0; idx < list_size; idx++) {
+        sigfox_ep_addon_aw_bench_packed_access_points[idx].info &= (~SIGFOX_EP_ADDON_AW_API_PACKED_INFO_STATUS_MASK);
+    }
+}
+#endif
+
+/*******************************************************************/
+static double _get_time_ns(void) {
+    // Local variables.
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (((double) now.tv_sec) * 1e9) + ((double) now.tv_nsec);
+}
+
+/*******************************************************************/
+static double _measure(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, sfx_u32 nb_runs, sfx_u8 build) {
+    // Local variables.
+    sfx_u8 ul_payload[SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES];
+    sfx_u8 nb_mac_ul_payload = 0;
+    double start_ns = 0.0;
+    sfx_u32 run = 0;
+    start_ns = _get_time_ns();
+    for (run = 0; run < nb_runs; run++) {
+        // The list is reset before each run, as it would be after a new scan.
+        _reset_list(input_data->access_point_list_size);
+        if (build != 0) {
+            SIGFOX_EP_ADDON_AW_API_build_ul_payload_ctx(context, input_data, ul_payload, &nb_mac_ul_payload);
+        }
+    }
+    return (_get_time_ns() - start_ns);
+}
+
+#ifdef SIGFOX_EP_ADDON_AW_PACKED_INPUT
+/*******************************************************************/
+static double _measure_packed(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_packed_input_data_t *packed_input_data, sfx_u32 nb_runs, sfx_u8 build) {
+    // Local variables.
+    sfx_u8 ul_payload[SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES];
+    sfx_u8 nb_mac_ul_payload = 0;
+    double start_ns = 0.0;
+    sfx_u32 run = 0;
+    start_ns = _get_time_ns();
+    for (run = 0; run < nb_runs; run++) {
+        _reset_packed_list(packed_input_data->packed_access_point_list_size);
+        if (build != 0) {
+            SIGFOX_EP_ADDON_AW_API_build_ul_payload_packed_ctx(context, packed_input_data, ul_payload, &nb_mac_ul_payload);
+        }
+    }
+    return (_get_time_ns() - start_ns);
+}
+#endif
+
+/*******************************************************************/
+static double _measure_loop(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_u32 nb_runs, sfx_u8 build) {
+    // Local variables.
+    sfx_u8 ul_payload[SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES];
+    sfx_u8 nb_mac_ul_payload = 0;
+    double start_ns = 0.0;
+    sfx_u32 run = 0;
+    sfx_u32 list_idx = 0;
+    start_ns = _get_time_ns();
+    for (run = 0; run < nb_runs; run++) {
+        _reset_batch(sigfox_ep_addon_aw_bench_batch_input_data_list, SIGFOX_EP_ADDON_AW_BENCH_BATCH_NB_LISTS);
+        if (build != 0) {
+            // Reference: one call per list.
+            for (list_idx = 0; list_idx < SIGFOX_EP_ADDON_AW_BENCH_BATCH_NB_LISTS; list_idx++) {
+                SIGFOX_EP_ADDON_AW_API_build_ul_payload_ctx(context, &(sigfox_ep_addon_aw_bench_batch_input_data_list[list_idx]), ul_payload, &nb_mac_ul_payload);
+            }
+        }
+    }
+    return (_get_time_ns() - start_ns);
+}
+
+/*******************************************************************/
+static void *_build_slice(void *argument) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_BENCH_slice_t *slice = (SIGFOX_EP_ADDON_AW_BENCH_slice_t *) argument;
+    sfx_u32 run = 0;
+    for (run = 0; run < (slice->nb_runs); run++) {
+        _reset_batch((slice->input_data_list), (slice->nb_lists));
+        if ((slice->build) != 0) {
+            SIGFOX_EP_ADDON_AW_API_build_ul_payload_batch(&(slice->context), (slice->input_data_list), (slice->nb_lists), (slice->output_data_list));
+        }
+    }
+    return SIGFOX_NULL;
+}
+
+/*******************************************************************/
+static double _measure_batch(SIGFOX_EP_ADDON_AW_BENCH_slice_t *slices, sfx_u32 nb_threads, sfx_u32 nb_runs, sfx_u8 build) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_BENCH_slice_t *slice = SIGFOX_NULL;
+    double start_ns = 0.0;
+    sfx_u32 first_list = 0;
+    sfx_u32 idx = 0;
+    // Parallel mode: the batch is split into one slice per thread, each slice being processed with its own context.
+    for (idx = 0; idx < nb_threads; idx++) {
+        slice = &(slices[idx]);
+        slice->input_data_list = &(sigfox_ep_addon_aw_bench_batch_input_data_list[first_list]);
+        slice->output_data_list = &(sigfox_ep_addon_aw_bench_batch_output_data_list[first_list]);
+        slice->nb_lists = (((idx + 1) * SIGFOX_EP_ADDON_AW_BENCH_BATCH_NB_LISTS) / nb_threads) - first_list;
+        slice->nb_runs = nb_runs;
+        slice->build = build;
+        first_list += (slice->nb_lists);
+    }
+    start_ns = _get_time_ns();
+#ifdef SIGFOX_EP_ADDON_AW_BENCH_THREADS
+    for (idx = 1; idx < nb_threads; idx++) {
+        if (pthread_create(&(slices[idx].thread), SIGFOX_NULL, &_build_slice, &(slices[idx])) != 0) {
+            // Process the slice in the calling thread.
+            _build_slice(&(slices[idx]));
+            slices[idx].thread = pthread_self();
+        }
+    }
+#endif
+    // The first slice is processed by the calling thread.
+    _build_slice(&(slices[0]));
+#ifdef SIGFOX_EP_ADDON_AW_BENCH_THREADS
+    for (idx = 1; idx < nb_threads; idx++) {
+        if (pthread_equal(slices[idx].thread, pthread_self()) == 0) {
+            pthread_join(slices[idx].thread, SIGFOX_NULL);
+        }
+    }
+#endif
+    return (_get_time_ns() - start_ns);
+}
+
+/*******************************************************************/
+static void _print_result(FILE *output, const SIGFOX_EP_ADDON_AW_BENCH_scenario_t *scenario, SIGFOX_EP_ADDON_AW_API_index_t list_size, sfx_u8 filters, sfx_u8 sorting, const char *input, sfx_u32 nb_runs, double total_ns) {
+    if (total_ns < 0.0) {
+        total_ns = 0.0;
+    }
+    fprintf(output, "%s,%d,%d,%d,%d,%s,%u,%u,%u,%s,%lu,%.2f,%.2f\n",
+        SIGFOX_EP_ADDON_AW_VERSION,
+        SIGFOX_EP_ADDON_AW_BENCH_ERROR_CODES,
+        SIGFOX_EP_ADDON_AW_BENCH_PARAMETERS_CHECK,
+        SIGFOX_EP_ADDON_AW_BENCH_WIDE_INDEX,
+        SIGFOX_EP_ADDON_AW_BENCH_LAZY_FILTERS,
+        scenario->name,
+        (unsigned int) list_size,
+        (unsigned int) filters,
+        (unsigned int) sorting,
+        input,
+        (unsigned long) nb_runs,
+        (total_ns / ((double) nb_runs * (double) list_size)),
+        (total_ns / ((double) nb_runs)));
+}
+
+/*******************************************************************/
+static void _configure(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_u8 filters, sfx_u8 sorting) {
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST))
+    SIGFOX_EP_ADDON_AW_TEST_COMMON_configure(context, filters, (SIGFOX_EP_ADDON_AW_API_sorting_t) sorting, SIGFOX_EP_ADDON_AW_BENCH_RSSI_MIN_DBM, &sigfox_ep_addon_aw_bench_oui_black_list);
+#else
+    SIGFOX_EP_ADDON_AW_TEST_COMMON_configure(context, filters, (SIGFOX_EP_ADDON_AW_API_sorting_t) sorting, SIGFOX_EP_ADDON_AW_BENCH_RSSI_MIN_DBM, SIGFOX_NULL);
+#endif
+}
+
+/*** SIGFOX EP ADDON AW BENCH functions ***/
+
+/*******************************************************************/
+int main(int argc, char *argv[]) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_context_t context;
+    SIGFOX_EP_ADDON_AW_API_input_data_t input_data;
+#ifdef SIGFOX_EP_ADDON_AW_PACKED_INPUT
+    SIGFOX_EP_ADDON_AW_API_packed_input_data_t packed_input_data;
+#endif
+    SIGFOX_EP_ADDON_AW_BENCH_slice_t slices[SIGFOX_EP_ADDON_AW_BENCH_NB_THREADS_MAX];
+    const SIGFOX_EP_ADDON_AW_BENCH_scenario_t *scenario = SIGFOX_NULL;
+    FILE *output = stdout;
+    char input[16];
+    SIGFOX_EP_ADDON_AW_API_index_t list_size = 0;
+    double total_ns = 0.0;
+    sfx_u32 nb_runs = 0;
+    sfx_u32 nb_batch_runs = 0;
+    sfx_u32 nb_threads = 0;
+    sfx_u32 scenario_idx = 0;
+    sfx_u32 size_idx = 0;
+    sfx_u32 idx = 0;
+    sfx_u8 filters = 0;
+    sfx_u8 sorting = 0;
+    // Results are appended to the given file, or printed on the standard output.
+    if (argc > 1) {
+        output = fopen(argv[1], "a");
+        if (output == SIGFOX_NULL) {
+            fprintf(stderr, "ERROR: cannot open %s\n", argv[1]);
+            return 1;
+        }
+    }
+    if ((output == stdout) || (ftell(output) == 0)) {
+        fprintf(output, "version,error_codes,parameters_check,wide_index,lazy_filters,scenario,list_size,filters,sorting,input,runs,ns_per_ap,ns_per_payload\n");
+    }
+    sigfox_ep_addon_aw_bench_batch_access_points = malloc(SIGFOX_EP_ADDON_AW_BENCH_BATCH_NB_LISTS * SIGFOX_EP_ADDON_AW_BENCH_LIST_SIZE_MAX * sizeof(SIGFOX_EP_ADDON_AW_API_access_point_t));
+    sigfox_ep_addon_aw_bench_batch_access_point_list = malloc(SIGFOX_EP_ADDON_AW_BENCH_BATCH_NB_LISTS * SIGFOX_EP_ADDON_AW_BENCH_LIST_SIZE_MAX * sizeof(SIGFOX_EP_ADDON_AW_API_access_point_t *));
+    if ((sigfox_ep_addon_aw_bench_batch_access_points == SIGFOX_NULL) || (sigfox_ep_addon_aw_bench_batch_access_point_list == SIGFOX_NULL)) {
+        fprintf(stderr, "ERROR: cannot allocate the batch lists\n");
+        return 1;
+    }
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST))
+    _generate_oui_black_list();
+#endif
+    input_data.access_point_list = sigfox_ep_addon_aw_bench_access_point_list;
+#ifdef SIGFOX_EP_ADDON_AW_PACKED_INPUT
+    packed_input_data.packed_access_point_list = sigfox_ep_addon_aw_bench_packed_access_points;
+#endif
+    for (scenario_idx = 0; scenario_idx < (sizeof(SIGFOX_EP_ADDON_AW_BENCH_SCENARIOS) / sizeof(SIGFOX_EP_ADDON_AW_BENCH_scenario_t)); scenario_idx++) {
+        scenario = &(SIGFOX_EP_ADDON_AW_BENCH_SCENARIOS[scenario_idx]);
+        for (size_idx = 0; size_idx < (sizeof(SIGFOX_EP_ADDON_AW_BENCH_LIST_SIZES) / sizeof(SIGFOX_EP_ADDON_AW_API_index_t)); size_idx++) {
+            list_size = SIGFOX_EP_ADDON_AW_BENCH_LIST_SIZES[size_idx];
+            _generate_list(scenario, list_size);
+            input_data.access_point_list_size = list_size;
+            _generate_batch(list_size);
+#ifdef SIGFOX_EP_ADDON_AW_PACKED_INPUT
+            packed_input_data.packed_access_point_list_size = list_size;
+#endif
+            nb_runs = (SIGFOX_EP_ADDON_AW_BENCH_AP_PER_MEASUREMENT / list_size);
+            if (nb_runs < SIGFOX_EP_ADDON_AW_BENCH_RUNS_MIN) {
+                nb_runs = SIGFOX_EP_ADDON_AW_BENCH_RUNS_MIN;
+            }
+            nb_batch_runs = ((nb_runs + SIGFOX_EP_ADDON_AW_BENCH_BATCH_NB_LISTS - 1) / SIGFOX_EP_ADDON_AW_BENCH_BATCH_NB_LISTS);
+            for (sorting = SIGFOX_EP_ADDON_AW_BENCH_SORTING_FIRST; sorting <= SIGFOX_EP_ADDON_AW_BENCH_SORTING_LAST; sorting++) {
+                for (filters = SIGFOX_EP_ADDON_AW_BENCH_FILTERS_FIRST; filters <= SIGFOX_EP_ADDON_AW_BENCH_FILTERS_LAST; filters++) {
+                    _configure(&context, filters, sorting);
+                    // Warm-up run, then measurement without the list reset overhead.
+                    _measure(&context, &input_data, 1, 1);
+                    total_ns = _measure(&context, &input_data, nb_runs, 1) - _measure(&context, &input_data, nb_runs, 0);
+                    _print_result(output, scenario, list_size, filters, sorting, "list", nb_runs, total_ns);
+#ifdef SIGFOX_EP_ADDON_AW_PACKED_INPUT
+                    // Same measurement on the packed array (MAC address decoding and SSID checks are done when packing).
+                    _measure_packed(&context, &packed_input_data, 1, 1);
+                    total_ns = _measure_packed(&context, &packed_input_data, nb_runs, 1) - _measure_packed(&context, &packed_input_data, nb_runs, 0);
+                    _print_result(output, scenario, list_size, filters, sorting, "packed", nb_runs, total_ns);
+#endif
+                }
+                // Batch builder with all the filters, compared to one call per list, then split over several threads.
+                filters = SIGFOX_EP_ADDON_AW_BENCH_FILTERS_LAST;
+                _configure(&context, filters, sorting);
+                _measure_loop(&context, 1, 1);
+                total_ns = _measure_loop(&context, nb_batch_runs, 1) - _measure_loop(&context, nb_batch_runs, 0);
+                _print_result(output, scenario, list_size, filters, sorting, "loop", (nb_batch_runs * SIGFOX_EP_ADDON_AW_BENCH_BATCH_NB_LISTS), total_ns);
+                for (nb_threads = 1; nb_threads <= SIGFOX_EP_ADDON_AW_BENCH_NB_THREADS_MAX; nb_threads *= 2) {
+                    for (idx = 0; idx < nb_threads; idx++) {
+                        _configure(&(slices[idx].context), filters, sorting);
+                    }
+                    _measure_batch(slices, nb_threads, 1, 1);
+                    total_ns = _measure_batch(slices, nb_threads, nb_batch_runs, 1) - _measure_batch(slices, nb_threads, nb_batch_runs, 0);
+                    if (nb_threads == 1) {
+                        sprintf(input, "batch");
+                    }
+                    else {
+                        sprintf(input, "batch_threads_%u", (unsigned int) nb_threads);
+                    }
+                    _print_result(output, scenario, list_size, filters, sorting, input, (nb_batch_runs * SIGFOX_EP_ADDON_AW_BENCH_BATCH_NB_LISTS), total_ns);
+                }
+            }
+        }
+    }
+    if (output != stdout) {
+        fclose(output);
+    }
+    free(sigfox_ep_addon_aw_bench_batch_access_points);
+    free(sigfox_ep_addon_aw_bench_batch_access_point_list);
+    return 0;
+}
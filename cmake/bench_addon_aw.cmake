@@ -0,0 +1,82 @@
+################################################################################
+#
+# Copyright (c) 2025, UnaBiz SAS
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#  1 Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#  2 Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+#    used to endorse or promote products derived from this software without
+#    specific prior written permission.
+#
+# NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+# THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+# CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+# PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+# CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+# BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+# IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+################################################################################
+
+
+#Host benchmark of the addon, built once per Sigfox EP library flags combination
+#The combination flags are given as compiler definitions: they must not be set in the sigfox_ep_flags.h file
+#The batch builder is also measured with one slice per thread when POSIX threads are available
+find_package(Threads)
+set(ADDON_AW_BENCH_SOURCES
+    ${ADDON_AW_SOURCES}
+    test/sigfox_ep_addon_aw_test_common.c
+    bench/sigfox_ep_addon_aw_bench.c
+)
+set(ADDON_AW_BENCH_OUTPUT ${CMAKE_BINARY_DIR}/${PROJECT_NAME}_bench.csv)
+set(ADDON_AW_BENCH_TARGETS "")
+set(ADDON_AW_BENCH_COMMANDS "")
+foreach(ERROR_CODES IN ITEMS OFF ON)
+    foreach(PARAMETERS_CHECK IN ITEMS OFF ON)
+        set(ADDON_AW_BENCH_TARGET ${PROJECT_NAME}_bench_ec_${ERROR_CODES}_pc_${PARAMETERS_CHECK})
+        add_executable(${ADDON_AW_BENCH_TARGET} EXCLUDE_FROM_ALL ${ADDON_AW_BENCH_SOURCES})
+        target_include_directories(${ADDON_AW_BENCH_TARGET} PRIVATE
+            ${CMAKE_CURRENT_SOURCE_DIR}/inc
+            ${CMAKE_CURRENT_SOURCE_DIR}/test
+            $<BUILD_INTERFACE:$<TARGET_PROPERTY:sigfox_ep_lib_obj,INTERFACE_INCLUDE_DIRECTORIES>>
+        )
+        target_compile_definitions(${ADDON_AW_BENCH_TARGET} PRIVATE ${ADDON_AW_DEFINITIONS})
+        if(CMAKE_USE_PTHREADS_INIT)
+            target_compile_definitions(${ADDON_AW_BENCH_TARGET} PRIVATE SIGFOX_EP_ADDON_AW_BENCH_THREADS)
+            target_link_libraries(${ADDON_AW_BENCH_TARGET} PRIVATE Threads::Threads)
+        endif()
+        #Override the library configuration (undefinitions are given after the library definitions)
+        if(ERROR_CODES)
+            target_compile_definitions(${ADDON_AW_BENCH_TARGET} PRIVATE SIGFOX_EP_ERROR_CODES)
+        else()
+            target_compile_options(${ADDON_AW_BENCH_TARGET} PRIVATE -USIGFOX_EP_ERROR_CODES)
+        endif()
+        if(PARAMETERS_CHECK)
+            target_compile_definitions(${ADDON_AW_BENCH_TARGET} PRIVATE SIGFOX_EP_PARAMETERS_CHECK)
+        else()
+            target_compile_options(${ADDON_AW_BENCH_TARGET} PRIVATE -USIGFOX_EP_PARAMETERS_CHECK)
+        endif()
+        list(APPEND ADDON_AW_BENCH_TARGETS ${ADDON_AW_BENCH_TARGET})
+        list(APPEND ADDON_AW_BENCH_COMMANDS COMMAND $<TARGET_FILE:${ADDON_AW_BENCH_TARGET}> ${ADDON_AW_BENCH_OUTPUT})
+    endforeach()
+endforeach()
+
+add_custom_target(${PROJECT_NAME}_bench
+    COMMAND ${CMAKE_COMMAND} -E remove -f ${ADDON_AW_BENCH_OUTPUT}
+    ${ADDON_AW_BENCH_COMMANDS}
+    COMMAND ${CMAKE_COMMAND} -E echo "Benchmark results written in ${ADDON_AW_BENCH_OUTPUT}"
+    DEPENDS ${ADDON_AW_BENCH_TARGETS}
+    VERBATIM
+)
@@ -0,0 +1,94 @@
+################################################################################
+#
+# Copyright (c) 2025, UnaBiz SAS
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#  1 Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#  2 Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+#    used to endorse or promote products derived from this software without
+#    specific prior written permission.
+#
+# NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+# THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+# CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+# PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+# CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+# BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+# IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+################################################################################
+
+
+#Memory footprint report of the addon, built once per flags configuration with the current toolchain
+#Each configuration is given as <name>=<flag>,<flag>,... (the addon options of the build are not used)
+#The configuration flags are given as compiler definitions: they must not be set in the sigfox_ep_flags.h file
+set(ADDON_AW_FOOTPRINT_CONFIGS
+    "default="
+    "error_codes=SIGFOX_EP_ERROR_CODES"
+    "parameters_check=SIGFOX_EP_PARAMETERS_CHECK"
+    "all_checks=SIGFOX_EP_ERROR_CODES,SIGFOX_EP_PARAMETERS_CHECK"
+    "static=SIGFOX_EP_ADDON_AW_STATIC_FILTERS,SIGFOX_EP_ADDON_AW_FILTER_LOCALLY_ADMINISTERED,SIGFOX_EP_ADDON_AW_FILTER_SSID_EMPTY,SIGFOX_EP_ADDON_AW_STATIC_SORTING,SIGFOX_EP_ADDON_AW_SORTING_RSSI"
+    "static_black_list=SIGFOX_EP_ADDON_AW_STATIC_FILTERS,SIGFOX_EP_ADDON_AW_FILTER_LOCALLY_ADMINISTERED,SIGFOX_EP_ADDON_AW_FILTER_SSID_EMPTY,SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST,SIGFOX_EP_ADDON_AW_STATIC_SORTING,SIGFOX_EP_ADDON_AW_SORTING_RSSI"
+    CACHE STRING "Flags configurations of the footprint report (<name>=<flag>,<flag>,...)"
+)
+set(ADDON_AW_FOOTPRINT_COMPILE_OPTIONS "-Os" CACHE STRING "Compilation options of the footprint report (in addition to the toolchain flags)")
+set(ADDON_AW_FOOTPRINT_FLASH_BUDGET 0 CACHE STRING "Maximum text + rodata + data size in bytes of each footprint configuration (0 to disable the check)")
+set(ADDON_AW_FOOTPRINT_RAM_BUDGET 0 CACHE STRING "Maximum data + bss size in bytes of each footprint configuration (0 to disable the check)")
+set(ADDON_AW_FOOTPRINT_STACK_BUDGET 0 CACHE STRING "Maximum worst-case stack in bytes of each footprint configuration (0 to disable the check)")
+
+set(ADDON_AW_FOOTPRINT_OUTPUT ${CMAKE_BINARY_DIR}/${PROJECT_NAME}_footprint.csv)
+set(ADDON_AW_FOOTPRINT_OBJECTS_FILE ${CMAKE_BINARY_DIR}/${PROJECT_NAME}_footprint_objects)
+set(ADDON_AW_FOOTPRINT_TARGETS "")
+set(ADDON_AW_FOOTPRINT_OBJECTS "")
+foreach(CONFIG IN LISTS ADDON_AW_FOOTPRINT_CONFIGS)
+    if(NOT CONFIG MATCHES "^([A-Za-z0-9_]+)=(.*)$")
+        message(FATAL_ERROR "Invalid footprint configuration '${CONFIG}' (expected <name>=<flag>,<flag>,...)")
+    endif()
+    set(CONFIG_NAME ${CMAKE_MATCH_1})
+    string(REPLACE "," ";" CONFIG_FLAGS "${CMAKE_MATCH_2}")
+    set(ADDON_AW_FOOTPRINT_TARGET ${PROJECT_NAME}_footprint_${CONFIG_NAME})
+    add_library(${ADDON_AW_FOOTPRINT_TARGET} OBJECT EXCLUDE_FROM_ALL ${ADDON_AW_SOURCES})
+    target_include_directories(${ADDON_AW_FOOTPRINT_TARGET} PRIVATE
+        ${CMAKE_CURRENT_SOURCE_DIR}/inc
+        $<BUILD_INTERFACE:$<TARGET_PROPERTY:sigfox_ep_lib_obj,INTERFACE_INCLUDE_DIRECTORIES>>
+    )
+    target_compile_definitions(${ADDON_AW_FOOTPRINT_TARGET} PRIVATE ${CONFIG_FLAGS})
+    #Override the library configuration (undefinitions are given after the library definitions)
+    if(NOT "SIGFOX_EP_ERROR_CODES" IN_LIST CONFIG_FLAGS)
+        target_compile_options(${ADDON_AW_FOOTPRINT_TARGET} PRIVATE -USIGFOX_EP_ERROR_CODES)
+    endif()
+    if(NOT "SIGFOX_EP_PARAMETERS_CHECK" IN_LIST CONFIG_FLAGS)
+        target_compile_options(${ADDON_AW_FOOTPRINT_TARGET} PRIVATE -USIGFOX_EP_PARAMETERS_CHECK)
+    endif()
+    #One section per function gives the address-taken functions, stack usage and call graph give the worst-case stack
+    separate_arguments(ADDON_AW_FOOTPRINT_OPTIONS UNIX_COMMAND "${ADDON_AW_FOOTPRINT_COMPILE_OPTIONS}")
+    target_compile_options(${ADDON_AW_FOOTPRINT_TARGET} PRIVATE ${ADDON_AW_FOOTPRINT_OPTIONS} -ffunction-sections -fdata-sections -fstack-usage -fcallgraph-info=su)
+    list(APPEND ADDON_AW_FOOTPRINT_TARGETS ${ADDON_AW_FOOTPRINT_TARGET})
+    string(APPEND ADDON_AW_FOOTPRINT_OBJECTS "${CONFIG_NAME}|$<TARGET_OBJECTS:${ADDON_AW_FOOTPRINT_TARGET}>\n")
+endforeach()
+file(GENERATE OUTPUT ${ADDON_AW_FOOTPRINT_OBJECTS_FILE} CONTENT "${ADDON_AW_FOOTPRINT_OBJECTS}")
+
+add_custom_target(${PROJECT_NAME}_footprint
+    COMMAND ${CMAKE_COMMAND}
+        -DADDON_AW_FOOTPRINT_OBJECTS_FILE=${ADDON_AW_FOOTPRINT_OBJECTS_FILE}
+        -DADDON_AW_FOOTPRINT_OUTPUT=${ADDON_AW_FOOTPRINT_OUTPUT}
+        -DADDON_AW_FOOTPRINT_OBJDUMP=${CMAKE_OBJDUMP}
+        -DADDON_AW_FOOTPRINT_FLASH_BUDGET=${ADDON_AW_FOOTPRINT_FLASH_BUDGET}
+        -DADDON_AW_FOOTPRINT_RAM_BUDGET=${ADDON_AW_FOOTPRINT_RAM_BUDGET}
+        -DADDON_AW_FOOTPRINT_STACK_BUDGET=${ADDON_AW_FOOTPRINT_STACK_BUDGET}
+        -P ${CMAKE_CURRENT_LIST_DIR}/footprint_report_addon_aw.cmake
+    DEPENDS ${ADDON_AW_FOOTPRINT_TARGETS}
+    VERBATIM
+)
@@ -0,0 +1,235 @@
+################################################################################
+#
+# Copyright (c) 2025, UnaBiz SAS
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#  1 Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#  2 Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+#    used to endorse or promote products derived from this software without
+#    specific prior written permission.
+#
+# NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+# THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+# CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+# PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+# CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+# BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+# IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+################################################################################
+
+
+#Footprint report script (cmake -P), called by the footprint target with the objects of each configuration
+#Sizes are read with objdump, the worst-case stack is the deepest path of the call graph weighted by the stack usage
+#Indirect calls are bounded by the functions whose address is stored in a data section (filters and sorting tables)
+#Functions which are not compiled with the addon (C library, user callbacks) are counted as 0 bytes
+
+#Left-justify a value in a column
+function(_footprint_pad VALUE WIDTH OUTPUT)
+    string(LENGTH "${VALUE}" LENGTH)
+    while(LENGTH LESS WIDTH)
+        string(APPEND VALUE " ")
+        math(EXPR LENGTH "${LENGTH} + 1")
+    endwhile()
+    set(${OUTPUT} "${VALUE}" PARENT_SCOPE)
+endfunction()
+
+#Table line of the report
+function(_footprint_line VALUES OUTPUT)
+    set(LINE "")
+    foreach(IDX RANGE 9)
+        list(GET VALUES ${IDX} VALUE)
+        list(GET WIDTHS ${IDX} WIDTH)
+        _footprint_pad("${VALUE}" ${WIDTH} VALUE)
+        list(APPEND LINE "${VALUE}")
+    endforeach()
+    string(JOIN " " LINE ${LINE})
+    set(${OUTPUT} "${LINE}" PARENT_SCOPE)
+endfunction()
+
+#Function name of a call graph node title (<file>:<function>)
+function(_footprint_function_name TITLE OUTPUT)
+    string(REGEX REPLACE "^.*:" "" NAME "${TITLE}")
+    set(${OUTPUT} "${NAME}" PARENT_SCOPE)
+endfunction()
+
+#Sections size and worst-case stack of one configuration
+function(_footprint_analyze OBJECTS)
+    set(TEXT 0)
+    set(RODATA 0)
+    set(DATA 0)
+    set(BSS 0)
+    set(FUNCTIONS "")
+    set(ADDRESS_TAKEN "")
+    set(DYNAMIC "")
+    foreach(OBJECT IN LISTS OBJECTS)
+        #Sections size
+        execute_process(COMMAND ${ADDON_AW_FOOTPRINT_OBJDUMP} -h ${OBJECT} OUTPUT_VARIABLE OBJDUMP_OUTPUT RESULT_VARIABLE RESULT)
+        if(NOT RESULT EQUAL 0)
+            message(FATAL_ERROR "${ADDON_AW_FOOTPRINT_OBJDUMP} failed on ${OBJECT}")
+        endif()
+        string(REGEX MATCHALL "\n *[0-9]+ [^ \n]+ +[0-9a-fA-F]+ " SECTIONS "${OBJDUMP_OUTPUT}")
+        foreach(SECTION IN LISTS SECTIONS)
+            string(REGEX MATCH "([^ \n]+) +([0-9a-fA-F]+) $" SECTION "${SECTION}")
+            set(SECTION_NAME ${CMAKE_MATCH_1})
+            math(EXPR SECTION_SIZE "0x${CMAKE_MATCH_2}")
+            if(SECTION_NAME MATCHES "^\\.text")
+                math(EXPR TEXT "${TEXT} + ${SECTION_SIZE}")
+            elseif(SECTION_NAME MATCHES "^\\.(s?rodata|data\\.rel\\.ro)")
+                math(EXPR RODATA "${RODATA} + ${SECTION_SIZE}")
+            elseif(SECTION_NAME MATCHES "^\\.s?data")
+                math(EXPR DATA "${DATA} + ${SECTION_SIZE}")
+            elseif(SECTION_NAME MATCHES "^\\.s?bss")
+                math(EXPR BSS "${BSS} + ${SECTION_SIZE}")
+            endif()
+        endforeach()
+        #Functions stored in data sections (called through function tables)
+        execute_process(COMMAND ${ADDON_AW_FOOTPRINT_OBJDUMP} -r ${OBJECT} OUTPUT_VARIABLE OBJDUMP_OUTPUT RESULT_VARIABLE RESULT)
+        if(NOT RESULT EQUAL 0)
+            message(FATAL_ERROR "${ADDON_AW_FOOTPRINT_OBJDUMP} failed on ${OBJECT}")
+        endif()
+        string(REPLACE "\n" ";" LINES "${OBJDUMP_OUTPUT}")
+        set(IN_DATA OFF)
+        foreach(LINE IN LISTS LINES)
+            if(LINE MATCHES "^RELOCATION RECORDS FOR \\[([^]]+)\\]")
+                if(CMAKE_MATCH_1 MATCHES "^\\.(s?rodata|s?data)")
+                    set(IN_DATA ON)
+                else()
+                    set(IN_DATA OFF)
+                endif()
+            elseif(IN_DATA AND (LINE MATCHES " \\.text\\.([A-Za-z0-9_.$]+)"))
+                list(APPEND ADDRESS_TAKEN ${CMAKE_MATCH_1})
+            endif()
+        endforeach()
+        #Stack usage of each function
+        string(REGEX REPLACE "\\.[^./]+$" "" OBJECT_BASE "${OBJECT}")
+        if(NOT EXISTS "${OBJECT_BASE}.su" OR NOT EXISTS "${OBJECT_BASE}.ci")
+            message(FATAL_ERROR "Stack usage files of ${OBJECT} not found")
+        endif()
+        file(STRINGS "${OBJECT_BASE}.su" STACK_LINES)
+        foreach(LINE IN LISTS STACK_LINES)
+            if(LINE MATCHES "^.*:([^:\t]+)\t([0-9]+)\t(.*)$")
+                set(FUNCTION ${CMAKE_MATCH_1})
+                list(APPEND FUNCTIONS ${FUNCTION})
+                set(FRAME_${FUNCTION} ${CMAKE_MATCH_2})
+                set(CALLEES_${FUNCTION} "")
+                if((CMAKE_MATCH_3 MATCHES "dynamic") AND (NOT CMAKE_MATCH_3 MATCHES "bounded"))
+                    list(APPEND DYNAMIC ${FUNCTION})
+                endif()
+            endif()
+        endforeach()
+        #Call graph
+        file(READ "${OBJECT_BASE}.ci" CALL_GRAPH)
+        string(REGEX MATCHALL "edge: { sourcename: \"[^\"]*\" targetname: \"[^\"]*\"" EDGES "${CALL_GRAPH}")
+        foreach(EDGE IN LISTS EDGES)
+            string(REGEX MATCH "sourcename: \"([^\"]*)\" targetname: \"([^\"]*)\"" EDGE "${EDGE}")
+            set(CALLEE_TITLE ${CMAKE_MATCH_2})
+            _footprint_function_name("${CMAKE_MATCH_1}" CALLER)
+            _footprint_function_name("${CALLEE_TITLE}" CALLEE)
+            list(APPEND CALLEES_${CALLER} ${CALLEE})
+        endforeach()
+    endforeach()
+    list(REMOVE_DUPLICATES ADDRESS_TAKEN)
+    #Worst-case stack of each function, iterated until stable (the call graph depth is reached)
+    foreach(FUNCTION IN LISTS FUNCTIONS)
+        set(STACK_${FUNCTION} ${FRAME_${FUNCTION}})
+    endforeach()
+    list(LENGTH FUNCTIONS NB_FUNCTIONS)
+    set(ITERATION 0)
+    set(CHANGED ON)
+    while(CHANGED)
+        if(ITERATION GREATER NB_FUNCTIONS)
+            message(FATAL_ERROR "Recursive call graph: the worst-case stack cannot be computed")
+        endif()
+        math(EXPR ITERATION "${ITERATION} + 1")
+        set(CHANGED OFF)
+        set(STACK___indirect_call 0)
+        foreach(FUNCTION IN LISTS ADDRESS_TAKEN)
+            if(DEFINED STACK_${FUNCTION} AND (STACK_${FUNCTION} GREATER STACK___indirect_call))
+                set(STACK___indirect_call ${STACK_${FUNCTION}})
+            endif()
+        endforeach()
+        foreach(FUNCTION IN LISTS FUNCTIONS)
+            set(CALLEES_STACK 0)
+            foreach(CALLEE IN LISTS CALLEES_${FUNCTION})
+                if(DEFINED STACK_${CALLEE} AND (STACK_${CALLEE} GREATER CALLEES_STACK))
+                    set(CALLEES_STACK ${STACK_${CALLEE}})
+                endif()
+            endforeach()
+            math(EXPR STACK "${FRAME_${FUNCTION}} + ${CALLEES_STACK}")
+            if(NOT STACK EQUAL STACK_${FUNCTION})
+                set(STACK_${FUNCTION} ${STACK})
+                set(CHANGED ON)
+            endif()
+        endforeach()
+    endwhile()
+    #Worst entry point of the API
+    set(STACK_MAX 0)
+    set(STACK_MAX_FUNCTION "-")
+    foreach(FUNCTION IN LISTS FUNCTIONS)
+        if((FUNCTION MATCHES "^SIGFOX_EP_ADDON_AW_API_") AND (STACK_${FUNCTION} GREATER STACK_MAX))
+            set(STACK_MAX ${STACK_${FUNCTION}})
+            set(STACK_MAX_FUNCTION ${FUNCTION})
+        endif()
+    endforeach()
+    if(DEFINED STACK_SIGFOX_EP_ADDON_AW_API_build_ul_payload)
+        set(STACK_BUILD ${STACK_SIGFOX_EP_ADDON_AW_API_build_ul_payload})
+    else()
+        set(STACK_BUILD "-")
+    endif()
+    if(DYNAMIC)
+        message(WARNING "Unbounded dynamic stack in ${DYNAMIC}")
+    endif()
+    foreach(VARIABLE IN ITEMS TEXT RODATA DATA BSS STACK_BUILD STACK_MAX STACK_MAX_FUNCTION)
+        set(${VARIABLE} ${${VARIABLE}} PARENT_SCOPE)
+    endforeach()
+endfunction()
+
+#Report
+file(STRINGS ${ADDON_AW_FOOTPRINT_OBJECTS_FILE} CONFIGS)
+set(COLUMNS configuration text rodata data bss flash ram stack_build_ul_payload stack_max stack_max_function)
+set(WIDTHS 20 8 8 8 8 8 8 24 10 0)
+string(REPLACE ";" "," CSV "${COLUMNS}")
+string(APPEND CSV "\n")
+set(TABLE "")
+set(ERRORS "")
+foreach(CONFIG IN LISTS CONFIGS)
+    string(REGEX MATCH "^([^|]*)\\|(.*)$" CONFIG "${CONFIG}")
+    set(CONFIG_NAME ${CMAKE_MATCH_1})
+    _footprint_analyze("${CMAKE_MATCH_2}")
+    math(EXPR FLASH "${TEXT} + ${RODATA} + ${DATA}")
+    math(EXPR RAM "${DATA} + ${BSS}")
+    set(VALUES ${CONFIG_NAME} ${TEXT} ${RODATA} ${DATA} ${BSS} ${FLASH} ${RAM} ${STACK_BUILD} ${STACK_MAX} ${STACK_MAX_FUNCTION})
+    string(REPLACE ";" "," LINE "${VALUES}")
+    string(APPEND CSV "${LINE}\n")
+    _footprint_line("${VALUES}" LINE)
+    string(APPEND TABLE "${LINE}\n")
+    #Budgets check
+    if((ADDON_AW_FOOTPRINT_FLASH_BUDGET GREATER 0) AND (FLASH GREATER ADDON_AW_FOOTPRINT_FLASH_BUDGET))
+        string(APPEND ERRORS "${CONFIG_NAME}: flash ${FLASH} bytes > ${ADDON_AW_FOOTPRINT_FLASH_BUDGET} bytes\n")
+    endif()
+    if((ADDON_AW_FOOTPRINT_RAM_BUDGET GREATER 0) AND (RAM GREATER ADDON_AW_FOOTPRINT_RAM_BUDGET))
+        string(APPEND ERRORS "${CONFIG_NAME}: ram ${RAM} bytes > ${ADDON_AW_FOOTPRINT_RAM_BUDGET} bytes\n")
+    endif()
+    if((ADDON_AW_FOOTPRINT_STACK_BUDGET GREATER 0) AND (STACK_MAX GREATER ADDON_AW_FOOTPRINT_STACK_BUDGET))
+        string(APPEND ERRORS "${CONFIG_NAME}: stack ${STACK_MAX} bytes (${STACK_MAX_FUNCTION}) > ${ADDON_AW_FOOTPRINT_STACK_BUDGET} bytes\n")
+    endif()
+endforeach()
+_footprint_line("${COLUMNS}" HEADER)
+file(WRITE ${ADDON_AW_FOOTPRINT_OUTPUT} "${CSV}")
+message("${HEADER}\n${TABLE}Footprint report written in ${ADDON_AW_FOOTPRINT_OUTPUT}")
+if(NOT ERRORS STREQUAL "")
+    message(FATAL_ERROR "Footprint budget exceeded:\n${ERRORS}")
+endif()
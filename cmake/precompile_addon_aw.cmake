@@ -41,15 +41,27 @@ foreach(X IN LISTS ADDON_AW_PUBLIC_HEADERS)
     LIST(APPEND PRECOMPIL_ADDON_AW_PUBLIC_HEADERS "${PRECOMPIL_DIR}/${X}")
 endforeach()
 
+#Addon specific flags file
+set(ADDON_AW_FLAGS_FILE_CONTENT "")
+foreach(X IN LISTS ADDON_AW_FLAGS)
+    if(${X})
+        string(APPEND ADDON_AW_FLAGS_FILE_CONTENT "#define ${X}\n")
+    else()
+        string(APPEND ADDON_AW_FLAGS_FILE_CONTENT "#undef ${X}\n")
+    endif()
+endforeach()
+file(GENERATE OUTPUT ${CMAKE_BINARY_DIR}/addon_aw_flags_file CONTENT "${ADDON_AW_FLAGS_FILE_CONTENT}")
+
 #Custom command Loop for all Sources
 foreach(X IN LISTS ADDON_AW_SOURCES ADDON_AW_HEADERS)
 add_custom_command(
     OUTPUT "${PRECOMPIL_DIR}/${X}"
     DEPENDS ${CMAKE_BINARY_DIR}/undefs_file
     DEPENDS ${CMAKE_BINARY_DIR}/defs_file
+    DEPENDS ${CMAKE_BINARY_DIR}/addon_aw_flags_file
     DEPENDS ${X}
     COMMAND ${CMAKE_COMMAND} -E make_directory ${PRECOMPIL_DIR}/src  ${PRECOMPIL_DIR}/inc
-    COMMAND unifdef -B -k -x 2 -f ${CMAKE_BINARY_DIR}/undefs_file -f ${CMAKE_BINARY_DIR}/defs_file ${PROJECT_SOURCE_DIR}/${X} > "${PRECOMPIL_DIR}/${X}" 
+    COMMAND unifdef -B -k -x 2 -f ${CMAKE_BINARY_DIR}/undefs_file -f ${CMAKE_BINARY_DIR}/defs_file -f ${CMAKE_BINARY_DIR}/addon_aw_flags_file ${PROJECT_SOURCE_DIR}/${X} > "${PRECOMPIL_DIR}/${X}" 
     VERBATIM
 )
 
@@ -0,0 +1,144 @@
+################################################################################
+#
+# Copyright (c) 2025, UnaBiz SAS
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#  1 Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+#  2 Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+#  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+#    used to endorse or promote products derived from this software without
+#    specific prior written permission.
+#
+# NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+# THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+# CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+# PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+# CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+# BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+# IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+################################################################################
+
+
+
+#Host tests of the addon, built once per Sigfox EP library flags combination
+#The combination flags are given as compiler definitions: they must not be set in the sigfox_ep_flags.h file
+#Each test is built with its own addon flags, so that the results do not depend on the options of the build
+enable_testing()
+find_package(Threads)
+include(CheckCSourceCompiles)
+#Random generator and list/context setup shared by the tests and the benchmark
+set(ADDON_AW_TEST_COMMON_SOURCES test/sigfox_ep_addon_aw_test_common.c)
+
+function(addon_aw_add_test TEST_NAME)
+    cmake_parse_arguments(ADDON_AW_TEST "" "" "SOURCES;DEFINITIONS;LIBRARIES" ${ARGN})
+    foreach(ERROR_CODES IN ITEMS OFF ON)
+        foreach(PARAMETERS_CHECK IN ITEMS OFF ON)
+            set(ADDON_AW_TEST_TARGET ${PROJECT_NAME}_test_${TEST_NAME}_ec_${ERROR_CODES}_pc_${PARAMETERS_CHECK})
+            add_executable(${ADDON_AW_TEST_TARGET} ${ADDON_AW_SOURCES} ${ADDON_AW_TEST_COMMON_SOURCES} ${ADDON_AW_TEST_SOURCES})
+            target_include_directories(${ADDON_AW_TEST_TARGET} PRIVATE
+                ${CMAKE_CURRENT_SOURCE_DIR}/inc
+                ${CMAKE_CURRENT_SOURCE_DIR}/test
+                $<BUILD_INTERFACE:$<TARGET_PROPERTY:sigfox_ep_lib_obj,INTERFACE_INCLUDE_DIRECTORIES>>
+            )
+            target_compile_definitions(${ADDON_AW_TEST_TARGET} PRIVATE ${ADDON_AW_TEST_DEFINITIONS})
+            #Override the library configuration (undefinitions are given after the library definitions)
+            if(ERROR_CODES)
+                target_compile_definitions(${ADDON_AW_TEST_TARGET} PRIVATE SIGFOX_EP_ERROR_CODES)
+            else()
+                target_compile_options(${ADDON_AW_TEST_TARGET} PRIVATE -USIGFOX_EP_ERROR_CODES)
+            endif()
+            if(PARAMETERS_CHECK)
+                target_compile_definitions(${ADDON_AW_TEST_TARGET} PRIVATE SIGFOX_EP_PARAMETERS_CHECK)
+            else()
+                target_compile_options(${ADDON_AW_TEST_TARGET} PRIVATE -USIGFOX_EP_PARAMETERS_CHECK)
+            endif()
+            target_link_libraries(${ADDON_AW_TEST_TARGET} PRIVATE ${ADDON_AW_TEST_LIBRARIES})
+            add_test(NAME ${ADDON_AW_TEST_TARGET} COMMAND ${ADDON_AW_TEST_TARGET})
+        endforeach()
+    endforeach()
+endfunction()
+
+#MAC address decoder compared to a reference decoder on all single and adjacent pair character mutations
+addon_aw_add_test(mac
+    SOURCES test/sigfox_ep_addon_aw_test_mac.c
+    DEFINITIONS SIGFOX_EP_ADDON_AW_PACKED_INPUT
+)
+
+#Same test with the SSE2 or NEON decoder when the host supports it
+check_c_source_compiles("
+#if !(defined __SSE2__) && !(defined __ARM_NEON)
+#error
+#endif
+int main(void) { return 0; }
+" ADDON_AW_SIMD_SUPPORTED)
+if(ADDON_AW_SIMD_SUPPORTED)
+    addon_aw_add_test(mac_simd
+        SOURCES test/sigfox_ep_addon_aw_test_mac.c
+        DEFINITIONS SIGFOX_EP_ADDON_AW_PACKED_INPUT SIGFOX_EP_ADDON_AW_SIMD
+    )
+endif()
+
+#Timing hooks measured with a fake clock, and payloads unchanged without the timing flag
+addon_aw_add_test(timing
+    SOURCES test/sigfox_ep_addon_aw_test_timing.c
+    DEFINITIONS SIGFOX_EP_ADDON_AW_TIMING
+)
+addon_aw_add_test(timing_disabled
+    SOURCES test/sigfox_ep_addon_aw_test_timing.c
+)
+
+#Timing types and context fields only defined with the timing flag (the probes are built by the tests, the disabled ones must fail)
+foreach(PROBE IN ITEMS TYPES FIELDS)
+    foreach(TIMING IN ITEMS ON OFF)
+        string(TOLOWER ${PROJECT_NAME}_test_timing_probe_${PROBE}_${TIMING} ADDON_AW_PROBE_TARGET)
+        add_library(${ADDON_AW_PROBE_TARGET} OBJECT EXCLUDE_FROM_ALL test/sigfox_ep_addon_aw_test_timing_probe.c)
+        target_include_directories(${ADDON_AW_PROBE_TARGET} PRIVATE
+            ${CMAKE_CURRENT_SOURCE_DIR}/inc
+            $<BUILD_INTERFACE:$<TARGET_PROPERTY:sigfox_ep_lib_obj,INTERFACE_INCLUDE_DIRECTORIES>>
+        )
+        target_compile_definitions(${ADDON_AW_PROBE_TARGET} PRIVATE SIGFOX_EP_ADDON_AW_TEST_TIMING_PROBE_${PROBE})
+        if(TIMING)
+            target_compile_definitions(${ADDON_AW_PROBE_TARGET} PRIVATE SIGFOX_EP_ADDON_AW_TIMING)
+        else()
+            target_compile_options(${ADDON_AW_PROBE_TARGET} PRIVATE -USIGFOX_EP_ADDON_AW_TIMING)
+        endif()
+        add_test(NAME ${ADDON_AW_PROBE_TARGET}
+            COMMAND ${CMAKE_COMMAND} --build ${CMAKE_BINARY_DIR} --target ${ADDON_AW_PROBE_TARGET} --config $<CONFIG>
+        )
+        if(NOT TIMING)
+            set_tests_properties(${ADDON_AW_PROBE_TARGET} PROPERTIES WILL_FAIL TRUE)
+        endif()
+    endforeach()
+endforeach()
+
+#CWLAP output given to the stream parser in random chunks and records pushed one by one, compared to the list payload builder
+addon_aw_add_test(stream
+    SOURCES test/sigfox_ep_addon_aw_test_stream.c
+    DEFINITIONS SIGFOX_EP_ADDON_AW_STREAM
+)
+
+#Uplink payloads decoder on crafted payloads, and round trip of the payloads built from random lists
+addon_aw_add_test(decoder
+    SOURCES test/sigfox_ep_addon_aw_test_decoder.c
+    DEFINITIONS SIGFOX_EP_ADDON_AW_DECODER
+)
+
+#Contexts used concurrently by several threads
+if(CMAKE_USE_PTHREADS_INIT)
+    addon_aw_add_test(threads
+        SOURCES test/sigfox_ep_addon_aw_test_threads.c
+        LIBRARIES Threads::Threads
+    )
+endif()
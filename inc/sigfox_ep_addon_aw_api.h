@@ -47,10 +47,79 @@
 #define SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR    17
 #define SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR           32
 
+#define SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES   6
+
 #define SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES    12
+#define SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD        (SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES / SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES)
+
+#ifndef SIGFOX_EP_ADDON_AW_API_DEDUPLICATION_TABLE_SIZE
+#define SIGFOX_EP_ADDON_AW_API_DEDUPLICATION_TABLE_SIZE 64 // Power of 2, allocated on the stack. Beyond this number of distinct valid access points, duplicates are not removed anymore.
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_RSSI_MIN))
+#ifndef SIGFOX_EP_ADDON_AW_API_RSSI_MIN_DBM_DEFAULT
+#define SIGFOX_EP_ADDON_AW_API_RSSI_MIN_DBM_DEFAULT     (-90) // Threshold of the minimum RSSI filter until SIGFOX_EP_ADDON_AW_API_set_rssi_min() is called.
+#endif
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_LAZY_FILTERS
+#ifndef SIGFOX_EP_ADDON_AW_API_LAZY_ROUNDS_MAX
+#define SIGFOX_EP_ADDON_AW_API_LAZY_ROUNDS_MAX          4 // Selections evaluated one by one before evaluating all the remaining access points at once.
+#endif
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST))
+#define SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_CLASS_MAP_SIZE               128
+#define SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_BUFFER_SIZE(nb_chars, nb_classes) \
+    (SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_CLASS_MAP_SIZE + (((nb_chars) + 8) / 8) + (((nb_chars) + 1) * ((nb_classes) + 1)))
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_ASYNC
+#ifndef SIGFOX_EP_ADDON_AW_STREAM
+#error "SIGFOX EP ADDON AW: SIGFOX_EP_ADDON_AW_ASYNC requires SIGFOX_EP_ADDON_AW_STREAM"
+#endif
+#define SIGFOX_EP_ADDON_AW_API_ASYNC_NB_BUFFERS         2 // One payload being sent while the next one is prepared.
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+#ifndef SIGFOX_EP_ADDON_AW_API_HISTORY_SIZE
+#define SIGFOX_EP_ADDON_AW_API_HISTORY_SIZE             8 // Number of sent MAC addresses remembered by a context (up to 255).
+#endif
+#define SIGFOX_EP_ADDON_AW_API_HISTORY_KEY_SIZE_BYTES   3
+#define SIGFOX_EP_ADDON_AW_API_HISTORY_DATA_SIZE_BYTES  (SIGFOX_EP_ADDON_AW_API_HISTORY_SIZE * (SIGFOX_EP_ADDON_AW_API_HISTORY_KEY_SIZE_BYTES + 1)) // Size of the history saved in NVM.
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_PACKED_INPUT
+#define SIGFOX_EP_ADDON_AW_API_PACKED_INFO_STATUS_MASK              0x07 // Access point status (@ref SIGFOX_EP_ADDON_AW_API_access_point_status_t).
+#define SIGFOX_EP_ADDON_AW_API_PACKED_INFO_SSID_EMPTY               0x08 // SSID empty or missing.
+#define SIGFOX_EP_ADDON_AW_API_PACKED_INFO_SSID_BLACK_LISTED        0x10 // SSID matching the black list selected when the access point was packed.
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD
+#ifndef SIGFOX_EP_ADDON_AW_API_COMPACT_FORMAT_ID
+#define SIGFOX_EP_ADDON_AW_API_COMPACT_FORMAT_ID            0x15 // Identifier of the compact payloads among the other custom payloads of the application (5 bits, written in B0b7 to B0b3).
+#endif
+#ifndef SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS
+#define SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS     4 // Maximum number of access points per compact payload: 3 (20 NIC bits, 8 dB RSSI steps) or 4 (14 NIC bits, 16 dB RSSI steps).
+#endif
+#define SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS_MAX 4
+#define SIGFOX_EP_ADDON_AW_API_COMPACT_DICTIONARY_SIZE_MAX  63 // The 6-bits OUI code keeps at least one value for the OUIs which are not in the dictionary.
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_DECODER
+#define SIGFOX_EP_ADDON_AW_API_DECODER_ERROR_RESERVED_MAC_ADDRESS   0x01 // MAC address only made of 0x00 and 0xFF bytes.
+#define SIGFOX_EP_ADDON_AW_API_DECODER_ERROR_MULTICAST_MAC_ADDRESS  0x02 // Second MAC address with the I/G bit set.
+#define SIGFOX_EP_ADDON_AW_API_DECODER_ERROR_DUPLICATE_MAC_ADDRESS  0x04 // Both MAC addresses are equal.
+#endif
 
 /*** SIGFOX EP ADDON AW API structures ***/
 
+#ifdef SIGFOX_EP_ADDON_AW_WIDE_INDEX
+typedef sfx_u16 SIGFOX_EP_ADDON_AW_API_index_t;
+#else
+typedef sfx_u8 SIGFOX_EP_ADDON_AW_API_index_t;
+#endif
+
 #ifdef SIGFOX_EP_ERROR_CODES
 /*!******************************************************************
  * \enum SIGFOX_EP_ADDON_AW_status_t
@@ -65,6 +134,12 @@ typedef enum {
     SIGFOX_EP_ADDON_AW_API_ERROR_ACCESS_POINT_LIST_SIZE,
     SIGFOX_EP_ADDON_AW_API_ERROR_NONE_VALID_ACCESS_POINT,
     SIGFOX_EP_ADDON_AW_API_ERROR_SORTING,
+    SIGFOX_EP_ADDON_AW_API_ERROR_SSID_BLACK_LIST,
+    SIGFOX_EP_ADDON_AW_API_ERROR_OUI_BLACK_LIST,
+    SIGFOX_EP_ADDON_AW_API_ERROR_COMPACT_DICTIONARY,
+    SIGFOX_EP_ADDON_AW_API_ERROR_COMPACT_PAYLOAD,
+    SIGFOX_EP_ADDON_AW_API_ERROR_ASYNC_STATE,
+    SIGFOX_EP_ADDON_AW_API_ERROR_HISTORY,
     SIGFOX_EP_ADDON_AW_API_ERROR_LAST
 } SIGFOX_EP_ADDON_AW_API_status_t;
 #else
@@ -80,6 +155,13 @@ typedef enum {
     SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_FILTERED_OUT,
     SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID,
     SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_SENT,
+    SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_DUPLICATE,
+#ifdef SIGFOX_EP_ADDON_AW_LAZY_FILTERS
+    SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_PENDING, // Cheap filters passed, MAC address decoding and other filters postponed until the access point can be selected.
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+    SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_RECENT, // Valid, but sent in one of the previous messages: only selected to complete the payload (see @ref SIGFOX_EP_ADDON_AW_API_history_mode_t).
+#endif
     SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_LAST
 } SIGFOX_EP_ADDON_AW_API_access_point_status_t;
 
@@ -91,6 +173,8 @@ typedef enum {
     SIGFOX_EP_ADDON_AW_API_FILTER_LOCALLY_ADMINISTERED = 0,
     SIGFOX_EP_ADDON_AW_API_FILTER_SSID_EMPTY,
     SIGFOX_EP_ADDON_AW_API_FILTER_SSID_BLACK_LIST,
+    SIGFOX_EP_ADDON_AW_API_FILTER_RSSI_MIN,
+    SIGFOX_EP_ADDON_AW_API_FILTER_OUI_BLACK_LIST,
     SIGFOX_EP_ADDON_AW_API_FILTER_LAST
 } SIGFOX_EP_ADDON_AW_API_filter_t;
 
@@ -101,9 +185,33 @@ typedef enum {
 typedef enum {
     SIGFOX_EP_ADDON_AW_API_SORTING_NONE = 0,
     SIGFOX_EP_ADDON_AW_API_SORTING_RSSI,
+    SIGFOX_EP_ADDON_AW_API_SORTING_SCANS,
+    SIGFOX_EP_ADDON_AW_API_SORTING_DEVICES,
     SIGFOX_EP_ADDON_AW_API_SORTING_LAST
 } SIGFOX_EP_ADDON_AW_API_sorting_t;
 
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+/*!******************************************************************
+ * \enum SIGFOX_EP_ADDON_AW_API_history_mode_t
+ * \brief Selection of the access points sent in the previous messages.
+ *******************************************************************/
+typedef enum {
+    SIGFOX_EP_ADDON_AW_API_HISTORY_MODE_NONE = 0, // History neither used nor updated.
+    SIGFOX_EP_ADDON_AW_API_HISTORY_MODE_PENALIZE, // Recent access points only selected when there are not enough new ones (least recently sent first).
+    SIGFOX_EP_ADDON_AW_API_HISTORY_MODE_SKIP, // Recent access points never selected.
+    SIGFOX_EP_ADDON_AW_API_HISTORY_MODE_LAST
+} SIGFOX_EP_ADDON_AW_API_history_mode_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_AW_API_history_entry_t
+ * \brief Sent MAC address remembered by a context.
+ *******************************************************************/
+typedef struct {
+    sfx_u8 key[SIGFOX_EP_ADDON_AW_API_HISTORY_KEY_SIZE_BYTES]; // OUI bytes folded on the NIC bytes.
+    sfx_u8 age; // Number of payloads built since the MAC address has been sent (0 for a free entry).
+} SIGFOX_EP_ADDON_AW_API_history_entry_t;
+#endif
+
 /*!******************************************************************
  * \struct SIGFOX_EP_ADDON_AW_API_access_point_t
  * \brief Sigfox EP ADDON AW access point structure.
@@ -113,6 +221,8 @@ typedef struct {
     sfx_u8 ssid[SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR];
     sfx_s16 rssi_dbm;
     SIGFOX_EP_ADDON_AW_API_access_point_status_t status;
+    sfx_u8 mac_address_bytes[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES]; // Decoded MAC address, written by the addon when the status leaves the NEW state (no initialization required).
+    sfx_u8 nb_scans; // Number of times the access point has been reported, written by the aggregator (must be set to 0 or 1 by the caller when the list is not built by the aggregator).
 } SIGFOX_EP_ADDON_AW_API_access_point_t;
 
 /*!******************************************************************
@@ -121,14 +231,314 @@ typedef struct {
  *******************************************************************/
 typedef struct {
     SIGFOX_EP_ADDON_AW_API_access_point_t **access_point_list;
-    sfx_u8 access_point_list_size;
+    SIGFOX_EP_ADDON_AW_API_index_t access_point_list_size; // Up to 255 access points, or 65535 with the SIGFOX_EP_ADDON_AW_WIDE_INDEX flag.
 } SIGFOX_EP_ADDON_AW_API_input_data_t;
 
+#ifdef SIGFOX_EP_ADDON_AW_PACKED_INPUT
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_AW_API_packed_access_point_t
+ * \brief Sigfox EP ADDON AW packed access point structure (8 bytes, stored in a contiguous array).
+ * \note  Filled by @ref SIGFOX_EP_ADDON_AW_API_pack_access_point, the SSID is replaced by the flags of the filters which use it.
+ *******************************************************************/
+typedef struct {
+    sfx_u8 mac_address_bytes[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES];
+    sfx_s8 rssi_dbm;
+    sfx_u8 info; // Status and SSID flags (SIGFOX_EP_ADDON_AW_API_PACKED_INFO_xxx).
+} SIGFOX_EP_ADDON_AW_API_packed_access_point_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_AW_API_packed_input_data_t
+ * \brief Sigfox EP ADDON AW packed input data structure.
+ *******************************************************************/
+typedef struct {
+    SIGFOX_EP_ADDON_AW_API_packed_access_point_t *packed_access_point_list;
+    SIGFOX_EP_ADDON_AW_API_index_t packed_access_point_list_size; // Up to 255 access points, or 65535 with the SIGFOX_EP_ADDON_AW_WIDE_INDEX flag.
+} SIGFOX_EP_ADDON_AW_API_packed_input_data_t;
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST))
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_AW_API_ssid_black_list_t
+ * \brief Sigfox EP ADDON AW compiled SSID black list (automaton matching all the words in a single pass).
+ * \note  Built by @ref SIGFOX_EP_ADDON_AW_API_compile_ssid_black_list, the tables are stored in a caller-owned buffer.
+ *******************************************************************/
+typedef struct {
+    const sfx_u8 *class_map;
+    const sfx_u8 *match_bitmap;
+    const sfx_u8 *transition_table;
+    sfx_u8 nb_states;
+    sfx_u8 nb_classes;
+} SIGFOX_EP_ADDON_AW_API_ssid_black_list_t;
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST) || (defined SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD))
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_AW_API_oui_table_t
+ * \brief Sigfox EP ADDON AW OUI table (organizationally unique identifiers), used as mobile devices vendors black list or as compact payload dictionary.
+ * \note  The table is usually generated by the sigfox_ep_addon_aw_oui_table tool and stored in flash.
+ *******************************************************************/
+typedef struct {
+    const sfx_u8 *oui_table; // OUIs in strictly increasing order, 3 bytes each (first MAC address byte first).
+    sfx_u16 nb_ouis;
+} SIGFOX_EP_ADDON_AW_API_oui_table_t;
+#endif
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_AW_API_aggregator_t
+ * \brief Sigfox EP ADDON AW multi-scan aggregator structure.
+ * \note  The access points merged by @ref SIGFOX_EP_ADDON_AW_API_aggregator_add_scan are given by the input_data field, which can directly be used to build the payloads.
+ *******************************************************************/
+typedef struct {
+    SIGFOX_EP_ADDON_AW_API_input_data_t input_data;
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_point_table;
+    SIGFOX_EP_ADDON_AW_API_index_t access_point_table_size;
+} SIGFOX_EP_ADDON_AW_API_aggregator_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_AW_API_output_data_t
+ * \brief Sigfox EP ADDON AW output data structure (used by the batch payload builder).
+ *******************************************************************/
+typedef struct {
+    sfx_u8 ul_payload[SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES];
+    sfx_u8 nb_mac_ul_payload;
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status;
+#endif
+} SIGFOX_EP_ADDON_AW_API_output_data_t;
+
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+/*!******************************************************************
+ * \enum SIGFOX_EP_ADDON_AW_API_stage_t
+ * \brief Payload building stages measured by the timing hooks.
+ * \note  The optional filters stages follow the @ref SIGFOX_EP_ADDON_AW_API_filter_t order.
+ *******************************************************************/
+typedef enum {
+    SIGFOX_EP_ADDON_AW_API_STAGE_MAC_ADDRESS_DECODING = 0,
+    SIGFOX_EP_ADDON_AW_API_STAGE_MANDATORY_FILTERS,
+    SIGFOX_EP_ADDON_AW_API_STAGE_FILTER_LOCALLY_ADMINISTERED,
+    SIGFOX_EP_ADDON_AW_API_STAGE_FILTER_SSID_EMPTY,
+    SIGFOX_EP_ADDON_AW_API_STAGE_FILTER_SSID_BLACK_LIST,
+    SIGFOX_EP_ADDON_AW_API_STAGE_FILTER_RSSI_MIN,
+    SIGFOX_EP_ADDON_AW_API_STAGE_FILTER_OUI_BLACK_LIST,
+    SIGFOX_EP_ADDON_AW_API_STAGE_DEDUPLICATION,
+    SIGFOX_EP_ADDON_AW_API_STAGE_SORTING,
+    SIGFOX_EP_ADDON_AW_API_STAGE_ENCODING,
+    SIGFOX_EP_ADDON_AW_API_STAGE_LAST
+} SIGFOX_EP_ADDON_AW_API_stage_t;
+
+/*!******************************************************************
+ * \brief Timestamp callback (cycle counter or timer ticks, wrapping on 32 bits).
+ *******************************************************************/
+typedef sfx_u32 (*SIGFOX_EP_ADDON_AW_API_timestamp_cb_t)(void);
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_AW_API_timing_t
+ * \brief Time spent in each payload building stage, in timestamp callback units.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 stage_total[SIGFOX_EP_ADDON_AW_API_STAGE_LAST];
+} SIGFOX_EP_ADDON_AW_API_timing_t;
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_STATISTICS
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_AW_API_statistics_t
+ * \brief Access points filtering statistics.
+ *******************************************************************/
+typedef struct {
+    sfx_u16 nb_reserved; // Access points rejected because of a reserved MAC address.
+    sfx_u16 nb_multicast; // Access points rejected because of a multicast MAC address.
+    sfx_u16 nb_filtered_out[SIGFOX_EP_ADDON_AW_API_FILTER_LAST]; // Access points rejected by each optional filter (indexed on @ref SIGFOX_EP_ADDON_AW_API_filter_t).
+    sfx_u16 nb_valid; // Access points which passed all the filters (including the duplicates).
+    sfx_u16 nb_duplicate; // Valid access points removed because the same MAC address has a better RSSI or has already been sent.
+    sfx_s16 rssi_min_dbm; // Minimum RSSI of the valid access points (0 if none).
+    sfx_s16 rssi_max_dbm; // Maximum RSSI of the valid access points (0 if none).
+    sfx_s16 rssi_mean_dbm; // Mean RSSI of the valid access points (0 if none).
+} SIGFOX_EP_ADDON_AW_API_statistics_t;
+#endif
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_AW_API_context_t
+ * \brief Sigfox EP ADDON AW context structure.
+ * \note  The context is owned by the caller and its fields must only be accessed through the addon functions.
+ *******************************************************************/
+typedef struct {
+#ifndef SIGFOX_EP_ADDON_AW_STATIC_FILTERS
+    sfx_u8 filters;
+#endif
+#ifndef SIGFOX_EP_ADDON_AW_STATIC_SORTING
+    SIGFOX_EP_ADDON_AW_API_sorting_t sorting;
+#endif
+    SIGFOX_EP_ADDON_AW_API_index_t best_index[SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD];
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST))
+    const SIGFOX_EP_ADDON_AW_API_ssid_black_list_t *ssid_black_list;
+#endif
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_RSSI_MIN))
+    sfx_s16 rssi_min_dbm;
+#endif
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST))
+    const SIGFOX_EP_ADDON_AW_API_oui_table_t *oui_black_list;
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD
+    const SIGFOX_EP_ADDON_AW_API_oui_table_t *compact_dictionary;
+#endif
+    SIGFOX_EP_ADDON_AW_API_input_data_t *drain_input_data;
+    SIGFOX_EP_ADDON_AW_API_index_t *drain_index;
+    SIGFOX_EP_ADDON_AW_API_index_t drain_index_size;
+    SIGFOX_EP_ADDON_AW_API_index_t drain_position;
+    sfx_bool deduplication_pending;
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+    SIGFOX_EP_ADDON_AW_API_timestamp_cb_t timestamp_cb;
+    SIGFOX_EP_ADDON_AW_API_timing_t timing;
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_STATISTICS
+    SIGFOX_EP_ADDON_AW_API_statistics_t statistics;
+    sfx_s32 statistics_rssi_sum;
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+    SIGFOX_EP_ADDON_AW_API_history_mode_t history_mode;
+    sfx_u8 history_age_max;
+    SIGFOX_EP_ADDON_AW_API_history_entry_t history[SIGFOX_EP_ADDON_AW_API_HISTORY_SIZE];
+#endif
+} SIGFOX_EP_ADDON_AW_API_context_t;
+
+#ifdef SIGFOX_EP_ADDON_AW_DECODER
+/*!******************************************************************
+ * \enum SIGFOX_EP_ADDON_AW_API_payload_type_t
+ * \brief Uplink payload type given by the I/G and U/L bits of the first byte.
+ *******************************************************************/
+typedef enum {
+    SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_ATLAS_WIFI = 0,
+    SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_RESERVED,
+    SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_CUSTOM,
+    SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_LAST
+} SIGFOX_EP_ADDON_AW_API_payload_type_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_AW_API_decoded_payload_t
+ * \brief Decoded uplink payload.
+ *******************************************************************/
+typedef struct {
+    SIGFOX_EP_ADDON_AW_API_payload_type_t payload_type;
+    sfx_u8 nb_mac; // Number of MAC addresses (only set for Atlas WiFi payloads, the zero padding is not counted).
+    sfx_u8 errors; // Invalid MAC addresses found in an Atlas WiFi payload (bitfield of SIGFOX_EP_ADDON_AW_API_DECODER_ERROR_xxx), 0 if the payload can be processed by the geolocation service.
+    sfx_u8 mac_address_bytes[SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD][SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES];
+} SIGFOX_EP_ADDON_AW_API_decoded_payload_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_AW_API_decoder_summary_t
+ * \brief Counters of a batch of decoded uplink payloads.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 nb_payloads[SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_LAST]; // Number of payloads per type (indexed on @ref SIGFOX_EP_ADDON_AW_API_payload_type_t).
+    sfx_u32 nb_mac_addresses; // Number of MAC addresses in the Atlas WiFi payloads.
+    sfx_u32 nb_invalid; // Number of Atlas WiFi payloads with at least one error.
+} SIGFOX_EP_ADDON_AW_API_decoder_summary_t;
+
+#ifdef SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_AW_API_compact_access_point_t
+ * \brief Access point decoded from a compact payload.
+ *******************************************************************/
+typedef struct {
+    sfx_u32 key; // OUI code followed by the truncated NIC, to compare with the keys of the known access points (@ref SIGFOX_EP_ADDON_AW_API_get_compact_key).
+    sfx_s16 rssi_dbm; // Middle of the quantization step.
+} SIGFOX_EP_ADDON_AW_API_compact_access_point_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_AW_API_decoded_compact_payload_t
+ * \brief Decoded compact payload.
+ *******************************************************************/
+typedef struct {
+    sfx_u8 nb_access_points; // 3 or 4 (0 if the payload is not a compact payload).
+    sfx_u8 nb_nic_bits; // Number of NIC bits kept in the keys.
+    SIGFOX_EP_ADDON_AW_API_compact_access_point_t access_point[SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS_MAX];
+} SIGFOX_EP_ADDON_AW_API_decoded_compact_payload_t;
+#endif
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_STREAM
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_AW_API_stream_candidate_t
+ * \brief Access point selected by a stream.
+ *******************************************************************/
+typedef struct {
+    sfx_u8 mac_address_bytes[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES];
+    sfx_s16 rssi_dbm;
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+    sfx_u8 age; // Number of payloads since the access point has been sent (recent candidates only).
+#endif
+} SIGFOX_EP_ADDON_AW_API_stream_candidate_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_AW_API_stream_t
+ * \brief Sigfox EP ADDON AW stream structure (constant size whatever the number of access points).
+ * \note  The stream is owned by the caller and its fields must only be accessed through the addon functions.
+ *******************************************************************/
+typedef struct {
+    SIGFOX_EP_ADDON_AW_API_context_t *context;
+    SIGFOX_EP_ADDON_AW_API_access_point_t record; // Access point being parsed.
+    sfx_u8 parser_state;
+    sfx_u8 parser_flags;
+    sfx_u8 field_idx;
+    sfx_u8 char_idx;
+    SIGFOX_EP_ADDON_AW_API_stream_candidate_t candidate[SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD];
+    sfx_u8 nb_candidates;
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+    SIGFOX_EP_ADDON_AW_API_stream_candidate_t recent_candidate[SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD]; // Recent access points completing the payload.
+    sfx_u8 nb_recent_candidates;
+#endif
+} SIGFOX_EP_ADDON_AW_API_stream_t;
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_ASYNC
+/*!******************************************************************
+ * \brief Async process request callback, which can be called under interrupt: @ref SIGFOX_EP_ADDON_AW_API_async_process must then be called from the main loop.
+ *******************************************************************/
+typedef void (*SIGFOX_EP_ADDON_AW_API_async_process_cb_t)(void);
+
+/*!******************************************************************
+ * \brief Async scan completion callback, giving the number of MAC addresses of the payload built from the scan (0 when no payload will be sent). A new scan can be started from this callback.
+ *******************************************************************/
+typedef void (*SIGFOX_EP_ADDON_AW_API_async_scan_cpl_cb_t)(sfx_u8 nb_mac_ul_payload);
+
+/*!******************************************************************
+ * \brief Async send request callback: the application starts the transmission of the payload, which remains valid until @ref SIGFOX_EP_ADDON_AW_API_async_send_complete is called.
+ *******************************************************************/
+typedef void (*SIGFOX_EP_ADDON_AW_API_async_send_cb_t)(sfx_u8 *ul_payload, sfx_u8 nb_mac_ul_payload);
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_AW_API_async_callbacks_t
+ * \brief Sigfox EP ADDON AW async layer callbacks.
+ *******************************************************************/
+typedef struct {
+    SIGFOX_EP_ADDON_AW_API_async_process_cb_t process_cb; // Optional (SIGFOX_NULL when the main loop calls the process function periodically).
+    SIGFOX_EP_ADDON_AW_API_async_scan_cpl_cb_t scan_cpl_cb; // Optional.
+    SIGFOX_EP_ADDON_AW_API_async_send_cb_t send_cb;
+} SIGFOX_EP_ADDON_AW_API_async_callbacks_t;
+
+/*!******************************************************************
+ * \struct SIGFOX_EP_ADDON_AW_API_async_t
+ * \brief Sigfox EP ADDON AW async layer, pipelining the scans, the payloads building and the transmissions with two payload buffers.
+ * \note  The structure is owned by the caller and its fields must only be accessed through the addon functions, except the stream which receives the access points of the current scan.
+ *******************************************************************/
+typedef struct {
+    SIGFOX_EP_ADDON_AW_API_stream_t stream; // Given to the stream functions between @ref SIGFOX_EP_ADDON_AW_API_async_scan_start and @ref SIGFOX_EP_ADDON_AW_API_async_scan_end.
+    SIGFOX_EP_ADDON_AW_API_context_t *context;
+    SIGFOX_EP_ADDON_AW_API_async_callbacks_t callbacks;
+    sfx_u8 ul_payload[SIGFOX_EP_ADDON_AW_API_ASYNC_NB_BUFFERS][SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES];
+    sfx_u8 nb_mac_ul_payload[SIGFOX_EP_ADDON_AW_API_ASYNC_NB_BUFFERS];
+    sfx_u8 buffer_state[SIGFOX_EP_ADDON_AW_API_ASYNC_NB_BUFFERS];
+    volatile sfx_u8 scan_state;
+    volatile sfx_u8 send_complete;
+} SIGFOX_EP_ADDON_AW_API_async_t;
+#endif
+
 /*** SIGFOX EP ADDON AW API functions ***/
 
 /*!******************************************************************
  * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_filter(sfx_u8 filters, SIGFOX_EP_ADDON_AW_API_sorting_t sorting)
- * \brief Configure the access points filtering function.
+ * \brief Configure the access points filtering function (filters and sorting fixed by the SIGFOX_EP_ADDON_AW_STATIC_FILTERS and SIGFOX_EP_ADDON_AW_STATIC_SORTING flags are not modified).
  * \param[in]   filters: Filters to enable (bitfield indexed on @ref SIGFOX_EP_ADDON_AW_API_filter_t)
  * \param[in]   sorting: Sorting method for the remaining access points (if none, the first are selected).
  * \param[out]  none
@@ -146,6 +556,599 @@ SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_filter(sfx_u8 filters
  *******************************************************************/
 SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_build_ul_payload(SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload);
 
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST))
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_ssid_black_list(const SIGFOX_EP_ADDON_AW_API_ssid_black_list_t *ssid_black_list)
+ * \brief Select the SSID black list used by the @ref SIGFOX_EP_ADDON_AW_API_FILTER_SSID_BLACK_LIST filter.
+ * \param[in]   ssid_black_list: Pointer to the compiled black list, which must remain valid while used (SIGFOX_NULL to select the default list).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_ssid_black_list(const SIGFOX_EP_ADDON_AW_API_ssid_black_list_t *ssid_black_list);
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_RSSI_MIN))
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_rssi_min(sfx_s16 rssi_min_dbm)
+ * \brief Set the threshold of the @ref SIGFOX_EP_ADDON_AW_API_FILTER_RSSI_MIN filter.
+ * \param[in]   rssi_min_dbm: Access points with a lower RSSI are filtered out.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_rssi_min(sfx_s16 rssi_min_dbm);
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST))
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_oui_black_list(const SIGFOX_EP_ADDON_AW_API_oui_table_t *oui_black_list)
+ * \brief Select the OUI black list used by the @ref SIGFOX_EP_ADDON_AW_API_FILTER_OUI_BLACK_LIST filter.
+ * \param[in]   oui_black_list: Pointer to the black list, which must remain valid while used (SIGFOX_NULL to select an empty list).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_oui_black_list(const SIGFOX_EP_ADDON_AW_API_oui_table_t *oui_black_list);
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST))
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_compile_ssid_black_list(const sfx_u8 * const *word_list, sfx_u8 word_list_size, sfx_u8 *buffer, sfx_u16 buffer_size, SIGFOX_EP_ADDON_AW_API_ssid_black_list_t *ssid_black_list)
+ * \brief Compile a list of words into an SSID black list automaton (case insensitive substring matching).
+ * \brief The required buffer size is given by @ref SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_BUFFER_SIZE, where nb_chars is the total number of characters of all words and nb_classes the number of distinct characters (case insensitive).
+ * \param[in]   word_list: Array of null-terminated ASCII words (at most 32 characters each, and 254 characters in total).
+ * \param[in]   word_list_size: Number of words.
+ * \param[in]   buffer: Caller-owned buffer storing the automaton tables (must remain valid while the black list is used).
+ * \param[in]   buffer_size: Size of the buffer in bytes.
+ * \param[out]  ssid_black_list: Pointer to the compiled black list (empty list in case of error).
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_compile_ssid_black_list(const sfx_u8 * const *word_list, sfx_u8 word_list_size, sfx_u8 *buffer, sfx_u16 buffer_size, SIGFOX_EP_ADDON_AW_API_ssid_black_list_t *ssid_black_list);
+#endif
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_drain_init(SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, SIGFOX_EP_ADDON_AW_API_index_t *index_buffer, SIGFOX_EP_ADDON_AW_API_index_t index_buffer_size)
+ * \brief Filter and rank an access points list once, in order to build several payloads with @ref SIGFOX_EP_ADDON_AW_API_drain_next.
+ * \param[in]   input_data: Pointer to the input data from WiFi module (must remain valid until the end of the drain).
+ * \param[in]   index_buffer: Caller-owned buffer storing the ranked access points indexes (must remain valid until the end of the drain).
+ * \param[in]   index_buffer_size: Size of the index buffer, which gives the maximum number of access points to drain (2 per payload).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_drain_init(SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, SIGFOX_EP_ADDON_AW_API_index_t *index_buffer, SIGFOX_EP_ADDON_AW_API_index_t index_buffer_size);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_drain_next(sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload)
+ * \brief Build the next Sigfox Atlas WiFi payload from the list given to @ref SIGFOX_EP_ADDON_AW_API_drain_init, without filtering or sorting it again.
+ * \param[in]   none
+ * \param[out]  ul_payload: Pointer to the built 12-bytes uplink payload.
+ * \param[out]  nb_mac_ul_payload: Pointer to the effective number of valid MAC addresses used in the payload (0, 1 or 2).
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_drain_next(sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload);
+
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_timestamp_callback(SIGFOX_EP_ADDON_AW_API_timestamp_cb_t timestamp_cb)
+ * \brief Register the timestamp callback called at each payload building stage boundary, and reset the stages totals.
+ * \param[in]   timestamp_cb: Timestamp callback (SIGFOX_NULL to disable the measurements).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_timestamp_callback(SIGFOX_EP_ADDON_AW_API_timestamp_cb_t timestamp_cb);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_get_timing(SIGFOX_EP_ADDON_AW_API_timing_t *timing)
+ * \brief Read and reset the time spent in each payload building stage.
+ * \param[in]   none
+ * \param[out]  timing: Pointer to the stages totals accumulated since the previous call.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_get_timing(SIGFOX_EP_ADDON_AW_API_timing_t *timing);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_STATISTICS
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_get_statistics(SIGFOX_EP_ADDON_AW_API_statistics_t *statistics)
+ * \brief Read and reset the access points filtering statistics.
+ * \param[in]   none
+ * \param[out]  statistics: Pointer to the statistics accumulated since the previous call.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_get_statistics(SIGFOX_EP_ADDON_AW_API_statistics_t *statistics);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_PACKED_INPUT
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_pack_access_point(sfx_u8 *mac_address, sfx_u8 *ssid, sfx_s16 rssi_dbm, SIGFOX_EP_ADDON_AW_API_packed_access_point_t *packed_access_point)
+ * \brief Convert an access point reported by the WiFi module into the packed format (status NEW).
+ * \brief The SSID black list is evaluated with the list selected at this time.
+ * \param[in]   mac_address: MAC address in ASCII format ("xx:xx:xx:xx:xx:xx").
+ * \param[in]   ssid: SSID (null-terminated if shorter than 32 characters, SIGFOX_NULL if unknown).
+ * \param[in]   rssi_dbm: RSSI in dBm (saturated to the signed 8-bit range).
+ * \param[out]  packed_access_point: Pointer to the packed access point.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_pack_access_point(sfx_u8 *mac_address, sfx_u8 *ssid, sfx_s16 rssi_dbm, SIGFOX_EP_ADDON_AW_API_packed_access_point_t *packed_access_point);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_build_ul_payload_packed(SIGFOX_EP_ADDON_AW_API_packed_input_data_t *packed_input_data, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload)
+ * \brief Build a Sigfox Atlas WiFi payload from a packed access points array.
+ * \param[in]   packed_input_data: Pointer to the packed input data.
+ * \param[out]  ul_payload: Pointer to the built 12-bytes uplink payload (to send with Sigfox EP library to perform Atlas WiFi geolocation).
+ * \param[out]  nb_mac_ul_payload: Pointer to the effective number of valid MAC addresses used in the payload (0, 1 or 2).
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_build_ul_payload_packed(SIGFOX_EP_ADDON_AW_API_packed_input_data_t *packed_input_data, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_STREAM
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_stream_init(SIGFOX_EP_ADDON_AW_API_stream_t *stream)
+ * \brief Start a new stream of access points, filtered and sorted with the configuration of the default context.
+ * \param[in]   stream: Pointer to the caller-owned stream.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_stream_init(SIGFOX_EP_ADDON_AW_API_stream_t *stream);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_stream_add_record(SIGFOX_EP_ADDON_AW_API_stream_t *stream, sfx_u8 *mac_address, sfx_u8 *ssid, sfx_s16 rssi_dbm)
+ * \brief Filter an access point reported by the WiFi module and keep it if it is one of the best ones of the stream.
+ * \param[in]   stream: Pointer to the stream initialized with @ref SIGFOX_EP_ADDON_AW_API_stream_init.
+ * \param[in]   mac_address: MAC address in ASCII format ("xx:xx:xx:xx:xx:xx").
+ * \param[in]   ssid: SSID (null-terminated if shorter than 32 characters, SIGFOX_NULL if unknown).
+ * \param[in]   rssi_dbm: RSSI in dBm.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_stream_add_record(SIGFOX_EP_ADDON_AW_API_stream_t *stream, sfx_u8 *mac_address, sfx_u8 *ssid, sfx_s16 rssi_dbm);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_stream_push(SIGFOX_EP_ADDON_AW_API_stream_t *stream, SIGFOX_EP_ADDON_AW_API_access_point_t *access_point)
+ * \brief Filter an access point structure and keep it if it is one of the best ones of the stream.
+ * \brief The access point is not referenced by the stream: it can be reused or released as soon as the function returns.
+ * \param[in]   stream: Pointer to the stream initialized with @ref SIGFOX_EP_ADDON_AW_API_stream_init.
+ * \param[in]   access_point: Pointer to the access point (only processed if its status is @ref SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_NEW).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_stream_push(SIGFOX_EP_ADDON_AW_API_stream_t *stream, SIGFOX_EP_ADDON_AW_API_access_point_t *access_point);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_stream_parse_cwlap(SIGFOX_EP_ADDON_AW_API_stream_t *stream, const sfx_u8 *chunk, sfx_u32 chunk_size)
+ * \brief Parse a chunk of ESP-AT scan output (+CWLAP:(<ecn>,"<ssid>",<rssi>,"<mac>",...) lines), which can be cut anywhere.
+ * \brief Each complete record is given to @ref SIGFOX_EP_ADDON_AW_API_stream_add_record, the other lines and the malformed records are ignored.
+ * \param[in]   stream: Pointer to the stream initialized with @ref SIGFOX_EP_ADDON_AW_API_stream_init.
+ * \param[in]   chunk: Received characters.
+ * \param[in]   chunk_size: Number of received characters.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_stream_parse_cwlap(SIGFOX_EP_ADDON_AW_API_stream_t *stream, const sfx_u8 *chunk, sfx_u32 chunk_size);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_stream_build_ul_payload(SIGFOX_EP_ADDON_AW_API_stream_t *stream, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload)
+ * \brief Build a Sigfox Atlas WiFi payload with the best access points of the stream.
+ * \param[in]   stream: Pointer to the stream initialized with @ref SIGFOX_EP_ADDON_AW_API_stream_init.
+ * \param[out]  ul_payload: Pointer to the built 12-bytes uplink payload (to send with Sigfox EP library to perform Atlas WiFi geolocation).
+ * \param[out]  nb_mac_ul_payload: Pointer to the effective number of valid MAC addresses used in the payload (0, 1 or 2).
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_stream_build_ul_payload(SIGFOX_EP_ADDON_AW_API_stream_t *stream, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_compact_dictionary(const SIGFOX_EP_ADDON_AW_API_oui_table_t *compact_dictionary)
+ * \brief Select the OUI dictionary of the compact payloads (the backend must decode the payloads with the same dictionary).
+ * \param[in]   compact_dictionary: Pointer to the dictionary (up to 63 OUIs), which must remain valid while used (SIGFOX_NULL to select an empty dictionary).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_compact_dictionary(const SIGFOX_EP_ADDON_AW_API_oui_table_t *compact_dictionary);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_build_ul_payload_compact(SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, sfx_u8 *ul_payload, sfx_u8 *nb_access_points_ul_payload)
+ * \brief Build a compact custom payload carrying 3 or 4 truncated MAC addresses with their RSSI.
+ * \brief A standard Atlas WiFi payload is built instead when less than 3 access points are valid.
+ * \param[in]   input_data: Pointer to the input data from WiFi module.
+ * \param[out]  ul_payload: Pointer to the built 12-bytes uplink payload.
+ * \param[out]  nb_access_points_ul_payload: Pointer to the effective number of access points used in the payload (0, 1 or 2 for an Atlas WiFi payload, 3 or 4 for a compact payload).
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_build_ul_payload_compact(SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, sfx_u8 *ul_payload, sfx_u8 *nb_access_points_ul_payload);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_ASYNC
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_async_init(SIGFOX_EP_ADDON_AW_API_async_t *async, SIGFOX_EP_ADDON_AW_API_async_callbacks_t *callbacks)
+ * \brief Initialize an async layer, filtering and sorting the access points with the configuration of the default context.
+ * \param[in]   async: Pointer to the caller-owned async layer.
+ * \param[in]   callbacks: Pointer to the callbacks (copied in the async layer).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_async_init(SIGFOX_EP_ADDON_AW_API_async_t *async, SIGFOX_EP_ADDON_AW_API_async_callbacks_t *callbacks);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_async_scan_start(SIGFOX_EP_ADDON_AW_API_async_t *async)
+ * \brief Start a new scan: the access points are then given to the stream of the async layer.
+ * \brief The previous scan must have been processed (@ref SIGFOX_EP_ADDON_AW_API_async_scan_cpl_cb_t called), while its payload can still be waiting or being sent.
+ * \param[in]   async: Pointer to the async layer initialized with @ref SIGFOX_EP_ADDON_AW_API_async_init.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_async_scan_start(SIGFOX_EP_ADDON_AW_API_async_t *async);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_async_scan_end(SIGFOX_EP_ADDON_AW_API_async_t *async)
+ * \brief Signal the end of the current scan (can be called under interrupt). The payload is built by the next process call.
+ * \param[in]   async: Pointer to the async layer initialized with @ref SIGFOX_EP_ADDON_AW_API_async_init.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_async_scan_end(SIGFOX_EP_ADDON_AW_API_async_t *async);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_async_send_complete(SIGFOX_EP_ADDON_AW_API_async_t *async)
+ * \brief Signal the end of the transmission requested by @ref SIGFOX_EP_ADDON_AW_API_async_send_cb_t, typically from the message completion callback of the library (can be called under interrupt).
+ * \param[in]   async: Pointer to the async layer initialized with @ref SIGFOX_EP_ADDON_AW_API_async_init.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_async_send_complete(SIGFOX_EP_ADDON_AW_API_async_t *async);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_async_process(SIGFOX_EP_ADDON_AW_API_async_t *async)
+ * \brief Process the async layer events: release the sent payload, build the payload of the completed scan and request the transmission of the next payload.
+ * \brief The callbacks are called from this function, which must not be called under interrupt.
+ * \param[in]   async: Pointer to the async layer initialized with @ref SIGFOX_EP_ADDON_AW_API_async_init.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_async_process(SIGFOX_EP_ADDON_AW_API_async_t *async);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_history_mode(SIGFOX_EP_ADDON_AW_API_history_mode_t history_mode, sfx_u8 history_age_max)
+ * \brief Configure the selection of the access points sent in the previous messages (the history content is not modified).
+ * \param[in]   history_mode: Selection of the recent access points.
+ * \param[in]   history_age_max: Number of payloads during which a sent MAC address is recent (1 to 255).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_history_mode(SIGFOX_EP_ADDON_AW_API_history_mode_t history_mode, sfx_u8 history_age_max);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_get_history(sfx_u8 *history_data)
+ * \brief Serialize the history of the sent MAC addresses, to be saved in NVM before entering sleep mode.
+ * \param[in]   none
+ * \param[out]  history_data: Buffer of SIGFOX_EP_ADDON_AW_API_HISTORY_DATA_SIZE_BYTES bytes.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_get_history(sfx_u8 *history_data);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_history(const sfx_u8 *history_data)
+ * \brief Restore the history of the sent MAC addresses saved by @ref SIGFOX_EP_ADDON_AW_API_get_history.
+ * \brief A buffer filled with 0x00 (empty history) or 0xFF (erased flash) only gives expired entries.
+ * \param[in]   history_data: Buffer of SIGFOX_EP_ADDON_AW_API_HISTORY_DATA_SIZE_BYTES bytes.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_history(const sfx_u8 *history_data);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_DECODER
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_decode_ul_payload(sfx_u8 *ul_payload, sfx_u8 ul_payload_size_bytes, SIGFOX_EP_ADDON_AW_API_decoded_payload_t *decoded_payload)
+ * \brief Classify an uplink payload and extract its MAC addresses if it is an Atlas WiFi payload.
+ * \brief Payloads which are not 12 bytes long are classified as custom data.
+ * \param[in]   ul_payload: Pointer to the uplink payload.
+ * \param[in]   ul_payload_size_bytes: Uplink payload size in bytes.
+ * \param[out]  decoded_payload: Pointer to the decoded payload.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_decode_ul_payload(sfx_u8 *ul_payload, sfx_u8 ul_payload_size_bytes, SIGFOX_EP_ADDON_AW_API_decoded_payload_t *decoded_payload);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_decode_ul_payload_batch(sfx_u8 *ul_payloads, sfx_u32 nb_ul_payloads, SIGFOX_EP_ADDON_AW_API_decoded_payload_t *decoded_payloads, SIGFOX_EP_ADDON_AW_API_decoder_summary_t *summary)
+ * \brief Decode a contiguous array of 12-bytes uplink payloads.
+ * \param[in]   ul_payloads: Pointer to the uplink payloads (nb_ul_payloads * 12 bytes).
+ * \param[in]   nb_ul_payloads: Number of uplink payloads.
+ * \param[out]  decoded_payloads: Pointer to the decoded payloads array (nb_ul_payloads elements, SIGFOX_NULL if only the summary is needed).
+ * \param[out]  summary: Pointer to the counters of the batch (SIGFOX_NULL if not needed).
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_decode_ul_payload_batch(sfx_u8 *ul_payloads, sfx_u32 nb_ul_payloads, SIGFOX_EP_ADDON_AW_API_decoded_payload_t *decoded_payloads, SIGFOX_EP_ADDON_AW_API_decoder_summary_t *summary);
+
+#ifdef SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_decode_compact_payload(sfx_u8 *ul_payload, sfx_u8 ul_payload_size_bytes, SIGFOX_EP_ADDON_AW_API_decoded_compact_payload_t *decoded_compact_payload)
+ * \brief Extract the access points keys and RSSI of a compact payload.
+ * \param[in]   ul_payload: Pointer to the uplink payload.
+ * \param[in]   ul_payload_size_bytes: Uplink payload size in bytes.
+ * \param[out]  decoded_compact_payload: Pointer to the decoded compact payload.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_decode_compact_payload(sfx_u8 *ul_payload, sfx_u8 ul_payload_size_bytes, SIGFOX_EP_ADDON_AW_API_decoded_compact_payload_t *decoded_compact_payload);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_get_compact_key(const SIGFOX_EP_ADDON_AW_API_oui_table_t *compact_dictionary, sfx_u8 *mac_address_bytes, sfx_u8 nb_nic_bits, sfx_u32 *key)
+ * \brief Compute the compact payload key of a known access point, in order to find the candidates of a decoded access point.
+ * \param[in]   compact_dictionary: Pointer to the dictionary used by the end-point (SIGFOX_NULL for an empty dictionary).
+ * \param[in]   mac_address_bytes: Pointer to the 6-bytes MAC address of the known access point.
+ * \param[in]   nb_nic_bits: Number of NIC bits given by the decoded compact payload.
+ * \param[out]  key: Pointer to the key of the access point.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_get_compact_key(const SIGFOX_EP_ADDON_AW_API_oui_table_t *compact_dictionary, sfx_u8 *mac_address_bytes, sfx_u8 nb_nic_bits, sfx_u32 *key);
+#endif
+#endif
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_init_context(SIGFOX_EP_ADDON_AW_API_context_t *context)
+ * \brief Initialize a caller-owned context with the default configuration (no optional filter, no sorting, default SSID black list).
+ * \brief This function must be called before any other function using the context.
+ * \param[in]   context: Pointer to the context to initialize.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_init_context(SIGFOX_EP_ADDON_AW_API_context_t *context);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_filter_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_u8 filters, SIGFOX_EP_ADDON_AW_API_sorting_t sorting)
+ * \brief Configure the access points filtering function of a caller-owned context.
+ * \param[in]   context: Pointer to the context initialized with @ref SIGFOX_EP_ADDON_AW_API_init_context.
+ * \param[in]   filters: Filters to enable (bitfield indexed on @ref SIGFOX_EP_ADDON_AW_API_filter_t)
+ * \param[in]   sorting: Sorting method for the remaining access points (if none, the first are selected).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_filter_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_u8 filters, SIGFOX_EP_ADDON_AW_API_sorting_t sorting);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_drain_init_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, SIGFOX_EP_ADDON_AW_API_index_t *index_buffer, SIGFOX_EP_ADDON_AW_API_index_t index_buffer_size)
+ * \brief Filter and rank an access points list once with a caller-owned context, in order to build several payloads with @ref SIGFOX_EP_ADDON_AW_API_drain_next_ctx.
+ * \param[in]   context: Pointer to the context initialized with @ref SIGFOX_EP_ADDON_AW_API_init_context.
+ * \param[in]   input_data: Pointer to the input data from WiFi module (must remain valid until the end of the drain).
+ * \param[in]   index_buffer: Caller-owned buffer storing the ranked access points indexes (must remain valid until the end of the drain).
+ * \param[in]   index_buffer_size: Size of the index buffer, which gives the maximum number of access points to drain (2 per payload).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_drain_init_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, SIGFOX_EP_ADDON_AW_API_index_t *index_buffer, SIGFOX_EP_ADDON_AW_API_index_t index_buffer_size);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_drain_next_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload)
+ * \brief Build the next Sigfox Atlas WiFi payload from the list given to @ref SIGFOX_EP_ADDON_AW_API_drain_init_ctx, without filtering or sorting it again.
+ * \param[in]   context: Pointer to the context used for @ref SIGFOX_EP_ADDON_AW_API_drain_init_ctx.
+ * \param[out]  ul_payload: Pointer to the built 12-bytes uplink payload.
+ * \param[out]  nb_mac_ul_payload: Pointer to the effective number of valid MAC addresses used in the payload (0, 1 or 2).
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_drain_next_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload);
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST))
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_ssid_black_list_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, const SIGFOX_EP_ADDON_AW_API_ssid_black_list_t *ssid_black_list)
+ * \brief Select the SSID black list used by the @ref SIGFOX_EP_ADDON_AW_API_FILTER_SSID_BLACK_LIST filter of a caller-owned context.
+ * \param[in]   context: Pointer to the context initialized with @ref SIGFOX_EP_ADDON_AW_API_init_context.
+ * \param[in]   ssid_black_list: Pointer to the compiled black list, which must remain valid while used (SIGFOX_NULL to select the default list).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_ssid_black_list_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, const SIGFOX_EP_ADDON_AW_API_ssid_black_list_t *ssid_black_list);
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_RSSI_MIN))
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_rssi_min_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_s16 rssi_min_dbm)
+ * \brief Set the threshold of the @ref SIGFOX_EP_ADDON_AW_API_FILTER_RSSI_MIN filter of a caller-owned context.
+ * \param[in]   context: Pointer to the context initialized with @ref SIGFOX_EP_ADDON_AW_API_init_context.
+ * \param[in]   rssi_min_dbm: Access points with a lower RSSI are filtered out.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_rssi_min_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_s16 rssi_min_dbm);
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST))
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_oui_black_list_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, const SIGFOX_EP_ADDON_AW_API_oui_table_t *oui_black_list)
+ * \brief Select the OUI black list used by the @ref SIGFOX_EP_ADDON_AW_API_FILTER_OUI_BLACK_LIST filter of a caller-owned context.
+ * \param[in]   context: Pointer to the context initialized with @ref SIGFOX_EP_ADDON_AW_API_init_context.
+ * \param[in]   oui_black_list: Pointer to the black list, which must remain valid while used (SIGFOX_NULL to select an empty list).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_oui_black_list_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, const SIGFOX_EP_ADDON_AW_API_oui_table_t *oui_black_list);
+#endif
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_build_ul_payload_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload)
+ * \brief Build a Sigfox Atlas WiFi payload using a caller-owned context.
+ * \brief Distinct contexts can be used concurrently (for example from several tasks or threads) as long as they do not share the same access points list.
+ * \param[in]   context: Pointer to the context initialized with @ref SIGFOX_EP_ADDON_AW_API_init_context.
+ * \param[in]   input_data: Pointer to the input data from WiFi module.
+ * \param[out]  ul_payload: Pointer to the built 12-bytes uplink payload (to send with Sigfox EP library to perform Atlas WiFi geolocation).
+ * \param[out]  nb_mac_ul_payload: Pointer to the effective number of valid MAC addresses used in the payload (0, 1 or 2).
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_build_ul_payload_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_build_ul_payload_batch(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data_list, sfx_u32 input_data_list_size, SIGFOX_EP_ADDON_AW_API_output_data_t *output_data_list)
+ * \brief Build one Sigfox Atlas WiFi payload for each access points list of an array.
+ * \brief An error on one list does not abort the batch: the individual status is reported in the corresponding output data (a failed list always gives 0 MAC address).
+ * \brief The array can be split into several slices processed in parallel, each of them with its own context.
+ * \param[in]   context: Pointer to the context initialized with @ref SIGFOX_EP_ADDON_AW_API_init_context.
+ * \param[in]   input_data_list: Array of input data from WiFi module.
+ * \param[in]   input_data_list_size: Number of elements in the input and output arrays.
+ * \param[out]  output_data_list: Array of built payloads, MAC addresses count and status.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_build_ul_payload_batch(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data_list, sfx_u32 input_data_list_size, SIGFOX_EP_ADDON_AW_API_output_data_t *output_data_list);
+
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_timestamp_callback_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_timestamp_cb_t timestamp_cb)
+ * \brief Register the timestamp callback of a caller-owned context, and reset its stages totals.
+ * \param[in]   context: Pointer to the context initialized with @ref SIGFOX_EP_ADDON_AW_API_init_context.
+ * \param[in]   timestamp_cb: Timestamp callback (SIGFOX_NULL to disable the measurements).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_timestamp_callback_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_timestamp_cb_t timestamp_cb);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_get_timing_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_timing_t *timing)
+ * \brief Read and reset the time spent in each payload building stage of a caller-owned context.
+ * \param[in]   context: Pointer to the context initialized with @ref SIGFOX_EP_ADDON_AW_API_init_context.
+ * \param[out]  timing: Pointer to the stages totals accumulated since the previous call.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_get_timing_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_timing_t *timing);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_STATISTICS
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_get_statistics_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_statistics_t *statistics)
+ * \brief Read and reset the access points filtering statistics of a caller-owned context.
+ * \param[in]   context: Pointer to the context initialized with @ref SIGFOX_EP_ADDON_AW_API_init_context.
+ * \param[out]  statistics: Pointer to the statistics accumulated since the previous call.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_get_statistics_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_statistics_t *statistics);
+#endif
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_aggregator_init(SIGFOX_EP_ADDON_AW_API_aggregator_t *aggregator, SIGFOX_EP_ADDON_AW_API_access_point_t *access_point_table, SIGFOX_EP_ADDON_AW_API_access_point_t **access_point_list, SIGFOX_EP_ADDON_AW_API_index_t size)
+ * \brief Initialize (or reset) a multi-scan aggregator.
+ * \param[in]   aggregator: Pointer to the aggregator to initialize.
+ * \param[in]   access_point_table: Caller-owned table storing the merged access points.
+ * \param[in]   access_point_list: Caller-owned list pointing to the merged access points (used as aggregator input data).
+ * \param[in]   size: Size of the table and of the list, which gives the maximum number of distinct access points.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_aggregator_init(SIGFOX_EP_ADDON_AW_API_aggregator_t *aggregator, SIGFOX_EP_ADDON_AW_API_access_point_t *access_point_table, SIGFOX_EP_ADDON_AW_API_access_point_t **access_point_list, SIGFOX_EP_ADDON_AW_API_index_t size);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_aggregator_add_scan(SIGFOX_EP_ADDON_AW_API_aggregator_t *aggregator, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data)
+ * \brief Merge a scan in the aggregator: the RSSI of an already known access point is averaged and its scans count is incremented.
+ * \param[in]   aggregator: Pointer to the aggregator initialized with @ref SIGFOX_EP_ADDON_AW_API_aggregator_init.
+ * \param[in]   input_data: Pointer to the input data of the scan (access points which do not fit in the aggregator table are ignored).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_aggregator_add_scan(SIGFOX_EP_ADDON_AW_API_aggregator_t *aggregator, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data);
+
+#ifdef SIGFOX_EP_ADDON_AW_PACKED_INPUT
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_pack_access_point_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_u8 *mac_address, sfx_u8 *ssid, sfx_s16 rssi_dbm, SIGFOX_EP_ADDON_AW_API_packed_access_point_t *packed_access_point)
+ * \brief Convert an access point reported by the WiFi module into the packed format, using the SSID black list of a caller-owned context.
+ * \param[in]   context: Pointer to the context initialized with @ref SIGFOX_EP_ADDON_AW_API_init_context.
+ * \param[in]   mac_address: MAC address in ASCII format ("xx:xx:xx:xx:xx:xx").
+ * \param[in]   ssid: SSID (null-terminated if shorter than 32 characters, SIGFOX_NULL if unknown).
+ * \param[in]   rssi_dbm: RSSI in dBm (saturated to the signed 8-bit range).
+ * \param[out]  packed_access_point: Pointer to the packed access point.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_pack_access_point_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_u8 *mac_address, sfx_u8 *ssid, sfx_s16 rssi_dbm, SIGFOX_EP_ADDON_AW_API_packed_access_point_t *packed_access_point);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_build_ul_payload_packed_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_packed_input_data_t *packed_input_data, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload)
+ * \brief Build a Sigfox Atlas WiFi payload from a packed access points array using a caller-owned context.
+ * \param[in]   context: Pointer to the context initialized with @ref SIGFOX_EP_ADDON_AW_API_init_context.
+ * \param[in]   packed_input_data: Pointer to the packed input data.
+ * \param[out]  ul_payload: Pointer to the built 12-bytes uplink payload (to send with Sigfox EP library to perform Atlas WiFi geolocation).
+ * \param[out]  nb_mac_ul_payload: Pointer to the effective number of valid MAC addresses used in the payload (0, 1 or 2).
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_build_ul_payload_packed_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_packed_input_data_t *packed_input_data, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_STREAM
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_stream_init_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_stream_t *stream)
+ * \brief Start a new stream of access points, filtered and sorted with the configuration of a caller-owned context.
+ * \param[in]   context: Pointer to the context initialized with @ref SIGFOX_EP_ADDON_AW_API_init_context (must remain valid until the end of the stream).
+ * \param[in]   stream: Pointer to the caller-owned stream.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_stream_init_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_stream_t *stream);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_compact_dictionary_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, const SIGFOX_EP_ADDON_AW_API_oui_table_t *compact_dictionary)
+ * \brief Select the OUI dictionary of the compact payloads built with a caller-owned context.
+ * \param[in]   context: Pointer to the context initialized with @ref SIGFOX_EP_ADDON_AW_API_init_context.
+ * \param[in]   compact_dictionary: Pointer to the dictionary (up to 63 OUIs), which must remain valid while used (SIGFOX_NULL to select an empty dictionary).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_compact_dictionary_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, const SIGFOX_EP_ADDON_AW_API_oui_table_t *compact_dictionary);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_build_ul_payload_compact_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, sfx_u8 *ul_payload, sfx_u8 *nb_access_points_ul_payload)
+ * \brief Build a compact custom payload using a caller-owned context (a standard Atlas WiFi payload is built instead when less than 3 access points are valid).
+ * \param[in]   context: Pointer to the context initialized with @ref SIGFOX_EP_ADDON_AW_API_init_context.
+ * \param[in]   input_data: Pointer to the input data from WiFi module.
+ * \param[out]  ul_payload: Pointer to the built 12-bytes uplink payload.
+ * \param[out]  nb_access_points_ul_payload: Pointer to the effective number of access points used in the payload (0, 1 or 2 for an Atlas WiFi payload, 3 or 4 for a compact payload).
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_build_ul_payload_compact_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, sfx_u8 *ul_payload, sfx_u8 *nb_access_points_ul_payload);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_ASYNC
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_async_init_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_async_t *async, SIGFOX_EP_ADDON_AW_API_async_callbacks_t *callbacks)
+ * \brief Initialize an async layer, filtering and sorting the access points with the configuration of a caller-owned context.
+ * \param[in]   context: Pointer to the context initialized with @ref SIGFOX_EP_ADDON_AW_API_init_context (must remain valid while the async layer is used).
+ * \param[in]   async: Pointer to the caller-owned async layer.
+ * \param[in]   callbacks: Pointer to the callbacks (copied in the async layer).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_async_init_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_async_t *async, SIGFOX_EP_ADDON_AW_API_async_callbacks_t *callbacks);
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_history_mode_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_history_mode_t history_mode, sfx_u8 history_age_max)
+ * \brief Configure the selection of the access points sent in the previous messages of a caller-owned context (the history content is not modified).
+ * \param[in]   context: Pointer to the context initialized with @ref SIGFOX_EP_ADDON_AW_API_init_context.
+ * \param[in]   history_mode: Selection of the recent access points.
+ * \param[in]   history_age_max: Number of payloads during which a sent MAC address is recent (1 to 255).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_history_mode_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_history_mode_t history_mode, sfx_u8 history_age_max);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_get_history_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_u8 *history_data)
+ * \brief Serialize the history of the sent MAC addresses of a caller-owned context.
+ * \param[in]   context: Pointer to the context initialized with @ref SIGFOX_EP_ADDON_AW_API_init_context.
+ * \param[out]  history_data: Buffer of SIGFOX_EP_ADDON_AW_API_HISTORY_DATA_SIZE_BYTES bytes.
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_get_history_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_u8 *history_data);
+
+/*!******************************************************************
+ * \fn SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_history_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, const sfx_u8 *history_data)
+ * \brief Restore the history of the sent MAC addresses of a caller-owned context.
+ * \param[in]   context: Pointer to the context initialized with @ref SIGFOX_EP_ADDON_AW_API_init_context.
+ * \param[in]   history_data: Buffer of SIGFOX_EP_ADDON_AW_API_HISTORY_DATA_SIZE_BYTES bytes.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_history_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, const sfx_u8 *history_data);
+#endif
+
 #if ((defined SIGFOX_EP_UL_PAYLOAD_SIZE) && (SIGFOX_EP_UL_PAYLOAD_SIZE != SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES))
 #error "12 bytes payload size must be supported to use this Atlas WiFi addon"
 #endif
@@ -0,0 +1,257 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_aw_oui_table.c
+ * \brief   Sigfox End-Point Atlas WiFi addon OUI tables generator (mobile devices vendors black list or compact payload dictionary).
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2025, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sigfox_ep_addon_aw_api.h"
+#include "sigfox_ep_addon_aw_version.h"
+
+/*** SIGFOX EP ADDON AW OUI TABLE local macros ***/
+
+#define SIGFOX_EP_ADDON_AW_OUI_TABLE_LINE_SIZE_MAX      1024
+#define SIGFOX_EP_ADDON_AW_OUI_TABLE_INITIAL_SIZE       1024
+#define SIGFOX_EP_ADDON_AW_OUI_TABLE_NB_OUIS_MAX        0xFFFF // Size of the nb_ouis field.
+#define SIGFOX_EP_ADDON_AW_OUI_TABLE_OUI_SIZE_BYTES     3
+#define SIGFOX_EP_ADDON_AW_OUI_TABLE_OUIS_PER_LINE      4
+
+/*** SIGFOX EP ADDON AW OUI TABLE local functions ***/
+
+/*******************************************************************/
+static int _hex_value(char ascii_character) {
+    if ((ascii_character >= '0') && (ascii_character <= '9')) return (ascii_character - '0');
+    if ((ascii_character >= 'a') && (ascii_character <= 'f')) return (ascii_character - 'a' + 10);
+    if ((ascii_character >= 'A') && (ascii_character <= 'F')) return (ascii_character - 'A' + 10);
+    return -1;
+}
+
+/*******************************************************************/
+static int _parse_oui(const char *text, uint32_t *oui, const char **oui_end) {
+    // Local variables.
+    char separator = '\0';
+    int high = 0;
+    int low = 0;
+    int byte_idx = 0;
+    // Accepted formats: "AA:BB:CC", "AA-BB-CC" and "AABBCC", not preceded nor followed by another hexadecimal digit.
+    (*oui) = 0;
+    for (byte_idx = 0; byte_idx < SIGFOX_EP_ADDON_AW_OUI_TABLE_OUI_SIZE_BYTES; byte_idx++) {
+        if (byte_idx == 1) {
+            if (((*text) == ':') || ((*text) == '-')) {
+                separator = (*text);
+                text++;
+            }
+        }
+        else if ((byte_idx > 1) && (separator != '\0')) {
+            if ((*text) != separator) return 1;
+            text++;
+        }
+        high = _hex_value(text[0]);
+        if (high < 0) return 1;
+        low = _hex_value(text[1]);
+        if (low < 0) return 1;
+        (*oui) = ((*oui) << 8) | (uint32_t) ((high << 4) | low);
+        text += 2;
+    }
+    // Full MAC addresses are accepted when the bytes are separated.
+    if ((_hex_value(*text) >= 0) || ((separator == '\0') && (isalnum((unsigned char) (*text)) != 0))) return 1;
+    (*oui_end) = text;
+    return 0;
+}
+
+/*******************************************************************/
+static int _find_oui(const char *line, uint32_t *oui, const char **oui_end) {
+    // Local variables.
+    const char *text = line;
+    // Use the first OUI of the line (IEEE registry CSV or text file, or one OUI per line).
+    for (text = line; (*text) != '\0'; text++) {
+        if ((text != line) && (isalnum((unsigned char) text[-1]) != 0)) continue;
+        if (_parse_oui(text, oui, oui_end) == 0) return 0;
+    }
+    return 1;
+}
+
+/*******************************************************************/
+static int _contains_ignore_case(const char *text, const char *word) {
+    // Local variables.
+    size_t word_size = strlen(word);
+    size_t idx = 0;
+    for (; (*text) != '\0'; text++) {
+        for (idx = 0; idx < word_size; idx++) {
+            if ((text[idx] == '\0') || (tolower((unsigned char) text[idx]) != tolower((unsigned char) word[idx]))) break;
+        }
+        if (idx == word_size) return 1;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+static int _compare_oui(const void *oui_1, const void *oui_2) {
+    // Local variables.
+    uint32_t value_1 = *((const uint32_t *) oui_1);
+    uint32_t value_2 = *((const uint32_t *) oui_2);
+    return (value_1 < value_2) ? -1 : ((value_1 > value_2) ? 1 : 0);
+}
+
+/*******************************************************************/
+static int _is_identifier(const char *name) {
+    // Local variables.
+    const char *character = name;
+    if ((isalpha((unsigned char) (*name)) == 0) && ((*name) != '_')) return 0;
+    for (character = name; (*character) != '\0'; character++) {
+        if ((isalnum((unsigned char) (*character)) == 0) && ((*character) != '_')) return 0;
+    }
+    return 1;
+}
+
+/*******************************************************************/
+static int _read_ouis(const char *list_path, char **vendors, int nb_vendors, uint32_t **ouis, size_t *nb_ouis) {
+    // Local variables.
+    FILE *list_file = SIGFOX_NULL;
+    char line[SIGFOX_EP_ADDON_AW_OUI_TABLE_LINE_SIZE_MAX];
+    uint32_t *new_ouis = SIGFOX_NULL;
+    size_t ouis_size = SIGFOX_EP_ADDON_AW_OUI_TABLE_INITIAL_SIZE;
+    const char *oui_end = SIGFOX_NULL;
+    uint32_t oui = 0;
+    int vendor_idx = 0;
+    int ret = 1;
+    (*nb_ouis) = 0;
+    (*ouis) = malloc(ouis_size * sizeof(uint32_t));
+    list_file = fopen(list_path, "r");
+    if (((*ouis) == SIGFOX_NULL) || (list_file == SIGFOX_NULL)) {
+        fprintf(stderr, "ERROR: cannot read %s\n", list_path);
+        goto errors;
+    }
+    while (fgets(line, sizeof(line), list_file) != SIGFOX_NULL) {
+        if (_find_oui(line, &oui, &oui_end) != 0) continue;
+        // Keep the OUI if the rest of the line (organization name) contains one of the vendors.
+        if (nb_vendors > 0) {
+            for (vendor_idx = 0; vendor_idx < nb_vendors; vendor_idx++) {
+                if (_contains_ignore_case(oui_end, vendors[vendor_idx]) != 0) break;
+            }
+            if (vendor_idx == nb_vendors) continue;
+        }
+        if ((*nb_ouis) == ouis_size) {
+            new_ouis = realloc((*ouis), 2 * ouis_size * sizeof(uint32_t));
+            if (new_ouis == SIGFOX_NULL) goto errors;
+            (*ouis) = new_ouis;
+            ouis_size *= 2;
+        }
+        (*ouis)[(*nb_ouis)++] = oui;
+    }
+    ret = 0;
+errors:
+    if (list_file != SIGFOX_NULL) fclose(list_file);
+    return ret;
+}
+
+/*******************************************************************/
+static int _write_table(const char *output_path, const char *list_path, const char *name, const uint32_t *ouis, size_t nb_ouis) {
+    // Local variables.
+    FILE *output_file = SIGFOX_NULL;
+    size_t oui_idx = 0;
+    int ret = 1;
+    output_file = fopen(output_path, "w");
+    if (output_file == SIGFOX_NULL) {
+        fprintf(stderr, "ERROR: cannot write %s\n", output_path);
+        return 1;
+    }
+    fprintf(output_file, "// Generated by sigfox_ep_addon_aw_oui_table (sigfox-ep-addon-aw %s) from %s: %lu OUIs.\n\n", SIGFOX_EP_ADDON_AW_VERSION, list_path, (unsigned long) nb_ouis);
+    fprintf(output_file, "#include \"sigfox_ep_addon_aw_api.h\"\n\n");
+    fprintf(output_file, "#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST) || (defined SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD))\n");
+    // Empty arrays are not allowed in C, an empty list keeps a single unused byte.
+    fprintf(output_file, "static const sfx_u8 %s_TABLE[] = {\n", name);
+    for (oui_idx = 0; oui_idx < nb_ouis; oui_idx++) {
+        if ((oui_idx % SIGFOX_EP_ADDON_AW_OUI_TABLE_OUIS_PER_LINE) == 0) fprintf(output_file, "   ");
+        fprintf(output_file, " 0x%02X, 0x%02X, 0x%02X,", (unsigned int) ((ouis[oui_idx] >> 16) & 0xFF), (unsigned int) ((ouis[oui_idx] >> 8) & 0xFF), (unsigned int) (ouis[oui_idx] & 0xFF));
+        if ((((oui_idx + 1) % SIGFOX_EP_ADDON_AW_OUI_TABLE_OUIS_PER_LINE) == 0) || ((oui_idx + 1) == nb_ouis)) fprintf(output_file, "\n");
+    }
+    if (nb_ouis == 0) fprintf(output_file, "    0x00,\n");
+    fprintf(output_file, "};\n\n");
+    fprintf(output_file, "const SIGFOX_EP_ADDON_AW_API_oui_table_t %s = {\n", name);
+    fprintf(output_file, "    .oui_table = %s_TABLE,\n", name);
+    fprintf(output_file, "    .nb_ouis = %lu,\n", (unsigned long) nb_ouis);
+    fprintf(output_file, "};\n");
+    fprintf(output_file, "#endif\n");
+    ret = 0;
+    if (fclose(output_file) != 0) ret = 1;
+    return ret;
+}
+
+/*** SIGFOX EP ADDON AW OUI TABLE functions ***/
+
+/*******************************************************************/
+int main(int argc, char *argv[]) {
+    // Local variables.
+    uint32_t *ouis = SIGFOX_NULL;
+    size_t nb_ouis = 0;
+    size_t read_idx = 0;
+    size_t write_idx = 0;
+    int ret = 1;
+    if (argc < 4) {
+        fprintf(stderr, "Usage:\n");
+        fprintf(stderr, "  %s <oui_list> <table.c> <name> [<vendor>...]\n", argv[0]);
+        fprintf(stderr, "  <oui_list>: IEEE registry (oui.csv or oui.txt) or one OUI per line (AA:BB:CC, AA-BB-CC or AABBCC).\n");
+        fprintf(stderr, "  <vendor>: keep the OUIs whose organization contains one of the words (case insensitive), all OUIs by default.\n");
+        return 1;
+    }
+    if (_is_identifier(argv[3]) == 0) {
+        fprintf(stderr, "ERROR: %s is not a valid C identifier\n", argv[3]);
+        return 1;
+    }
+    if (_read_ouis(argv[1], &(argv[4]), (argc - 4), &ouis, &nb_ouis) != 0) goto errors;
+    // Sort and remove the duplicates (the IEEE text file gives each OUI twice).
+    qsort(ouis, nb_ouis, sizeof(uint32_t), &_compare_oui);
+    for (read_idx = 0; read_idx < nb_ouis; read_idx++) {
+        if ((write_idx == 0) || (ouis[read_idx] != ouis[write_idx - 1])) {
+            ouis[write_idx++] = ouis[read_idx];
+        }
+    }
+    nb_ouis = write_idx;
+    if (nb_ouis > SIGFOX_EP_ADDON_AW_OUI_TABLE_NB_OUIS_MAX) {
+        fprintf(stderr, "ERROR: %lu OUIs found, the table is limited to %u\n", (unsigned long) nb_ouis, (unsigned int) SIGFOX_EP_ADDON_AW_OUI_TABLE_NB_OUIS_MAX);
+        goto errors;
+    }
+    if (_write_table(argv[2], argv[1], argv[3], ouis, nb_ouis) != 0) goto errors;
+    printf("%lu OUIs written in %s (%lu bytes of flash)\n", (unsigned long) nb_ouis, argv[2], (unsigned long) (nb_ouis * SIGFOX_EP_ADDON_AW_OUI_TABLE_OUI_SIZE_BYTES));
+    ret = 0;
+errors:
+    free(ouis);
+    return ret;
+}
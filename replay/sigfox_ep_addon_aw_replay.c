@@ -0,0 +1,950 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_aw_replay.c
+ * \brief   Sigfox End-Point Atlas WiFi addon scan archives replay tool.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2025, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sigfox_ep_addon_aw_api.h"
+#include "sigfox_ep_addon_aw_version.h"
+
+/*** SIGFOX EP ADDON AW REPLAY local macros ***/
+
+// Archive layout (little endian): header, scan records, then offsets table of the scan records (one more entry giving the end of the last record).
+#define SIGFOX_EP_ADDON_AW_REPLAY_MAGIC                 "SFAW"
+#define SIGFOX_EP_ADDON_AW_REPLAY_MAGIC_SIZE            4
+#define SIGFOX_EP_ADDON_AW_REPLAY_FORMAT_VERSION        1
+#define SIGFOX_EP_ADDON_AW_REPLAY_HEADER_SIZE           20 // Magic, format version, 3 reserved bytes, number of scans (32 bits) and offsets table position (64 bits).
+#define SIGFOX_EP_ADDON_AW_REPLAY_HEADER_NB_SCANS_INDEX     8
+#define SIGFOX_EP_ADDON_AW_REPLAY_HEADER_TABLE_OFFSET_INDEX 12
+#define SIGFOX_EP_ADDON_AW_REPLAY_OFFSET_SIZE           8
+// Scan record: number of access points (16 bits), then for each access point the MAC address, the RSSI, the SSID size and the SSID.
+#define SIGFOX_EP_ADDON_AW_REPLAY_SCAN_HEADER_SIZE      2
+#define SIGFOX_EP_ADDON_AW_REPLAY_ACCESS_POINT_SIZE_MIN (SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES + 2)
+
+#ifdef SIGFOX_EP_ADDON_AW_WIDE_INDEX
+#define SIGFOX_EP_ADDON_AW_REPLAY_LIST_SIZE_MAX         65535
+#else
+#define SIGFOX_EP_ADDON_AW_REPLAY_LIST_SIZE_MAX         255
+#endif
+#define SIGFOX_EP_ADDON_AW_REPLAY_CSV_LINE_SIZE_MAX     256
+#define SIGFOX_EP_ADDON_AW_REPLAY_OFFSETS_INITIAL_SIZE  4096
+// Number of scans processed by each thread between two writes of the results (the results are written in the archive order).
+#define SIGFOX_EP_ADDON_AW_REPLAY_BLOCK_SIZE            16384
+#define SIGFOX_EP_ADDON_AW_REPLAY_RESULT_SIZE_MAX       96
+#define SIGFOX_EP_ADDON_AW_REPLAY_THREADS_MAX           256
+#if ((defined SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD) && (defined SIGFOX_EP_ADDON_AW_DECODER))
+#define SIGFOX_EP_ADDON_AW_REPLAY_OUI_SIZE_BYTES        3
+#define SIGFOX_EP_ADDON_AW_REPLAY_COMPACT_NB_LAYOUTS    2 // 3 and 4 access points layouts.
+#endif
+
+/*** SIGFOX EP ADDON AW REPLAY local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    unsigned long nb_scans;
+    unsigned long nb_scans_corrupted;
+    unsigned long nb_scans_error; // Scans rejected with another status than success or no valid access point.
+    unsigned long nb_scans_per_nb_mac[SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD + 1];
+    unsigned long nb_access_points;
+    unsigned long nb_access_points_per_status[SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_LAST];
+#ifdef SIGFOX_EP_ADDON_AW_STATISTICS
+    unsigned long nb_reserved;
+    unsigned long nb_multicast;
+    unsigned long nb_filtered_out[SIGFOX_EP_ADDON_AW_API_FILTER_LAST];
+#endif
+} SIGFOX_EP_ADDON_AW_REPLAY_counters_t;
+
+/*******************************************************************/
+typedef struct {
+    const sfx_u8 *archive;
+    uint64_t archive_size;
+    uint64_t table_offset;
+    sfx_u32 nb_scans;
+} SIGFOX_EP_ADDON_AW_REPLAY_archive_t;
+
+/*******************************************************************/
+typedef struct {
+    pthread_t thread;
+    const SIGFOX_EP_ADDON_AW_REPLAY_archive_t *archive;
+    SIGFOX_EP_ADDON_AW_API_context_t context;
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_points;
+    SIGFOX_EP_ADDON_AW_API_access_point_t **access_point_list;
+    char *results;
+    size_t results_size;
+    sfx_u32 first_scan;
+    sfx_u32 nb_scans;
+    SIGFOX_EP_ADDON_AW_REPLAY_counters_t counters;
+} SIGFOX_EP_ADDON_AW_REPLAY_worker_t;
+
+#if ((defined SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD) && (defined SIGFOX_EP_ADDON_AW_DECODER))
+/*******************************************************************/
+typedef struct {
+    sfx_u32 oui;
+    unsigned long count; // Number of distinct access points.
+} SIGFOX_EP_ADDON_AW_REPLAY_oui_count_t;
+#endif
+
+/*** SIGFOX EP ADDON AW REPLAY local global variables ***/
+
+static const char SIGFOX_EP_ADDON_AW_REPLAY_HEX_DIGITS[] = "0123456789ABCDEF";
+
+/*** SIGFOX EP ADDON AW REPLAY local functions ***/
+
+/*******************************************************************/
+static sfx_u32 _read_u32(const sfx_u8 *data) {
+    return (((sfx_u32) data[0]) | (((sfx_u32) data[1]) << 8) | (((sfx_u32) data[2]) << 16) | (((sfx_u32) data[3]) << 24));
+}
+
+/*******************************************************************/
+static uint64_t _read_u64(const sfx_u8 *data) {
+    return (((uint64_t) _read_u32(data)) | (((uint64_t) _read_u32(&(data[4]))) << 32));
+}
+
+/*******************************************************************/
+static void _write_le(sfx_u8 *data, uint64_t value, sfx_u8 size) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    for (idx = 0; idx < size; idx++) {
+        data[idx] = (sfx_u8) ((value >> (8 * idx)) & 0xFF);
+    }
+}
+
+/*******************************************************************/
+static double _get_time_s(void) {
+    // Local variables.
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (((double) now.tv_sec) + (((double) now.tv_nsec) * 1e-9));
+}
+
+/*******************************************************************/
+static int _parse_mac_address(const char *mac_address_string, sfx_u8 *mac_address_bytes) {
+    // Local variables.
+    unsigned int value[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES];
+    sfx_u8 idx = 0;
+    if ((strlen(mac_address_string) != SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR) ||
+        (sscanf(mac_address_string, "%2x:%2x:%2x:%2x:%2x:%2x", &value[0], &value[1], &value[2], &value[3], &value[4], &value[5]) != SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES)) {
+        return 1;
+    }
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES; idx++) {
+        mac_address_bytes[idx] = (sfx_u8) value[idx];
+    }
+    return 0;
+}
+
+/*******************************************************************/
+static int _write_scan(FILE *archive_file, sfx_u8 *scan_record, size_t scan_record_size, uint64_t **offsets, sfx_u32 *nb_scans, size_t *offsets_size, uint64_t *position) {
+    // Local variables.
+    uint64_t *new_offsets = SIGFOX_NULL;
+    // Keep one more entry for the end of the last record.
+    if (((*nb_scans) + 2) > (*offsets_size)) {
+        new_offsets = realloc((*offsets), 2 * (*offsets_size) * sizeof(uint64_t));
+        if (new_offsets == SIGFOX_NULL) return 1;
+        (*offsets) = new_offsets;
+        (*offsets_size) *= 2;
+    }
+    (*offsets)[*nb_scans] = (*position);
+    if (fwrite(scan_record, 1, scan_record_size, archive_file) != scan_record_size) return 1;
+    (*position) += scan_record_size;
+    (*nb_scans)++;
+    return 0;
+}
+
+/*******************************************************************/
+static int _convert(const char *csv_path, const char *archive_path) {
+    // Local variables.
+    FILE *csv_file = SIGFOX_NULL;
+    FILE *archive_file = SIGFOX_NULL;
+    char line[SIGFOX_EP_ADDON_AW_REPLAY_CSV_LINE_SIZE_MAX];
+    char scan_id[SIGFOX_EP_ADDON_AW_REPLAY_CSV_LINE_SIZE_MAX];
+    char previous_scan_id[SIGFOX_EP_ADDON_AW_REPLAY_CSV_LINE_SIZE_MAX];
+    sfx_u8 header[SIGFOX_EP_ADDON_AW_REPLAY_HEADER_SIZE];
+    sfx_u8 offset[SIGFOX_EP_ADDON_AW_REPLAY_OFFSET_SIZE];
+    sfx_u8 *scan_record = SIGFOX_NULL;
+    size_t scan_record_size = SIGFOX_EP_ADDON_AW_REPLAY_SCAN_HEADER_SIZE;
+    uint64_t *offsets = SIGFOX_NULL;
+    size_t offsets_size = SIGFOX_EP_ADDON_AW_REPLAY_OFFSETS_INITIAL_SIZE;
+    uint64_t position = SIGFOX_EP_ADDON_AW_REPLAY_HEADER_SIZE;
+    char *mac_address_string = SIGFOX_NULL;
+    char *rssi_string = SIGFOX_NULL;
+    char *ssid = SIGFOX_NULL;
+    char *end = SIGFOX_NULL;
+    long rssi_dbm = 0;
+    size_t ssid_size = 0;
+    unsigned long line_number = 0;
+    unsigned long nb_skipped = 0;
+    unsigned long nb_dropped = 0;
+    sfx_u32 nb_access_points = 0;
+    sfx_u32 nb_scans = 0;
+    sfx_u32 idx = 0;
+    int ret = 1;
+    // Open files.
+    csv_file = fopen(csv_path, "r");
+    archive_file = fopen(archive_path, "wb");
+    // The MAC address of the next access point is decoded at the end of the record before knowing if it starts a new scan.
+    scan_record = malloc(SIGFOX_EP_ADDON_AW_REPLAY_SCAN_HEADER_SIZE + (SIGFOX_EP_ADDON_AW_REPLAY_LIST_SIZE_MAX * (SIGFOX_EP_ADDON_AW_REPLAY_ACCESS_POINT_SIZE_MIN + SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR)) + SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES);
+    offsets = malloc(offsets_size * sizeof(uint64_t));
+    if ((csv_file == SIGFOX_NULL) || (archive_file == SIGFOX_NULL) || (scan_record == SIGFOX_NULL) || (offsets == SIGFOX_NULL)) {
+        fprintf(stderr, "ERROR: cannot open %s or %s\n", csv_path, archive_path);
+        goto errors;
+    }
+    // Header is written at the end, once the number of scans is known.
+    memset(header, 0, SIGFOX_EP_ADDON_AW_REPLAY_HEADER_SIZE);
+    if (fwrite(header, 1, SIGFOX_EP_ADDON_AW_REPLAY_HEADER_SIZE, archive_file) != SIGFOX_EP_ADDON_AW_REPLAY_HEADER_SIZE) goto errors;
+    previous_scan_id[0] = '\0';
+    // One access point per line: scan_id,mac_address,rssi_dbm,ssid (the SSID is the end of the line and may contain commas).
+    while (fgets(line, sizeof(line), csv_file) != SIGFOX_NULL) {
+        line_number++;
+        line[strcspn(line, "\r\n")] = '\0';
+        if ((line[0] == '\0') || ((line_number == 1) && (strncmp(line, "scan", 4) == 0))) continue;
+        mac_address_string = strchr(line, ',');
+        rssi_string = (mac_address_string != SIGFOX_NULL) ? strchr(mac_address_string + 1, ',') : SIGFOX_NULL;
+        ssid = (rssi_string != SIGFOX_NULL) ? strchr(rssi_string + 1, ',') : SIGFOX_NULL;
+        if (ssid == SIGFOX_NULL) {
+            nb_skipped++;
+            continue;
+        }
+        (*mac_address_string++) = '\0';
+        (*rssi_string++) = '\0';
+        (*ssid++) = '\0';
+        strcpy(scan_id, line);
+        rssi_dbm = strtol(rssi_string, &end, 10);
+        if (((*end) != '\0') || (_parse_mac_address(mac_address_string, &(scan_record[scan_record_size])) != 0)) {
+            nb_skipped++;
+            continue;
+        }
+        // New scan.
+        if (strcmp(scan_id, previous_scan_id) != 0) {
+            if (nb_access_points != 0) {
+                _write_le(scan_record, nb_access_points, SIGFOX_EP_ADDON_AW_REPLAY_SCAN_HEADER_SIZE);
+                if (_write_scan(archive_file, scan_record, scan_record_size, &offsets, &nb_scans, &offsets_size, &position) != 0) goto errors;
+                // Move the access point parsed in the previous record.
+                memmove(&(scan_record[SIGFOX_EP_ADDON_AW_REPLAY_SCAN_HEADER_SIZE]), &(scan_record[scan_record_size]), SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES);
+                scan_record_size = SIGFOX_EP_ADDON_AW_REPLAY_SCAN_HEADER_SIZE;
+                nb_access_points = 0;
+            }
+            strcpy(previous_scan_id, scan_id);
+        }
+        if (nb_access_points >= SIGFOX_EP_ADDON_AW_REPLAY_LIST_SIZE_MAX) {
+            nb_dropped++;
+            continue;
+        }
+        // Access point (RSSI saturated on 8 bits and SSID truncated as done by the addon).
+        if (rssi_dbm < -128) rssi_dbm = -128;
+        if (rssi_dbm > 127) rssi_dbm = 127;
+        ssid_size = strlen(ssid);
+        if (ssid_size > SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR) {
+            ssid_size = SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR;
+        }
+        scan_record_size += SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES;
+        scan_record[scan_record_size++] = (sfx_u8) ((sfx_s8) rssi_dbm);
+        scan_record[scan_record_size++] = (sfx_u8) ssid_size;
+        memcpy(&(scan_record[scan_record_size]), ssid, ssid_size);
+        scan_record_size += ssid_size;
+        nb_access_points++;
+    }
+    if (nb_access_points != 0) {
+        _write_le(scan_record, nb_access_points, SIGFOX_EP_ADDON_AW_REPLAY_SCAN_HEADER_SIZE);
+        if (_write_scan(archive_file, scan_record, scan_record_size, &offsets, &nb_scans, &offsets_size, &position) != 0) goto errors;
+    }
+    // Offsets table.
+    offsets[nb_scans] = position;
+    for (idx = 0; idx <= nb_scans; idx++) {
+        _write_le(offset, offsets[idx], SIGFOX_EP_ADDON_AW_REPLAY_OFFSET_SIZE);
+        if (fwrite(offset, 1, SIGFOX_EP_ADDON_AW_REPLAY_OFFSET_SIZE, archive_file) != SIGFOX_EP_ADDON_AW_REPLAY_OFFSET_SIZE) goto errors;
+    }
+    // Header.
+    memcpy(header, SIGFOX_EP_ADDON_AW_REPLAY_MAGIC, SIGFOX_EP_ADDON_AW_REPLAY_MAGIC_SIZE);
+    header[SIGFOX_EP_ADDON_AW_REPLAY_MAGIC_SIZE] = SIGFOX_EP_ADDON_AW_REPLAY_FORMAT_VERSION;
+    _write_le(&(header[SIGFOX_EP_ADDON_AW_REPLAY_HEADER_NB_SCANS_INDEX]), nb_scans, 4);
+    _write_le(&(header[SIGFOX_EP_ADDON_AW_REPLAY_HEADER_TABLE_OFFSET_INDEX]), position, SIGFOX_EP_ADDON_AW_REPLAY_OFFSET_SIZE);
+    if ((fseek(archive_file, 0, SEEK_SET) != 0) || (fwrite(header, 1, SIGFOX_EP_ADDON_AW_REPLAY_HEADER_SIZE, archive_file) != SIGFOX_EP_ADDON_AW_REPLAY_HEADER_SIZE)) goto errors;
+    printf("%lu scans written in %s (%lu invalid lines skipped, %lu access points beyond %u per scan dropped)\n",
+        (unsigned long) nb_scans, archive_path, nb_skipped, nb_dropped, (unsigned int) SIGFOX_EP_ADDON_AW_REPLAY_LIST_SIZE_MAX);
+    ret = 0;
+errors:
+    if (ret != 0) {
+        fprintf(stderr, "ERROR: conversion failed\n");
+    }
+    if (csv_file != SIGFOX_NULL) fclose(csv_file);
+    if ((archive_file != SIGFOX_NULL) && (fclose(archive_file) != 0)) ret = 1;
+    free(scan_record);
+    free(offsets);
+    return ret;
+}
+
+/*******************************************************************/
+static int _open_archive(const char *archive_path, SIGFOX_EP_ADDON_AW_REPLAY_archive_t *archive) {
+    // Local variables.
+    struct stat archive_stat;
+    void *mapping = SIGFOX_NULL;
+    int fd = -1;
+    // Map the whole archive: the scans are read directly from the page cache.
+    fd = open(archive_path, O_RDONLY);
+    if ((fd < 0) || (fstat(fd, &archive_stat) != 0) || (archive_stat.st_size < SIGFOX_EP_ADDON_AW_REPLAY_HEADER_SIZE)) {
+        fprintf(stderr, "ERROR: cannot open %s\n", archive_path);
+        if (fd >= 0) close(fd);
+        return 1;
+    }
+    mapping = mmap(SIGFOX_NULL, (size_t) archive_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        fprintf(stderr, "ERROR: cannot map %s\n", archive_path);
+        return 1;
+    }
+    posix_madvise(mapping, (size_t) archive_stat.st_size, POSIX_MADV_SEQUENTIAL);
+    archive->archive = (const sfx_u8 *) mapping;
+    archive->archive_size = (uint64_t) archive_stat.st_size;
+    archive->nb_scans = _read_u32(&(archive->archive[SIGFOX_EP_ADDON_AW_REPLAY_HEADER_NB_SCANS_INDEX]));
+    archive->table_offset = _read_u64(&(archive->archive[SIGFOX_EP_ADDON_AW_REPLAY_HEADER_TABLE_OFFSET_INDEX]));
+    // Check header.
+    if ((memcmp(archive->archive, SIGFOX_EP_ADDON_AW_REPLAY_MAGIC, SIGFOX_EP_ADDON_AW_REPLAY_MAGIC_SIZE) != 0) ||
+        (archive->archive[SIGFOX_EP_ADDON_AW_REPLAY_MAGIC_SIZE] != SIGFOX_EP_ADDON_AW_REPLAY_FORMAT_VERSION) ||
+        (archive->table_offset < SIGFOX_EP_ADDON_AW_REPLAY_HEADER_SIZE) ||
+        (archive->table_offset > archive->archive_size) ||
+        (((archive->archive_size - archive->table_offset) / SIGFOX_EP_ADDON_AW_REPLAY_OFFSET_SIZE) < (((uint64_t) archive->nb_scans) + 1))) {
+        fprintf(stderr, "ERROR: %s is not a valid scan archive\n", archive_path);
+        munmap(mapping, (size_t) archive_stat.st_size);
+        return 1;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+static int _read_scan(SIGFOX_EP_ADDON_AW_REPLAY_worker_t *worker, sfx_u32 scan_idx, SIGFOX_EP_ADDON_AW_API_index_t *nb_access_points) {
+    // Local variables.
+    const SIGFOX_EP_ADDON_AW_REPLAY_archive_t *archive = (worker->archive);
+    const sfx_u8 *offset_entry = &(archive->archive[archive->table_offset + (((uint64_t) scan_idx) * SIGFOX_EP_ADDON_AW_REPLAY_OFFSET_SIZE)]);
+    uint64_t position = _read_u64(offset_entry);
+    uint64_t end = _read_u64(&(offset_entry[SIGFOX_EP_ADDON_AW_REPLAY_OFFSET_SIZE]));
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_point = SIGFOX_NULL;
+    const sfx_u8 *record = SIGFOX_NULL;
+    sfx_u32 nb_records = 0;
+    sfx_u32 idx = 0;
+    sfx_u8 byte_idx = 0;
+    sfx_u8 ssid_size = 0;
+    // Records are checked, so that a corrupted archive can not be read out of bounds.
+    if ((position < SIGFOX_EP_ADDON_AW_REPLAY_HEADER_SIZE) || (end > archive->table_offset) || (end < position) || ((end - position) < SIGFOX_EP_ADDON_AW_REPLAY_SCAN_HEADER_SIZE)) return 1;
+    record = &(archive->archive[position]);
+    nb_records = ((sfx_u32) record[0]) | (((sfx_u32) record[1]) << 8);
+    if (nb_records > SIGFOX_EP_ADDON_AW_REPLAY_LIST_SIZE_MAX) return 1;
+    position += SIGFOX_EP_ADDON_AW_REPLAY_SCAN_HEADER_SIZE;
+    for (idx = 0; idx < nb_records; idx++) {
+        if ((end - position) < SIGFOX_EP_ADDON_AW_REPLAY_ACCESS_POINT_SIZE_MIN) return 1;
+        record = &(archive->archive[position]);
+        ssid_size = record[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES + 1];
+        if ((ssid_size > SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR) || ((end - position) < (uint64_t) (SIGFOX_EP_ADDON_AW_REPLAY_ACCESS_POINT_SIZE_MIN + ssid_size))) return 1;
+        // The addon takes the MAC address in ASCII format.
+        access_point = &(worker->access_points[idx]);
+        for (byte_idx = 0; byte_idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES; byte_idx++) {
+            access_point->mac_address[3 * byte_idx] = (sfx_u8) SIGFOX_EP_ADDON_AW_REPLAY_HEX_DIGITS[record[byte_idx] >> 4];
+            access_point->mac_address[(3 * byte_idx) + 1] = (sfx_u8) SIGFOX_EP_ADDON_AW_REPLAY_HEX_DIGITS[record[byte_idx] & 0x0F];
+            if (byte_idx < (SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES - 1)) {
+                access_point->mac_address[(3 * byte_idx) + 2] = ':';
+            }
+        }
+        access_point->rssi_dbm = (sfx_s16) ((sfx_s8) record[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES]);
+        memset(access_point->ssid, 0, SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR);
+        memcpy(access_point->ssid, &(record[SIGFOX_EP_ADDON_AW_REPLAY_ACCESS_POINT_SIZE_MIN]), ssid_size);
+        access_point->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_NEW;
+        access_point->nb_scans = 1;
+        worker->access_point_list[idx] = access_point;
+        position += (SIGFOX_EP_ADDON_AW_REPLAY_ACCESS_POINT_SIZE_MIN + ssid_size);
+    }
+    (*nb_access_points) = (SIGFOX_EP_ADDON_AW_API_index_t) nb_records;
+    return 0;
+}
+
+/*******************************************************************/
+static void *_replay_block(void *argument) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_REPLAY_worker_t *worker = (SIGFOX_EP_ADDON_AW_REPLAY_worker_t *) argument;
+    SIGFOX_EP_ADDON_AW_REPLAY_counters_t *counters = &(worker->counters);
+    SIGFOX_EP_ADDON_AW_API_input_data_t input_data;
+#ifdef SIGFOX_EP_ADDON_AW_STATISTICS
+    SIGFOX_EP_ADDON_AW_API_statistics_t statistics;
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    sfx_u8 ul_payload[SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES];
+    char status_string[8];
+    char *result = (worker->results);
+    SIGFOX_EP_ADDON_AW_API_index_t nb_access_points = 0;
+    sfx_u32 scan_idx = 0;
+    sfx_u32 idx = 0;
+    sfx_u8 nb_mac_ul_payload = 0;
+    input_data.access_point_list = (worker->access_point_list);
+    for (scan_idx = (worker->first_scan); scan_idx < ((worker->first_scan) + (worker->nb_scans)); scan_idx++) {
+        counters->nb_scans++;
+        if (_read_scan(worker, scan_idx, &nb_access_points) != 0) {
+            counters->nb_scans_corrupted++;
+            result += sprintf(result, "%lu,corrupted,,,,,\n", (unsigned long) scan_idx);
+            continue;
+        }
+        // Build payload.
+        input_data.access_point_list_size = nb_access_points;
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = SIGFOX_EP_ADDON_AW_API_build_ul_payload_ctx(&(worker->context), &input_data, ul_payload, &nb_mac_ul_payload);
+        if ((status != SIGFOX_EP_ADDON_AW_API_SUCCESS) && (status != SIGFOX_EP_ADDON_AW_API_ERROR_NONE_VALID_ACCESS_POINT)) {
+            counters->nb_scans_error++;
+        }
+        sprintf(status_string, "%d", (int) status);
+#else
+        SIGFOX_EP_ADDON_AW_API_build_ul_payload_ctx(&(worker->context), &input_data, ul_payload, &nb_mac_ul_payload);
+        status_string[0] = '\0';
+#endif
+        if (nb_mac_ul_payload > SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD) {
+            nb_mac_ul_payload = 0;
+        }
+        // Update counters.
+        counters->nb_scans_per_nb_mac[nb_mac_ul_payload]++;
+        counters->nb_access_points += nb_access_points;
+        for (idx = 0; idx < nb_access_points; idx++) {
+            counters->nb_access_points_per_status[worker->access_points[idx].status]++;
+        }
+#ifdef SIGFOX_EP_ADDON_AW_STATISTICS
+        // Statistics are read after each scan, since they are 16-bits counters.
+        SIGFOX_EP_ADDON_AW_API_get_statistics_ctx(&(worker->context), &statistics);
+        counters->nb_reserved += statistics.nb_reserved;
+        counters->nb_multicast += statistics.nb_multicast;
+        for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_FILTER_LAST; idx++) {
+            counters->nb_filtered_out[idx] += statistics.nb_filtered_out[idx];
+        }
+#endif
+        // Result line.
+        result += sprintf(result, "%lu,%s,%u,%u,", (unsigned long) scan_idx, status_string, (unsigned int) nb_access_points, (unsigned int) nb_mac_ul_payload);
+        for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES; idx++) {
+            (*result++) = SIGFOX_EP_ADDON_AW_REPLAY_HEX_DIGITS[ul_payload[idx] >> 4];
+            (*result++) = SIGFOX_EP_ADDON_AW_REPLAY_HEX_DIGITS[ul_payload[idx] & 0x0F];
+        }
+        (*result++) = '\n';
+    }
+    worker->results_size = (size_t) (result - (worker->results));
+    return SIGFOX_NULL;
+}
+
+/*******************************************************************/
+static void _print_counters(const SIGFOX_EP_ADDON_AW_REPLAY_counters_t *counters, double time_s) {
+    // Local variables.
+    sfx_u32 idx = 0;
+    printf("scans: %lu (%.0f scans/s, %.3f s)\n", counters->nb_scans, (time_s > 0.0) ? (((double) counters->nb_scans) / time_s) : 0.0, time_s);
+    for (idx = 0; idx <= SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD; idx++) {
+        printf("  payloads with %u MAC address(es): %lu\n", (unsigned int) idx, counters->nb_scans_per_nb_mac[idx]);
+    }
+    printf("  other errors: %lu\n", counters->nb_scans_error);
+    printf("  corrupted records: %lu\n", counters->nb_scans_corrupted);
+    printf("access points: %lu\n", counters->nb_access_points);
+    printf("  filtered out: %lu\n", counters->nb_access_points_per_status[SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_FILTERED_OUT]);
+#ifdef SIGFOX_EP_ADDON_AW_STATISTICS
+    printf("    reserved: %lu\n", counters->nb_reserved);
+    printf("    multicast: %lu\n", counters->nb_multicast);
+    printf("    locally administered: %lu\n", counters->nb_filtered_out[SIGFOX_EP_ADDON_AW_API_FILTER_LOCALLY_ADMINISTERED]);
+    printf("    SSID empty: %lu\n", counters->nb_filtered_out[SIGFOX_EP_ADDON_AW_API_FILTER_SSID_EMPTY]);
+    printf("    SSID black list: %lu\n", counters->nb_filtered_out[SIGFOX_EP_ADDON_AW_API_FILTER_SSID_BLACK_LIST]);
+    printf("    RSSI min: %lu\n", counters->nb_filtered_out[SIGFOX_EP_ADDON_AW_API_FILTER_RSSI_MIN]);
+    printf("    OUI black list: %lu\n", counters->nb_filtered_out[SIGFOX_EP_ADDON_AW_API_FILTER_OUI_BLACK_LIST]);
+#endif
+    printf("  duplicate: %lu\n", counters->nb_access_points_per_status[SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_DUPLICATE]);
+    printf("  valid (not sent): %lu\n", counters->nb_access_points_per_status[SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID]);
+    printf("  sent: %lu\n", counters->nb_access_points_per_status[SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_SENT]);
+}
+
+/*******************************************************************/
+static int _replay(const char *archive_path, sfx_u8 filters, sfx_u8 sorting, const char *results_path, sfx_u32 nb_threads) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_REPLAY_archive_t archive;
+    SIGFOX_EP_ADDON_AW_REPLAY_worker_t *workers = SIGFOX_NULL;
+    SIGFOX_EP_ADDON_AW_REPLAY_worker_t *worker = SIGFOX_NULL;
+    SIGFOX_EP_ADDON_AW_REPLAY_counters_t counters;
+    FILE *results_file = SIGFOX_NULL;
+    unsigned long *counter = SIGFOX_NULL;
+    double start_s = 0.0;
+    sfx_u32 next_scan = 0;
+    sfx_u32 nb_active = 0;
+    sfx_u32 idx = 0;
+    size_t counter_idx = 0;
+    int ret = 1;
+    if (_open_archive(archive_path, &archive) != 0) return 1;
+    memset(&counters, 0, sizeof(counters));
+    // Results are optional: without output file, only the counters are printed.
+    if (results_path != SIGFOX_NULL) {
+        results_file = fopen(results_path, "w");
+        if (results_file == SIGFOX_NULL) {
+            fprintf(stderr, "ERROR: cannot open %s\n", results_path);
+            goto errors;
+        }
+        fprintf(results_file, "scan,status,nb_access_points,nb_mac,ul_payload\n");
+    }
+    // One context per thread.
+    workers = calloc(nb_threads, sizeof(SIGFOX_EP_ADDON_AW_REPLAY_worker_t));
+    if (workers == SIGFOX_NULL) goto errors;
+    for (idx = 0; idx < nb_threads; idx++) {
+        worker = &(workers[idx]);
+        worker->archive = &archive;
+        worker->access_points = calloc(SIGFOX_EP_ADDON_AW_REPLAY_LIST_SIZE_MAX, sizeof(SIGFOX_EP_ADDON_AW_API_access_point_t));
+        worker->access_point_list = calloc(SIGFOX_EP_ADDON_AW_REPLAY_LIST_SIZE_MAX, sizeof(SIGFOX_EP_ADDON_AW_API_access_point_t *));
+        worker->results = malloc(SIGFOX_EP_ADDON_AW_REPLAY_BLOCK_SIZE * SIGFOX_EP_ADDON_AW_REPLAY_RESULT_SIZE_MAX);
+        if ((worker->access_points == SIGFOX_NULL) || (worker->access_point_list == SIGFOX_NULL) || (worker->results == SIGFOX_NULL)) goto errors;
+        SIGFOX_EP_ADDON_AW_API_init_context(&(worker->context));
+#ifdef SIGFOX_EP_ERROR_CODES
+        if (SIGFOX_EP_ADDON_AW_API_set_filter_ctx(&(worker->context), filters, (SIGFOX_EP_ADDON_AW_API_sorting_t) sorting) != SIGFOX_EP_ADDON_AW_API_SUCCESS) {
+            fprintf(stderr, "ERROR: invalid filters or sorting\n");
+            goto errors;
+        }
+#else
+        SIGFOX_EP_ADDON_AW_API_set_filter_ctx(&(worker->context), filters, (SIGFOX_EP_ADDON_AW_API_sorting_t) sorting);
+#endif
+    }
+    start_s = _get_time_s();
+    // Each round gives one block to each thread, the results are then written in the archive order.
+    while (next_scan < archive.nb_scans) {
+        for (nb_active = 0; (nb_active < nb_threads) && (next_scan < archive.nb_scans); nb_active++) {
+            worker = &(workers[nb_active]);
+            worker->first_scan = next_scan;
+            worker->nb_scans = ((archive.nb_scans - next_scan) < SIGFOX_EP_ADDON_AW_REPLAY_BLOCK_SIZE) ? (archive.nb_scans - next_scan) : SIGFOX_EP_ADDON_AW_REPLAY_BLOCK_SIZE;
+            next_scan += (worker->nb_scans);
+            if (pthread_create(&(worker->thread), SIGFOX_NULL, &_replay_block, worker) != 0) {
+                fprintf(stderr, "ERROR: cannot create thread\n");
+                _replay_block(worker);
+                worker->thread = pthread_self();
+            }
+        }
+        for (idx = 0; idx < nb_active; idx++) {
+            worker = &(workers[idx]);
+            if (pthread_equal(worker->thread, pthread_self()) == 0) {
+                pthread_join(worker->thread, SIGFOX_NULL);
+            }
+            if ((results_file != SIGFOX_NULL) && (fwrite(worker->results, 1, worker->results_size, results_file) != worker->results_size)) {
+                fprintf(stderr, "ERROR: cannot write %s\n", results_path);
+                goto errors;
+            }
+        }
+    }
+    if ((results_file != SIGFOX_NULL) && (fflush(results_file) != 0)) goto errors;
+    // Sum the counters of all threads.
+    for (idx = 0; idx < nb_threads; idx++) {
+        counter = (unsigned long *) &(workers[idx].counters);
+        for (counter_idx = 0; counter_idx < (sizeof(SIGFOX_EP_ADDON_AW_REPLAY_counters_t) / sizeof(unsigned long)); counter_idx++) {
+            ((unsigned long *) &counters)[counter_idx] += counter[counter_idx];
+        }
+    }
+    printf("sigfox-ep-addon-aw %s replay of %s with filters %u and sorting %u on %u thread(s)\n",
+        SIGFOX_EP_ADDON_AW_VERSION, archive_path, (unsigned int) filters, (unsigned int) sorting, (unsigned int) nb_threads);
+    _print_counters(&counters, _get_time_s() - start_s);
+    ret = 0;
+errors:
+    if (workers != SIGFOX_NULL) {
+        for (idx = 0; idx < nb_threads; idx++) {
+            free(workers[idx].access_points);
+            free(workers[idx].access_point_list);
+            free(workers[idx].results);
+        }
+        free(workers);
+    }
+    if ((results_file != SIGFOX_NULL) && (fclose(results_file) != 0)) ret = 1;
+    munmap((void *) archive.archive, (size_t) archive.archive_size);
+    return ret;
+}
+
+#if ((defined SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD) && (defined SIGFOX_EP_ADDON_AW_DECODER))
+/*******************************************************************/
+static int _compare_u64(const void *a, const void *b) {
+    uint64_t value_a = *((const uint64_t *) a);
+    uint64_t value_b = *((const uint64_t *) b);
+    return ((value_a > value_b) - (value_a < value_b));
+}
+
+/*******************************************************************/
+static int _compare_u32(const void *a, const void *b) {
+    sfx_u32 value_a = *((const sfx_u32 *) a);
+    sfx_u32 value_b = *((const sfx_u32 *) b);
+    return ((value_a > value_b) - (value_a < value_b));
+}
+
+/*******************************************************************/
+static int _compare_oui_count(const void *a, const void *b) {
+    // Most frequent OUIs first.
+    const SIGFOX_EP_ADDON_AW_REPLAY_oui_count_t *oui_count_a = (const SIGFOX_EP_ADDON_AW_REPLAY_oui_count_t *) a;
+    const SIGFOX_EP_ADDON_AW_REPLAY_oui_count_t *oui_count_b = (const SIGFOX_EP_ADDON_AW_REPLAY_oui_count_t *) b;
+    if (oui_count_a->count != oui_count_b->count) return ((oui_count_a->count < oui_count_b->count) ? 1 : -1);
+    return ((oui_count_a->oui > oui_count_b->oui) - (oui_count_a->oui < oui_count_b->oui));
+}
+
+/*******************************************************************/
+static uint64_t _get_mac_address_value(const SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_u8 *mac_address_bytes) {
+    // Local variables.
+    char mac_address_string[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR + 1];
+    uint64_t value = 0;
+    sfx_u8 idx = 0;
+    // The MAC addresses have been written by the replay tool, so that they are always valid.
+    memcpy(mac_address_string, access_point->mac_address, SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR);
+    mac_address_string[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR] = '\0';
+    _parse_mac_address(mac_address_string, mac_address_bytes);
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES; idx++) {
+        value = (value << 8) | mac_address_bytes[idx];
+    }
+    return value;
+}
+
+/*******************************************************************/
+static void _get_mac_address_bytes(uint64_t value, sfx_u8 *mac_address_bytes) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES; idx++) {
+        mac_address_bytes[idx] = (sfx_u8) ((value >> (8 * (SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES - 1 - idx))) & 0xFF);
+    }
+}
+
+/*******************************************************************/
+static size_t _count_candidates(const sfx_u32 *keys, size_t nb_keys, sfx_u32 key) {
+    // Local variables.
+    size_t low = 0;
+    size_t high = nb_keys;
+    size_t middle = 0;
+    size_t nb_candidates = 0;
+    // First key greater than or equal to the decoded key.
+    while (low < high) {
+        middle = low + ((high - low) / 2);
+        if (keys[middle] < key) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+    while (((low + nb_candidates) < nb_keys) && (keys[low + nb_candidates] == key)) {
+        nb_candidates++;
+    }
+    return nb_candidates;
+}
+
+/*******************************************************************/
+static int _evaluate_compact(const char *archive_path, sfx_u8 filters, sfx_u8 sorting, sfx_u32 dictionary_size, const char *dictionary_path) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_REPLAY_archive_t archive;
+    SIGFOX_EP_ADDON_AW_REPLAY_worker_t worker;
+    SIGFOX_EP_ADDON_AW_API_input_data_t input_data;
+    SIGFOX_EP_ADDON_AW_API_oui_table_t dictionary;
+    SIGFOX_EP_ADDON_AW_API_decoded_compact_payload_t decoded_compact_payload;
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_point = SIGFOX_NULL;
+    SIGFOX_EP_ADDON_AW_REPLAY_oui_count_t *oui_counts = SIGFOX_NULL;
+    sfx_u8 dictionary_ouis[SIGFOX_EP_ADDON_AW_API_COMPACT_DICTIONARY_SIZE_MAX * SIGFOX_EP_ADDON_AW_REPLAY_OUI_SIZE_BYTES];
+    sfx_u32 dictionary_values[SIGFOX_EP_ADDON_AW_API_COMPACT_DICTIONARY_SIZE_MAX];
+    sfx_u8 ul_payload[SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES];
+    sfx_u8 mac_address_bytes[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES];
+    sfx_u32 *keys[SIGFOX_EP_ADDON_AW_REPLAY_COMPACT_NB_LAYOUTS] = {SIGFOX_NULL};
+    sfx_u8 keys_nb_nic_bits[SIGFOX_EP_ADDON_AW_REPLAY_COMPACT_NB_LAYOUTS] = {0};
+    sfx_u32 sent_keys[SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS_MAX];
+    sfx_s16 sent_rssi_dbm[SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS_MAX];
+    unsigned long nb_payloads_per_nb_access_points[SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS_MAX + 1];
+    unsigned long nb_decoding_errors = 0;
+    unsigned long nb_compact_access_points = 0;
+    unsigned long nb_ambiguous = 0;
+    unsigned long nb_candidates = 0;
+    unsigned long nb_compact_payloads = 0;
+    unsigned long nb_unambiguous_payloads = 0;
+    unsigned long nb_uplinks_atlas_wifi = 0;
+    unsigned long nb_uplinks_compact = 0;
+    unsigned long nb_dictionary_access_points = 0;
+    unsigned long rssi_error_sum = 0;
+    long rssi_error = 0;
+    long rssi_error_max = 0;
+    uint64_t *mac_addresses = SIGFOX_NULL;
+    uint64_t *new_mac_addresses = SIGFOX_NULL;
+    size_t mac_addresses_size = SIGFOX_EP_ADDON_AW_REPLAY_OFFSETS_INITIAL_SIZE;
+    size_t nb_mac_addresses = 0;
+    size_t nb_ouis = 0;
+    size_t candidates = 0;
+    size_t idx = 0;
+    FILE *dictionary_file = SIGFOX_NULL;
+    SIGFOX_EP_ADDON_AW_API_index_t nb_access_points = 0;
+    sfx_u32 scan_idx = 0;
+    sfx_u32 nb_valid = 0;
+    sfx_u8 nb_access_points_ul_payload = 0;
+    sfx_u8 nb_sent = 0;
+    sfx_u8 layout_idx = 0;
+    sfx_u8 ap_idx = 0;
+    sfx_u8 payload_ambiguous = 0;
+    int ret = 1;
+    if (dictionary_size > SIGFOX_EP_ADDON_AW_API_COMPACT_DICTIONARY_SIZE_MAX) {
+        fprintf(stderr, "ERROR: dictionary size must be lower than or equal to %u\n", (unsigned int) SIGFOX_EP_ADDON_AW_API_COMPACT_DICTIONARY_SIZE_MAX);
+        return 1;
+    }
+    if (_open_archive(archive_path, &archive) != 0) return 1;
+    memset(&worker, 0, sizeof(worker));
+    memset(nb_payloads_per_nb_access_points, 0, sizeof(nb_payloads_per_nb_access_points));
+    worker.archive = &archive;
+    worker.access_points = calloc(SIGFOX_EP_ADDON_AW_REPLAY_LIST_SIZE_MAX, sizeof(SIGFOX_EP_ADDON_AW_API_access_point_t));
+    worker.access_point_list = calloc(SIGFOX_EP_ADDON_AW_REPLAY_LIST_SIZE_MAX, sizeof(SIGFOX_EP_ADDON_AW_API_access_point_t *));
+    mac_addresses = malloc(mac_addresses_size * sizeof(uint64_t));
+    if ((worker.access_points == SIGFOX_NULL) || (worker.access_point_list == SIGFOX_NULL) || (mac_addresses == SIGFOX_NULL)) goto errors;
+    SIGFOX_EP_ADDON_AW_API_init_context(&(worker.context));
+#ifdef SIGFOX_EP_ERROR_CODES
+    if (SIGFOX_EP_ADDON_AW_API_set_filter_ctx(&(worker.context), filters, (SIGFOX_EP_ADDON_AW_API_sorting_t) sorting) != SIGFOX_EP_ADDON_AW_API_SUCCESS) {
+        fprintf(stderr, "ERROR: invalid filters or sorting\n");
+        goto errors;
+    }
+#else
+    SIGFOX_EP_ADDON_AW_API_set_filter_ctx(&(worker.context), filters, (SIGFOX_EP_ADDON_AW_API_sorting_t) sorting);
+#endif
+    input_data.access_point_list = worker.access_point_list;
+    // First pass: the distinct valid access points of the archive are used as reference database of the backend.
+    for (scan_idx = 0; scan_idx < archive.nb_scans; scan_idx++) {
+        if (_read_scan(&worker, scan_idx, &nb_access_points) != 0) continue;
+        input_data.access_point_list_size = nb_access_points;
+        SIGFOX_EP_ADDON_AW_API_build_ul_payload_compact_ctx(&(worker.context), &input_data, ul_payload, &nb_access_points_ul_payload);
+        for (idx = 0; idx < nb_access_points; idx++) {
+            access_point = &(worker.access_points[idx]);
+            if ((access_point->status != SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID) && (access_point->status != SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_SENT)) continue;
+            if (nb_mac_addresses >= mac_addresses_size) {
+                new_mac_addresses = realloc(mac_addresses, 2 * mac_addresses_size * sizeof(uint64_t));
+                if (new_mac_addresses == SIGFOX_NULL) goto errors;
+                mac_addresses = new_mac_addresses;
+                mac_addresses_size *= 2;
+            }
+            mac_addresses[nb_mac_addresses++] = _get_mac_address_value(access_point, mac_address_bytes);
+        }
+    }
+    if (nb_mac_addresses != 0) {
+        qsort(mac_addresses, nb_mac_addresses, sizeof(uint64_t), &_compare_u64);
+        for (idx = 1, candidates = 1; idx < nb_mac_addresses; idx++) {
+            if (mac_addresses[idx] != mac_addresses[candidates - 1]) {
+                mac_addresses[candidates++] = mac_addresses[idx];
+            }
+        }
+        nb_mac_addresses = candidates;
+    }
+    // Dictionary: the OUIs with the largest number of distinct access points (the MAC addresses are sorted, so that each OUI is a single run).
+    oui_counts = calloc((nb_mac_addresses != 0) ? nb_mac_addresses : 1, sizeof(SIGFOX_EP_ADDON_AW_REPLAY_oui_count_t));
+    if (oui_counts == SIGFOX_NULL) goto errors;
+    for (idx = 0; idx < nb_mac_addresses; idx++) {
+        if ((nb_ouis == 0) || (oui_counts[nb_ouis - 1].oui != (sfx_u32) (mac_addresses[idx] >> 24))) {
+            oui_counts[nb_ouis++].oui = (sfx_u32) (mac_addresses[idx] >> 24);
+        }
+        oui_counts[nb_ouis - 1].count++;
+    }
+    qsort(oui_counts, nb_ouis, sizeof(SIGFOX_EP_ADDON_AW_REPLAY_oui_count_t), &_compare_oui_count);
+    if (dictionary_size > nb_ouis) dictionary_size = (sfx_u32) nb_ouis;
+    for (idx = 0; idx < dictionary_size; idx++) {
+        dictionary_values[idx] = oui_counts[idx].oui;
+        nb_dictionary_access_points += oui_counts[idx].count;
+    }
+    qsort(dictionary_values, dictionary_size, sizeof(sfx_u32), &_compare_u32);
+    for (idx = 0; idx < dictionary_size; idx++) {
+        dictionary_ouis[(SIGFOX_EP_ADDON_AW_REPLAY_OUI_SIZE_BYTES * idx) + 0] = (sfx_u8) ((dictionary_values[idx] >> 16) & 0xFF);
+        dictionary_ouis[(SIGFOX_EP_ADDON_AW_REPLAY_OUI_SIZE_BYTES * idx) + 1] = (sfx_u8) ((dictionary_values[idx] >> 8) & 0xFF);
+        dictionary_ouis[(SIGFOX_EP_ADDON_AW_REPLAY_OUI_SIZE_BYTES * idx) + 2] = (sfx_u8) (dictionary_values[idx] & 0xFF);
+    }
+    dictionary.oui_table = dictionary_ouis;
+    dictionary.nb_ouis = (sfx_u16) dictionary_size;
+    // The dictionary can be given to the OUI table generator to be embedded in the end-point.
+    if (dictionary_path != SIGFOX_NULL) {
+        dictionary_file = fopen(dictionary_path, "w");
+        if (dictionary_file == SIGFOX_NULL) {
+            fprintf(stderr, "ERROR: cannot open %s\n", dictionary_path);
+            goto errors;
+        }
+        for (idx = 0; idx < dictionary_size; idx++) {
+            fprintf(dictionary_file, "%02X:%02X:%02X\n", (unsigned int) ((dictionary_values[idx] >> 16) & 0xFF), (unsigned int) ((dictionary_values[idx] >> 8) & 0xFF), (unsigned int) (dictionary_values[idx] & 0xFF));
+        }
+        if (fclose(dictionary_file) != 0) goto errors;
+    }
+#ifdef SIGFOX_EP_ERROR_CODES
+    if (SIGFOX_EP_ADDON_AW_API_set_compact_dictionary_ctx(&(worker.context), &dictionary) != SIGFOX_EP_ADDON_AW_API_SUCCESS) goto errors;
+#else
+    SIGFOX_EP_ADDON_AW_API_set_compact_dictionary_ctx(&(worker.context), &dictionary);
+#endif
+    // Second pass: decode the payloads and search the candidates of each decoded key in the reference database.
+    for (scan_idx = 0; scan_idx < archive.nb_scans; scan_idx++) {
+        if (_read_scan(&worker, scan_idx, &nb_access_points) != 0) continue;
+        input_data.access_point_list_size = nb_access_points;
+        nb_access_points_ul_payload = 0;
+        SIGFOX_EP_ADDON_AW_API_build_ul_payload_compact_ctx(&(worker.context), &input_data, ul_payload, &nb_access_points_ul_payload);
+        if (nb_access_points_ul_payload > SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS_MAX) {
+            nb_access_points_ul_payload = 0;
+        }
+        nb_payloads_per_nb_access_points[nb_access_points_ul_payload]++;
+        // Number of uplinks needed to send the same access points (up to the compact payload capacity) with Atlas WiFi payloads only.
+        nb_valid = 0;
+        for (idx = 0; idx < nb_access_points; idx++) {
+            access_point = &(worker.access_points[idx]);
+            if ((access_point->status == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID) || (access_point->status == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_SENT)) {
+                nb_valid++;
+            }
+        }
+        if (nb_valid > SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS) nb_valid = SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS;
+        nb_uplinks_atlas_wifi += ((nb_valid + SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD - 1) / SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD);
+        nb_uplinks_compact += (nb_access_points_ul_payload != 0) ? 1 : 0;
+        if (nb_access_points_ul_payload <= SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD) continue;
+        // Compact payload.
+        nb_compact_payloads++;
+        SIGFOX_EP_ADDON_AW_API_decode_compact_payload(ul_payload, SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES, &decoded_compact_payload);
+        if (decoded_compact_payload.nb_access_points != nb_access_points_ul_payload) {
+            nb_decoding_errors++;
+            continue;
+        }
+        // Reference keys of the layout.
+        for (layout_idx = 0; layout_idx < SIGFOX_EP_ADDON_AW_REPLAY_COMPACT_NB_LAYOUTS; layout_idx++) {
+            if ((keys[layout_idx] == SIGFOX_NULL) || (keys_nb_nic_bits[layout_idx] == decoded_compact_payload.nb_nic_bits)) break;
+        }
+        if (layout_idx >= SIGFOX_EP_ADDON_AW_REPLAY_COMPACT_NB_LAYOUTS) goto errors;
+        if (keys[layout_idx] == SIGFOX_NULL) {
+            keys[layout_idx] = malloc(((nb_mac_addresses != 0) ? nb_mac_addresses : 1) * sizeof(sfx_u32));
+            if (keys[layout_idx] == SIGFOX_NULL) goto errors;
+            keys_nb_nic_bits[layout_idx] = decoded_compact_payload.nb_nic_bits;
+            for (idx = 0; idx < nb_mac_addresses; idx++) {
+                _get_mac_address_bytes(mac_addresses[idx], mac_address_bytes);
+                SIGFOX_EP_ADDON_AW_API_get_compact_key(&dictionary, mac_address_bytes, decoded_compact_payload.nb_nic_bits, &(keys[layout_idx][idx]));
+            }
+            qsort(keys[layout_idx], nb_mac_addresses, sizeof(sfx_u32), &_compare_u32);
+        }
+        // Keys and RSSI of the sent access points.
+        nb_sent = 0;
+        for (idx = 0; (idx < nb_access_points) && (nb_sent < SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS_MAX); idx++) {
+            access_point = &(worker.access_points[idx]);
+            if (access_point->status != SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_SENT) continue;
+            _get_mac_address_value(access_point, mac_address_bytes);
+            SIGFOX_EP_ADDON_AW_API_get_compact_key(&dictionary, mac_address_bytes, decoded_compact_payload.nb_nic_bits, &(sent_keys[nb_sent]));
+            sent_rssi_dbm[nb_sent] = access_point->rssi_dbm;
+            nb_sent++;
+        }
+        payload_ambiguous = 0;
+        for (ap_idx = 0; ap_idx < decoded_compact_payload.nb_access_points; ap_idx++) {
+            for (idx = 0; idx < nb_sent; idx++) {
+                if (sent_keys[idx] == decoded_compact_payload.access_point[ap_idx].key) break;
+            }
+            if (idx >= nb_sent) {
+                nb_decoding_errors++;
+                continue;
+            }
+            nb_compact_access_points++;
+            rssi_error = (long) decoded_compact_payload.access_point[ap_idx].rssi_dbm - (long) sent_rssi_dbm[idx];
+            if (rssi_error < 0) rssi_error = -rssi_error;
+            rssi_error_sum += (unsigned long) rssi_error;
+            if (rssi_error > rssi_error_max) rssi_error_max = rssi_error;
+            candidates = _count_candidates(keys[layout_idx], nb_mac_addresses, decoded_compact_payload.access_point[ap_idx].key);
+            nb_candidates += (unsigned long) candidates;
+            if (candidates > 1) {
+                nb_ambiguous++;
+                payload_ambiguous = 1;
+            }
+        }
+        if (payload_ambiguous == 0) nb_unambiguous_payloads++;
+    }
+    printf("sigfox-ep-addon-aw %s compact payloads evaluation of %s with filters %u and sorting %u\n",
+        SIGFOX_EP_ADDON_AW_VERSION, archive_path, (unsigned int) filters, (unsigned int) sorting);
+    printf("scans: %lu\n", (unsigned long) archive.nb_scans);
+    for (idx = SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS_MAX; idx > SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD; idx--) {
+        printf("  compact payloads with %u access points: %lu\n", (unsigned int) idx, nb_payloads_per_nb_access_points[idx]);
+    }
+    for (idx = SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD; idx > 0; idx--) {
+        printf("  Atlas WiFi payloads with %u MAC address(es): %lu\n", (unsigned int) idx, nb_payloads_per_nb_access_points[idx]);
+    }
+    printf("  no valid access point: %lu\n", nb_payloads_per_nb_access_points[0]);
+    printf("  decoding errors: %lu\n", nb_decoding_errors);
+    printf("reference access points: %lu\n", (unsigned long) nb_mac_addresses);
+    printf("  dictionary: %u OUIs out of %lu (%.1f%% of the access points)\n", (unsigned int) dictionary_size, (unsigned long) nb_ouis,
+        (nb_mac_addresses != 0) ? ((100.0 * (double) nb_dictionary_access_points) / (double) nb_mac_addresses) : 0.0);
+    printf("access points sent in compact payloads: %lu\n", nb_compact_access_points);
+    printf("  ambiguous keys: %lu (%.2f%%, %.3f candidates per key)\n", nb_ambiguous,
+        (nb_compact_access_points != 0) ? ((100.0 * (double) nb_ambiguous) / (double) nb_compact_access_points) : 0.0,
+        (nb_compact_access_points != 0) ? ((double) nb_candidates / (double) nb_compact_access_points) : 0.0);
+    printf("  compact payloads without ambiguity: %lu (%.2f%%)\n", nb_unambiguous_payloads,
+        (nb_compact_payloads != 0) ? ((100.0 * (double) nb_unambiguous_payloads) / (double) nb_compact_payloads) : 0.0);
+    printf("  RSSI error: %.2f dB mean, %ld dB max\n", (nb_compact_access_points != 0) ? ((double) rssi_error_sum / (double) nb_compact_access_points) : 0.0, rssi_error_max);
+    printf("uplinks to send up to %u access points per scan: %lu with Atlas WiFi payloads, %lu with compact payloads\n",
+        (unsigned int) SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS, nb_uplinks_atlas_wifi, nb_uplinks_compact);
+    ret = 0;
+errors:
+    if (ret != 0) {
+        fprintf(stderr, "ERROR: evaluation failed\n");
+    }
+    for (layout_idx = 0; layout_idx < SIGFOX_EP_ADDON_AW_REPLAY_COMPACT_NB_LAYOUTS; layout_idx++) {
+        free(keys[layout_idx]);
+    }
+    free(oui_counts);
+    free(mac_addresses);
+    free(worker.access_points);
+    free(worker.access_point_list);
+    munmap((void *) archive.archive, (size_t) archive.archive_size);
+    return ret;
+}
+#endif
+
+/*** SIGFOX EP ADDON AW REPLAY functions ***/
+
+/*******************************************************************/
+int main(int argc, char *argv[]) {
+    // Local variables.
+    long nb_threads = 0;
+    if ((argc == 4) && (strcmp(argv[1], "convert") == 0)) {
+        return _convert(argv[2], argv[3]);
+    }
+    if ((argc >= 5) && (argc <= 7) && (strcmp(argv[1], "run") == 0)) {
+        // Use all cores by default.
+        nb_threads = (argc == 7) ? strtol(argv[6], SIGFOX_NULL, 10) : sysconf(_SC_NPROCESSORS_ONLN);
+        if (nb_threads < 1) nb_threads = 1;
+        if (nb_threads > SIGFOX_EP_ADDON_AW_REPLAY_THREADS_MAX) nb_threads = SIGFOX_EP_ADDON_AW_REPLAY_THREADS_MAX;
+        return _replay(argv[2], (sfx_u8) strtoul(argv[3], SIGFOX_NULL, 0), (sfx_u8) strtoul(argv[4], SIGFOX_NULL, 0),
+            ((argc >= 6) && (strcmp(argv[5], "-") != 0)) ? argv[5] : SIGFOX_NULL, (sfx_u32) nb_threads);
+    }
+#if ((defined SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD) && (defined SIGFOX_EP_ADDON_AW_DECODER))
+    if (((argc == 6) || (argc == 7)) && (strcmp(argv[1], "compact") == 0)) {
+        return _evaluate_compact(argv[2], (sfx_u8) strtoul(argv[3], SIGFOX_NULL, 0), (sfx_u8) strtoul(argv[4], SIGFOX_NULL, 0),
+            (sfx_u32) strtoul(argv[5], SIGFOX_NULL, 0), (argc == 7) ? argv[6] : SIGFOX_NULL);
+    }
+#endif
+    fprintf(stderr, "Usage:\n");
+    fprintf(stderr, "  %s convert <scans.csv> <archive.bin>\n", argv[0]);
+    fprintf(stderr, "  %s run <archive.bin> <filters> <sorting> [<results.csv>|-] [<nb_threads>]\n", argv[0]);
+#if ((defined SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD) && (defined SIGFOX_EP_ADDON_AW_DECODER))
+    fprintf(stderr, "  %s compact <archive.bin> <filters> <sorting> <dictionary_size> [<dictionary.txt>]\n", argv[0]);
+#endif
+    return 1;
+}
@@ -0,0 +1,377 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_aw_async_sim.c
+ * \brief   Sigfox End-Point Atlas WiFi addon async layer host simulation.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2025, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sigfox_ep_addon_aw_api.h"
+#include "sigfox_ep_addon_aw_version.h"
+
+/*** SIGFOX EP ADDON AW ASYNC SIM local macros ***/
+
+#define SIGFOX_EP_ADDON_AW_ASYNC_SIM_NB_FIXES_MAX           1000
+#define SIGFOX_EP_ADDON_AW_ASYNC_SIM_NB_ACCESS_POINTS_MAX   64
+#define SIGFOX_EP_ADDON_AW_ASYNC_SIM_NB_EVENTS_MAX          (SIGFOX_EP_ADDON_AW_ASYNC_SIM_NB_ACCESS_POINTS_MAX + 2) // Access points reports, end of scan and end of transmission.
+// Default scenario: fixes requested back-to-back, scan of all the WiFi channels and 3 repetitions of a 12-bytes frame at 100 bps.
+#define SIGFOX_EP_ADDON_AW_ASYNC_SIM_NB_FIXES_DEFAULT       10
+#define SIGFOX_EP_ADDON_AW_ASYNC_SIM_FIX_PERIOD_MS_DEFAULT  0
+#define SIGFOX_EP_ADDON_AW_ASYNC_SIM_SCAN_MS_DEFAULT        3000
+#define SIGFOX_EP_ADDON_AW_ASYNC_SIM_TX_MS_DEFAULT          7000
+#define SIGFOX_EP_ADDON_AW_ASYNC_SIM_NB_ACCESS_POINTS_DEFAULT   20
+#define SIGFOX_EP_ADDON_AW_ASYNC_SIM_RSSI_MAX_DBM           (-40)
+#define SIGFOX_EP_ADDON_AW_ASYNC_SIM_RSSI_RANGE_DB          50
+#define SIGFOX_EP_ADDON_AW_ASYNC_SIM_SEED                   0x2545F491
+#define SIGFOX_EP_ADDON_AW_ASYNC_SIM_MS_PER_HOUR            3600000.0
+
+/*** SIGFOX EP ADDON AW ASYNC SIM local structures ***/
+
+/*******************************************************************/
+typedef enum {
+    SIGFOX_EP_ADDON_AW_ASYNC_SIM_EVENT_ACCESS_POINT = 0, // Mock scanner reporting an access point.
+    SIGFOX_EP_ADDON_AW_ASYNC_SIM_EVENT_SCAN_END, // Mock scanner completion interrupt.
+    SIGFOX_EP_ADDON_AW_ASYNC_SIM_EVENT_TX_END // Mock radio message completion callback.
+} SIGFOX_EP_ADDON_AW_ASYNC_SIM_event_type_t;
+
+/*******************************************************************/
+typedef struct {
+    unsigned long time_ms;
+    SIGFOX_EP_ADDON_AW_ASYNC_SIM_event_type_t type;
+} SIGFOX_EP_ADDON_AW_ASYNC_SIM_event_t;
+
+/*******************************************************************/
+typedef struct {
+    unsigned long request_ms;
+    unsigned long scan_start_ms;
+    unsigned long scan_end_ms;
+    unsigned long tx_start_ms;
+    unsigned long tx_end_ms;
+    sfx_u8 nb_mac_ul_payload;
+} SIGFOX_EP_ADDON_AW_ASYNC_SIM_fix_t;
+
+/*******************************************************************/
+typedef struct {
+    // Scenario.
+    unsigned long nb_fixes;
+    unsigned long fix_period_ms; // 0 to request each fix as soon as the scanner is available.
+    unsigned long scan_ms;
+    unsigned long tx_ms;
+    unsigned long nb_access_points;
+    sfx_u8 pipelined;
+    // Simulation state.
+    SIGFOX_EP_ADDON_AW_API_context_t context;
+    SIGFOX_EP_ADDON_AW_API_async_t async;
+    SIGFOX_EP_ADDON_AW_ASYNC_SIM_event_t event[SIGFOX_EP_ADDON_AW_ASYNC_SIM_NB_EVENTS_MAX];
+    unsigned long nb_events;
+    unsigned long now_ms;
+    unsigned long next_fix;
+    unsigned long scan_fix;
+    unsigned long tx_fix;
+    unsigned long nb_fixes_done;
+    // Fixes whose payload is waiting or being sent, in the transmission order.
+    unsigned long tx_queue[SIGFOX_EP_ADDON_AW_API_ASYNC_NB_BUFFERS];
+    unsigned long tx_queue_head;
+    unsigned long tx_queue_size;
+    sfx_u8 scanner_busy;
+    sfx_u8 radio_busy;
+    volatile sfx_u8 process_requested;
+} SIGFOX_EP_ADDON_AW_ASYNC_SIM_state_t;
+
+/*** SIGFOX EP ADDON AW ASYNC SIM local global variables ***/
+
+static const char SIGFOX_EP_ADDON_AW_ASYNC_SIM_HEX_DIGITS[] = "0123456789ABCDEF";
+
+static sfx_u32 sigfox_ep_addon_aw_async_sim_random = SIGFOX_EP_ADDON_AW_ASYNC_SIM_SEED;
+static SIGFOX_EP_ADDON_AW_ASYNC_SIM_state_t sigfox_ep_addon_aw_async_sim;
+static SIGFOX_EP_ADDON_AW_ASYNC_SIM_fix_t sigfox_ep_addon_aw_async_sim_fixes[SIGFOX_EP_ADDON_AW_ASYNC_SIM_NB_FIXES_MAX];
+
+/*** SIGFOX EP ADDON AW ASYNC SIM local functions ***/
+
+/*******************************************************************/
+static sfx_u32 _random(void) {
+    // Xorshift generator, to get the same scans on all hosts.
+    sigfox_ep_addon_aw_async_sim_random ^= (sigfox_ep_addon_aw_async_sim_random << 13);
+    sigfox_ep_addon_aw_async_sim_random ^= (sigfox_ep_addon_aw_async_sim_random >> 17);
+    sigfox_ep_addon_aw_async_sim_random ^= (sigfox_ep_addon_aw_async_sim_random << 5);
+    return sigfox_ep_addon_aw_async_sim_random;
+}
+
+/*******************************************************************/
+static void _schedule(SIGFOX_EP_ADDON_AW_ASYNC_SIM_event_type_t type, unsigned long time_ms) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_ASYNC_SIM_state_t *sim = &sigfox_ep_addon_aw_async_sim;
+    if ((sim->nb_events) >= SIGFOX_EP_ADDON_AW_ASYNC_SIM_NB_EVENTS_MAX) {
+        fprintf(stderr, "ERROR: events queue full\n");
+        exit(1);
+    }
+    sim->event[sim->nb_events].time_ms = time_ms;
+    sim->event[sim->nb_events].type = type;
+    sim->nb_events++;
+}
+
+/*******************************************************************/
+static void _report_access_point(void) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_ASYNC_SIM_state_t *sim = &sigfox_ep_addon_aw_async_sim;
+    SIGFOX_EP_ADDON_AW_API_access_point_t access_point;
+    sfx_u32 random = 0;
+    sfx_u8 byte = 0;
+    sfx_u8 idx = 0;
+    // Random unicast and globally administered MAC address.
+    memset(&access_point, 0, sizeof(access_point));
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES; idx++) {
+        random = _random();
+        byte = (sfx_u8) (random >> 8);
+        if (idx == 0) {
+            byte &= 0xFC;
+        }
+        access_point.mac_address[3 * idx] = (sfx_u8) SIGFOX_EP_ADDON_AW_ASYNC_SIM_HEX_DIGITS[byte >> 4];
+        access_point.mac_address[(3 * idx) + 1] = (sfx_u8) SIGFOX_EP_ADDON_AW_ASYNC_SIM_HEX_DIGITS[byte & 0x0F];
+        if (idx < (SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES - 1)) {
+            access_point.mac_address[(3 * idx) + 2] = ':';
+        }
+    }
+    access_point.ssid[0] = 'a';
+    access_point.rssi_dbm = (sfx_s16) (SIGFOX_EP_ADDON_AW_ASYNC_SIM_RSSI_MAX_DBM - (sfx_s16) (_random() % SIGFOX_EP_ADDON_AW_ASYNC_SIM_RSSI_RANGE_DB));
+    access_point.status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_NEW;
+    access_point.nb_scans = 1;
+    // The access point is filtered as soon as it is reported, while the previous payload may be transmitting.
+    SIGFOX_EP_ADDON_AW_API_stream_push(&(sim->async.stream), &access_point);
+}
+
+/*******************************************************************/
+static void _process_cb(void) {
+    // Only set a flag, as done from an interrupt: the async layer is processed by the main loop.
+    sigfox_ep_addon_aw_async_sim.process_requested = 1;
+}
+
+/*******************************************************************/
+static void _scan_cpl_cb(sfx_u8 nb_mac_ul_payload) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_ASYNC_SIM_state_t *sim = &sigfox_ep_addon_aw_async_sim;
+    sigfox_ep_addon_aw_async_sim_fixes[sim->scan_fix].nb_mac_ul_payload = nb_mac_ul_payload;
+    sim->scanner_busy = 0;
+    if (nb_mac_ul_payload == 0) {
+        sim->nb_fixes_done++;
+        return;
+    }
+    sim->tx_queue[((sim->tx_queue_head) + (sim->tx_queue_size)) % SIGFOX_EP_ADDON_AW_API_ASYNC_NB_BUFFERS] = sim->scan_fix;
+    sim->tx_queue_size++;
+}
+
+/*******************************************************************/
+static void _send_cb(sfx_u8 *ul_payload, sfx_u8 nb_mac_ul_payload) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_ASYNC_SIM_state_t *sim = &sigfox_ep_addon_aw_async_sim;
+    SIGFOX_UNUSED(ul_payload);
+    SIGFOX_UNUSED(nb_mac_ul_payload);
+    // Mock radio: the transmission is started and its completion is reported later, as with the asynchronous library.
+    sim->tx_fix = sim->tx_queue[sim->tx_queue_head];
+    sim->tx_queue_head = ((sim->tx_queue_head) + 1) % SIGFOX_EP_ADDON_AW_API_ASYNC_NB_BUFFERS;
+    sim->tx_queue_size--;
+    sigfox_ep_addon_aw_async_sim_fixes[sim->tx_fix].tx_start_ms = sim->now_ms;
+    sim->radio_busy = 1;
+    _schedule(SIGFOX_EP_ADDON_AW_ASYNC_SIM_EVENT_TX_END, (sim->now_ms) + (sim->tx_ms));
+}
+
+/*******************************************************************/
+static unsigned long _get_request_ms(void) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_ASYNC_SIM_state_t *sim = &sigfox_ep_addon_aw_async_sim;
+    return ((sim->fix_period_ms) == 0) ? (sim->now_ms) : ((sim->next_fix) * (sim->fix_period_ms));
+}
+
+/*******************************************************************/
+static sfx_u8 _scanner_is_available(void) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_ASYNC_SIM_state_t *sim = &sigfox_ep_addon_aw_async_sim;
+    if (((sim->next_fix) >= (sim->nb_fixes)) || ((sim->scanner_busy) != 0)) return 0;
+    // Sequential firmware: scan, build and send, then scan again.
+    if (((sim->pipelined) == 0) && (((sim->radio_busy) != 0) || ((sim->tx_queue_size) != 0))) return 0;
+    return 1;
+}
+
+/*******************************************************************/
+static void _start_scan(void) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_ASYNC_SIM_state_t *sim = &sigfox_ep_addon_aw_async_sim;
+    SIGFOX_EP_ADDON_AW_ASYNC_SIM_fix_t *fix = SIGFOX_NULL;
+    unsigned long idx = 0;
+    if ((_scanner_is_available() == 0) || ((sim->now_ms) < _get_request_ms())) return;
+    fix = &(sigfox_ep_addon_aw_async_sim_fixes[sim->next_fix]);
+    fix->request_ms = _get_request_ms();
+    fix->scan_start_ms = sim->now_ms;
+    sim->scan_fix = sim->next_fix;
+    sim->next_fix++;
+    sim->scanner_busy = 1;
+#ifdef SIGFOX_EP_ERROR_CODES
+    if (SIGFOX_EP_ADDON_AW_API_async_scan_start(&(sim->async)) != SIGFOX_EP_ADDON_AW_API_SUCCESS) {
+        fprintf(stderr, "ERROR: scan start rejected\n");
+        exit(1);
+    }
+#else
+    SIGFOX_EP_ADDON_AW_API_async_scan_start(&(sim->async));
+#endif
+    // Mock scanner: the access points are reported during the scan.
+    for (idx = 0; idx < (sim->nb_access_points); idx++) {
+        _schedule(SIGFOX_EP_ADDON_AW_ASYNC_SIM_EVENT_ACCESS_POINT, (sim->now_ms) + (((idx + 1) * (sim->scan_ms)) / ((sim->nb_access_points) + 1)));
+    }
+    _schedule(SIGFOX_EP_ADDON_AW_ASYNC_SIM_EVENT_SCAN_END, (sim->now_ms) + (sim->scan_ms));
+}
+
+/*******************************************************************/
+static void _run(sfx_u8 pipelined) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_ASYNC_SIM_state_t *sim = &sigfox_ep_addon_aw_async_sim;
+    SIGFOX_EP_ADDON_AW_API_async_callbacks_t callbacks;
+    SIGFOX_EP_ADDON_AW_ASYNC_SIM_fix_t *fix = SIGFOX_NULL;
+    SIGFOX_EP_ADDON_AW_ASYNC_SIM_event_type_t type = SIGFOX_EP_ADDON_AW_ASYNC_SIM_EVENT_ACCESS_POINT;
+    unsigned long next_ms = 0;
+    unsigned long next_idx = 0;
+    unsigned long latency_ms = 0;
+    unsigned long latency_max_ms = 0;
+    unsigned long end_ms = 0;
+    unsigned long nb_sent = 0;
+    double latency_sum_ms = 0.0;
+    unsigned long idx = 0;
+    // Reset simulation.
+    sim->pipelined = pipelined;
+    sim->nb_events = 0;
+    sim->now_ms = 0;
+    sim->next_fix = 0;
+    sim->nb_fixes_done = 0;
+    sim->tx_queue_head = 0;
+    sim->tx_queue_size = 0;
+    sim->scanner_busy = 0;
+    sim->radio_busy = 0;
+    sim->process_requested = 0;
+    memset(sigfox_ep_addon_aw_async_sim_fixes, 0, sizeof(sigfox_ep_addon_aw_async_sim_fixes));
+    sigfox_ep_addon_aw_async_sim_random = SIGFOX_EP_ADDON_AW_ASYNC_SIM_SEED;
+    callbacks.process_cb = &_process_cb;
+    callbacks.scan_cpl_cb = &_scan_cpl_cb;
+    callbacks.send_cb = &_send_cb;
+    SIGFOX_EP_ADDON_AW_API_init_context(&(sim->context));
+    SIGFOX_EP_ADDON_AW_API_async_init_ctx(&(sim->context), &(sim->async), &callbacks);
+    // Main loop, jumping from one event to the next one.
+    while ((sim->nb_fixes_done) < (sim->nb_fixes)) {
+        _start_scan();
+        next_idx = sim->nb_events;
+        next_ms = 0;
+        for (idx = 0; idx < (sim->nb_events); idx++) {
+            if ((next_idx == (sim->nb_events)) || ((sim->event[idx].time_ms) < next_ms)) {
+                next_idx = idx;
+                next_ms = sim->event[idx].time_ms;
+            }
+        }
+        // Wake up for the next fix request.
+        if ((_scanner_is_available() != 0) && ((next_idx == (sim->nb_events)) || (_get_request_ms() < next_ms))) {
+            sim->now_ms = _get_request_ms();
+            continue;
+        }
+        if (next_idx == (sim->nb_events)) {
+            fprintf(stderr, "ERROR: simulation stalled\n");
+            exit(1);
+        }
+        sim->now_ms = next_ms;
+        type = sim->event[next_idx].type;
+        sim->nb_events--;
+        sim->event[next_idx] = sim->event[sim->nb_events];
+        // Interrupts.
+        switch (type) {
+        case SIGFOX_EP_ADDON_AW_ASYNC_SIM_EVENT_ACCESS_POINT:
+            _report_access_point();
+            break;
+        case SIGFOX_EP_ADDON_AW_ASYNC_SIM_EVENT_SCAN_END:
+            sigfox_ep_addon_aw_async_sim_fixes[sim->scan_fix].scan_end_ms = sim->now_ms;
+            SIGFOX_EP_ADDON_AW_API_async_scan_end(&(sim->async));
+            break;
+        default:
+            sigfox_ep_addon_aw_async_sim_fixes[sim->tx_fix].tx_end_ms = sim->now_ms;
+            sim->radio_busy = 0;
+            sim->nb_fixes_done++;
+            SIGFOX_EP_ADDON_AW_API_async_send_complete(&(sim->async));
+            break;
+        }
+        // Main loop processing.
+        while ((sim->process_requested) != 0) {
+            sim->process_requested = 0;
+            SIGFOX_EP_ADDON_AW_API_async_process(&(sim->async));
+        }
+    }
+    // Results.
+    printf("%s mode:\n", (pipelined != 0) ? "pipelined" : "sequential");
+    printf("fix,request_ms,scan_start_ms,scan_end_ms,tx_start_ms,tx_end_ms,nb_mac,latency_ms\n");
+    for (idx = 0; idx < (sim->nb_fixes); idx++) {
+        fix = &(sigfox_ep_addon_aw_async_sim_fixes[idx]);
+        if ((fix->nb_mac_ul_payload) == 0) {
+            printf("%lu,%lu,%lu,%lu,,,0,\n", idx, fix->request_ms, fix->scan_start_ms, fix->scan_end_ms);
+            continue;
+        }
+        latency_ms = (fix->tx_end_ms) - (fix->request_ms);
+        printf("%lu,%lu,%lu,%lu,%lu,%lu,%u,%lu\n", idx, fix->request_ms, fix->scan_start_ms, fix->scan_end_ms, fix->tx_start_ms, fix->tx_end_ms, (unsigned int) fix->nb_mac_ul_payload, latency_ms);
+        latency_sum_ms += (double) latency_ms;
+        if (latency_ms > latency_max_ms) latency_max_ms = latency_ms;
+        if ((fix->tx_end_ms) > end_ms) end_ms = fix->tx_end_ms;
+        nb_sent++;
+    }
+    printf("  latency: %.0f ms mean, %lu ms max\n", (nb_sent != 0) ? (latency_sum_ms / (double) nb_sent) : 0.0, latency_max_ms);
+    printf("  %lu fixes sent in %lu ms (%.0f fixes per hour)\n", nb_sent, end_ms, (end_ms != 0) ? ((SIGFOX_EP_ADDON_AW_ASYNC_SIM_MS_PER_HOUR * (double) nb_sent) / (double) end_ms) : 0.0);
+}
+
+/*** SIGFOX EP ADDON AW ASYNC SIM functions ***/
+
+/*******************************************************************/
+int main(int argc, char *argv[]) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_ASYNC_SIM_state_t *sim = &sigfox_ep_addon_aw_async_sim;
+    // Scenario.
+    sim->nb_fixes = (argc > 1) ? strtoul(argv[1], SIGFOX_NULL, 0) : SIGFOX_EP_ADDON_AW_ASYNC_SIM_NB_FIXES_DEFAULT;
+    sim->fix_period_ms = (argc > 2) ? strtoul(argv[2], SIGFOX_NULL, 0) : SIGFOX_EP_ADDON_AW_ASYNC_SIM_FIX_PERIOD_MS_DEFAULT;
+    sim->scan_ms = (argc > 3) ? strtoul(argv[3], SIGFOX_NULL, 0) : SIGFOX_EP_ADDON_AW_ASYNC_SIM_SCAN_MS_DEFAULT;
+    sim->tx_ms = (argc > 4) ? strtoul(argv[4], SIGFOX_NULL, 0) : SIGFOX_EP_ADDON_AW_ASYNC_SIM_TX_MS_DEFAULT;
+    sim->nb_access_points = (argc > 5) ? strtoul(argv[5], SIGFOX_NULL, 0) : SIGFOX_EP_ADDON_AW_ASYNC_SIM_NB_ACCESS_POINTS_DEFAULT;
+    if ((argc > 6) || (sim->nb_fixes == 0) || (sim->nb_fixes > SIGFOX_EP_ADDON_AW_ASYNC_SIM_NB_FIXES_MAX) || (sim->nb_access_points > SIGFOX_EP_ADDON_AW_ASYNC_SIM_NB_ACCESS_POINTS_MAX)) {
+        fprintf(stderr, "Usage: %s [<nb_fixes> [<fix_period_ms> [<scan_ms> [<tx_ms> [<nb_access_points>]]]]]\n", argv[0]);
+        fprintf(stderr, "  up to %u fixes and %u access points per scan, fix period 0 to request the fixes back-to-back\n",
+            (unsigned int) SIGFOX_EP_ADDON_AW_ASYNC_SIM_NB_FIXES_MAX, (unsigned int) SIGFOX_EP_ADDON_AW_ASYNC_SIM_NB_ACCESS_POINTS_MAX);
+        return 1;
+    }
+    printf("sigfox-ep-addon-aw %s async simulation: %lu fixes, fix period %lu ms, scan %lu ms, transmission %lu ms, %lu access points per scan\n",
+        SIGFOX_EP_ADDON_AW_VERSION, sim->nb_fixes, sim->fix_period_ms, sim->scan_ms, sim->tx_ms, sim->nb_access_points);
+    _run(0);
+    _run(1);
+    return 0;
+}
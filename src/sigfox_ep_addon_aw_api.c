@@ -40,10 +40,26 @@
 #include "sigfox_ep_flags.h"
 #endif
 #include "sigfox_types.h"
+#ifdef SIGFOX_EP_ADDON_AW_SIMD
+#if (defined __SSE2__)
+#include <emmintrin.h>
+#elif (defined __ARM_NEON)
+#include <arm_neon.h>
+#endif
+#endif
 
 /*** SIGFOX EP ADDON AW API local macros ***/
 
-#define SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES   6
+#if ((defined SIGFOX_EP_ADDON_AW_SIMD) && !(defined __SSE2__) && !(defined __ARM_NEON))
+#error "SIGFOX EP ADDON AW: SIGFOX_EP_ADDON_AW_SIMD requires a host target with SSE2 or NEON instructions"
+#endif
+
+#if ((defined SIGFOX_EP_ADDON_AW_STATIC_SORTING) && (((defined SIGFOX_EP_ADDON_AW_SORTING_NONE) + (defined SIGFOX_EP_ADDON_AW_SORTING_RSSI) + (defined SIGFOX_EP_ADDON_AW_SORTING_SCANS) + (defined SIGFOX_EP_ADDON_AW_SORTING_DEVICES)) != 1))
+#error "SIGFOX EP ADDON AW: exactly one SIGFOX_EP_ADDON_AW_SORTING_xxx flag must be defined with SIGFOX_EP_ADDON_AW_STATIC_SORTING"
+#endif
+#if ((defined SIGFOX_EP_ADDON_AW_LAZY_FILTERS) && (defined SIGFOX_EP_ADDON_AW_STATISTICS))
+#error "SIGFOX EP ADDON AW: SIGFOX_EP_ADDON_AW_LAZY_FILTERS is not compatible with SIGFOX_EP_ADDON_AW_STATISTICS (the access points which are not selected are not all evaluated)"
+#endif
 
 #define SIGFOX_EP_ADDON_AW_API_IG_BYTE_INDEX            0
 #define SIGFOX_EP_ADDON_AW_API_IG_BIT_MASK              0x01
@@ -51,136 +67,498 @@
 #define SIGFOX_EP_ADDON_AW_API_UL_BYTE_INDEX            0
 #define SIGFOX_EP_ADDON_AW_API_UL_BIT_MASK              0x02
 
-#define SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_SIZE     5
+#define SIGFOX_EP_ADDON_AW_API_DEVICE_PREFIX_SIZE_BYTES 5 // Virtual access points of a same device only differ by the last byte (and by the U/L bit).
+
+#define SIGFOX_EP_ADDON_AW_API_OUI_SIZE_BYTES           3
+
+#ifdef SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD
+#if ((SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS != 3) && (SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS != 4))
+#error "SIGFOX EP ADDON AW: SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS must be 3 or 4"
+#endif
+#define SIGFOX_EP_ADDON_AW_API_COMPACT_HEADER               ((sfx_u8) ((((SIGFOX_EP_ADDON_AW_API_COMPACT_FORMAT_ID) & 0x1F) << 3) | SIGFOX_EP_ADDON_AW_API_IG_BIT_MASK | SIGFOX_EP_ADDON_AW_API_UL_BIT_MASK))
+#define SIGFOX_EP_ADDON_AW_API_COMPACT_HEADER_SIZE_BITS     8
+#define SIGFOX_EP_ADDON_AW_API_COMPACT_LAYOUT_BIT_INDEX     2 // Layout of the access points fields (B0b2).
+#define SIGFOX_EP_ADDON_AW_API_COMPACT_NB_LAYOUTS           2
+#define SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS_MIN 3 // Below, all the access points fit in an Atlas WiFi payload.
+#define SIGFOX_EP_ADDON_AW_API_COMPACT_OUI_CODE_SIZE_BITS   6
+#define SIGFOX_EP_ADDON_AW_API_COMPACT_NB_OUI_CODES         (1 << SIGFOX_EP_ADDON_AW_API_COMPACT_OUI_CODE_SIZE_BITS)
+#define SIGFOX_EP_ADDON_AW_API_COMPACT_OUI_HASH_FACTOR      0x9E3779B1UL
+#define SIGFOX_EP_ADDON_AW_API_COMPACT_RSSI_FLOOR_DBM       (-100)
+#define SIGFOX_EP_ADDON_AW_API_COMPACT_RSSI_RANGE_SIZE_BITS 6 // 64 dB above the floor, split in 2^(RSSI bits) steps.
+#endif
+
+#define SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_NB_STATES_MAX   0xFF
+#define SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_ROOT_STATE       0
+#define SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_OTHER_CLASS      0
+
+#define SIGFOX_EP_ADDON_AW_API_BEST_INDEX_NONE          ((SIGFOX_EP_ADDON_AW_API_index_t) (~0))
 
-#define SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD        (SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES / SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES)
+#if ((SIGFOX_EP_ADDON_AW_API_DEDUPLICATION_TABLE_SIZE == 0) || ((SIGFOX_EP_ADDON_AW_API_DEDUPLICATION_TABLE_SIZE & (SIGFOX_EP_ADDON_AW_API_DEDUPLICATION_TABLE_SIZE - 1)) != 0))
+#error "SIGFOX EP ADDON AW: SIGFOX_EP_ADDON_AW_API_DEDUPLICATION_TABLE_SIZE must be a power of 2"
+#endif
+#define SIGFOX_EP_ADDON_AW_API_DEDUPLICATION_HASH_FACTOR    0x9E3779B1UL
 
-#define SIGFOX_EP_ADDON_AW_API_BEST_INDEX_NONE          0xFF
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+#if ((SIGFOX_EP_ADDON_AW_API_HISTORY_SIZE == 0) || (SIGFOX_EP_ADDON_AW_API_HISTORY_SIZE > 0xFF))
+#error "SIGFOX EP ADDON AW: SIGFOX_EP_ADDON_AW_API_HISTORY_SIZE must be between 1 and 255"
+#endif
+#define SIGFOX_EP_ADDON_AW_API_HISTORY_AGE_NONE             0
+#endif
 
 #define SIGFOX_EP_ADDON_AW_API_NULL_CHAR                '\0'
 #define SIGFOX_EP_ADDON_AW_API_MAC_BYTE_SEPARATOR_CHAR  ':'
 
 #define SIGFOX_EP_ADDON_AW_UPPERCASE_OFFSET             0x20
 
-#define SIGFOX_EP_ADDON_AW_API_S16_MIN                  (-32768)
+#ifdef SIGFOX_EP_ADDON_AW_SIMD
+#define SIGFOX_EP_ADDON_AW_API_SIMD_DIGITS_MASK         0x9249 // Lanes 0, 3, 6, 9, 12 and 15.
+#define SIGFOX_EP_ADDON_AW_API_SIMD_SEPARATORS_MASK     0x4924 // Lanes 2, 5, 8, 11 and 14.
+#endif
+
+#define SIGFOX_EP_ADDON_AW_API_SWAR_BYTES(byte)         ((sfx_u32) (0x01010101UL * ((sfx_u32) (byte))))
+#define SIGFOX_EP_ADDON_AW_API_SWAR_WORD(str, i0, i1, i2, i3) \
+    (((sfx_u32) (str)[i0] << 0) | ((sfx_u32) (str)[i1] << 8) | ((sfx_u32) (str)[i2] << 16) | ((sfx_u32) (str)[i3] << 24))
+
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+#define SIGFOX_EP_ADDON_AW_API_TIMING_START(context, timestamp)          (timestamp) = _timing_get_timestamp(context)
+#define SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, stage, timestamp)   _timing_add_stage(context, stage, &(timestamp))
+#else
+#define SIGFOX_EP_ADDON_AW_API_TIMING_START(context, timestamp)
+#define SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, stage, timestamp)
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_STATISTICS
+#define SIGFOX_EP_ADDON_AW_API_STATISTICS_INCREMENT(context, counter)        ((context)->statistics.counter)++
+#define SIGFOX_EP_ADDON_AW_API_STATISTICS_ADD_VALID(context, rssi_dbm)       _statistics_add_valid(context, rssi_dbm)
+#else
+#define SIGFOX_EP_ADDON_AW_API_STATISTICS_INCREMENT(context, counter)
+#define SIGFOX_EP_ADDON_AW_API_STATISTICS_ADD_VALID(context, rssi_dbm)
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_STATIC_FILTERS
+#ifdef SIGFOX_EP_ADDON_AW_FILTER_LOCALLY_ADMINISTERED
+#define SIGFOX_EP_ADDON_AW_API_STATIC_FILTER_LA_MASK    (1 << SIGFOX_EP_ADDON_AW_API_FILTER_LOCALLY_ADMINISTERED)
+#else
+#define SIGFOX_EP_ADDON_AW_API_STATIC_FILTER_LA_MASK    0
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_FILTER_SSID_EMPTY
+#define SIGFOX_EP_ADDON_AW_API_STATIC_FILTER_SE_MASK    (1 << SIGFOX_EP_ADDON_AW_API_FILTER_SSID_EMPTY)
+#else
+#define SIGFOX_EP_ADDON_AW_API_STATIC_FILTER_SE_MASK    0
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST
+#define SIGFOX_EP_ADDON_AW_API_STATIC_FILTER_BL_MASK    (1 << SIGFOX_EP_ADDON_AW_API_FILTER_SSID_BLACK_LIST)
+#else
+#define SIGFOX_EP_ADDON_AW_API_STATIC_FILTER_BL_MASK    0
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_FILTER_RSSI_MIN
+#define SIGFOX_EP_ADDON_AW_API_STATIC_FILTER_RM_MASK    (1 << SIGFOX_EP_ADDON_AW_API_FILTER_RSSI_MIN)
+#else
+#define SIGFOX_EP_ADDON_AW_API_STATIC_FILTER_RM_MASK    0
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST
+#define SIGFOX_EP_ADDON_AW_API_STATIC_FILTER_OB_MASK    (1 << SIGFOX_EP_ADDON_AW_API_FILTER_OUI_BLACK_LIST)
+#else
+#define SIGFOX_EP_ADDON_AW_API_STATIC_FILTER_OB_MASK    0
+#endif
+#define SIGFOX_EP_ADDON_AW_API_STATIC_FILTERS_MASK      (SIGFOX_EP_ADDON_AW_API_STATIC_FILTER_LA_MASK | SIGFOX_EP_ADDON_AW_API_STATIC_FILTER_SE_MASK | SIGFOX_EP_ADDON_AW_API_STATIC_FILTER_BL_MASK | SIGFOX_EP_ADDON_AW_API_STATIC_FILTER_RM_MASK | SIGFOX_EP_ADDON_AW_API_STATIC_FILTER_OB_MASK)
+#define SIGFOX_EP_ADDON_AW_API_FILTER_IS_ENABLED(context, filter)   ((SIGFOX_EP_ADDON_AW_API_STATIC_FILTERS_MASK & (1 << (filter))) != 0)
+#else
+#define SIGFOX_EP_ADDON_AW_API_FILTER_IS_ENABLED(context, filter)   ((((context)->filters) & (1 << (filter))) != 0)
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_LAZY_FILTERS
+#define SIGFOX_EP_ADDON_AW_API_IS_SELECTABLE(status)    (((status) == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID) || ((status) == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_PENDING))
+#else
+#define SIGFOX_EP_ADDON_AW_API_IS_SELECTABLE(status)    ((status) == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID)
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_PACKED_INPUT
+#define SIGFOX_EP_ADDON_AW_API_PACKED_GET_STATUS(packed_access_point)            ((SIGFOX_EP_ADDON_AW_API_access_point_status_t) ((packed_access_point)->info & SIGFOX_EP_ADDON_AW_API_PACKED_INFO_STATUS_MASK))
+#define SIGFOX_EP_ADDON_AW_API_PACKED_SET_STATUS(packed_access_point, status)    (packed_access_point)->info = (sfx_u8) (((packed_access_point)->info & (~SIGFOX_EP_ADDON_AW_API_PACKED_INFO_STATUS_MASK)) | (status))
+#define SIGFOX_EP_ADDON_AW_API_PACKED_RSSI_MIN_DBM                              (-128)
+#define SIGFOX_EP_ADDON_AW_API_PACKED_RSSI_MAX_DBM                              127
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_STREAM
+#define SIGFOX_EP_ADDON_AW_API_STREAM_CWLAP_PREFIX          "+CWLAP:("
+#define SIGFOX_EP_ADDON_AW_API_STREAM_CWLAP_PREFIX_SIZE     8
+#define SIGFOX_EP_ADDON_AW_API_STREAM_FIELD_SSID            1
+#define SIGFOX_EP_ADDON_AW_API_STREAM_FIELD_RSSI            2
+#define SIGFOX_EP_ADDON_AW_API_STREAM_FIELD_MAC_ADDRESS     3
+#define SIGFOX_EP_ADDON_AW_API_STREAM_FLAG_QUOTED           0x01
+#define SIGFOX_EP_ADDON_AW_API_STREAM_FLAG_ESCAPED          0x02
+#define SIGFOX_EP_ADDON_AW_API_STREAM_FLAG_NEGATIVE         0x04
+#define SIGFOX_EP_ADDON_AW_API_STREAM_FLAG_INVALID          0x08
+#define SIGFOX_EP_ADDON_AW_API_STREAM_RSSI_MAGNITUDE_MAX    1000
+#define SIGFOX_EP_ADDON_AW_API_STREAM_INDEX_MAX             0xFF
+#endif
 
 /*** SIGFOX EP ADDON AW API local functions declaration ***/
 
-static void _filter_locally_administered(SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_u8 *mac_address_bytes, sfx_bool *access_point_is_valid);
-static void _filter_ssid_empty(SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_u8 *mac_address_bytes, sfx_bool *access_point_is_valid);
-static void _filter_ssid_black_list(SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_u8 *mac_address_bytes, sfx_bool *access_point_is_valid);
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_LOCALLY_ADMINISTERED))
+static void _filter_locally_administered(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_u8 *mac_address_bytes, sfx_bool *access_point_is_valid);
+#endif
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_SSID_EMPTY))
+static void _filter_ssid_empty(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_u8 *mac_address_bytes, sfx_bool *access_point_is_valid);
+#endif
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST))
+static void _filter_ssid_black_list(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_u8 *mac_address_bytes, sfx_bool *access_point_is_valid);
+#endif
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_RSSI_MIN))
+static void _filter_rssi_min(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_u8 *mac_address_bytes, sfx_bool *access_point_is_valid);
+#endif
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST))
+static void _filter_oui_black_list(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_u8 *mac_address_bytes, sfx_bool *access_point_is_valid);
+#endif
 
-static void _sort_none(SIGFOX_EP_ADDON_AW_API_input_data_t *input_list);
-static void _sort_rssi(SIGFOX_EP_ADDON_AW_API_input_data_t *input_list);
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_SORTING) || (defined SIGFOX_EP_ADDON_AW_SORTING_NONE))
+static void _sort_none(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, SIGFOX_EP_ADDON_AW_API_index_t *best_index, SIGFOX_EP_ADDON_AW_API_index_t nb_best);
+#endif
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_SORTING) || (defined SIGFOX_EP_ADDON_AW_SORTING_RSSI))
+static void _sort_rssi(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, SIGFOX_EP_ADDON_AW_API_index_t *best_index, SIGFOX_EP_ADDON_AW_API_index_t nb_best);
+#endif
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_SORTING) || (defined SIGFOX_EP_ADDON_AW_SORTING_SCANS))
+static void _sort_scans(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, SIGFOX_EP_ADDON_AW_API_index_t *best_index, SIGFOX_EP_ADDON_AW_API_index_t nb_best);
+#endif
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_SORTING) || (defined SIGFOX_EP_ADDON_AW_SORTING_DEVICES))
+static void _sort_devices(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, SIGFOX_EP_ADDON_AW_API_index_t *best_index, SIGFOX_EP_ADDON_AW_API_index_t nb_best);
+#endif
 
 /*** SIGFOX EP ADDON AW API local structures ***/
 
-typedef void (*SIGFOX_EP_ADDON_AW_API_filter_cb_t)(SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_u8 *mac_address_bytes, sfx_bool *access_point_is_valid);
-typedef void (*SIGFOX_EP_ADDON_AW_API_sort_cb_t)(SIGFOX_EP_ADDON_AW_API_input_data_t *input_list);
+#ifndef SIGFOX_EP_ADDON_AW_STATIC_FILTERS
+typedef void (*SIGFOX_EP_ADDON_AW_API_filter_cb_t)(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_u8 *mac_address_bytes, sfx_bool *access_point_is_valid);
+#endif
+#ifndef SIGFOX_EP_ADDON_AW_STATIC_SORTING
+typedef void (*SIGFOX_EP_ADDON_AW_API_sort_cb_t)(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, SIGFOX_EP_ADDON_AW_API_index_t *best_index, SIGFOX_EP_ADDON_AW_API_index_t nb_best);
+#endif
 
+#ifdef SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD
 /*******************************************************************/
 typedef struct {
-    sfx_u8 filters;
-    SIGFOX_EP_ADDON_AW_API_sorting_t sorting;
-    sfx_u8 best_index[SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD];
+    sfx_u8 nb_access_points;
+    sfx_u8 nb_nic_bits;
+    sfx_u8 nb_rssi_bits;
+} SIGFOX_EP_ADDON_AW_API_compact_layout_t;
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_STREAM
+/*******************************************************************/
+typedef enum {
+    SIGFOX_EP_ADDON_AW_API_STREAM_STATE_PREFIX = 0,
+    SIGFOX_EP_ADDON_AW_API_STREAM_STATE_FIELDS,
+    SIGFOX_EP_ADDON_AW_API_STREAM_STATE_SKIP_LINE
+} SIGFOX_EP_ADDON_AW_API_stream_state_t;
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_ASYNC
+/*******************************************************************/
+typedef enum {
+    SIGFOX_EP_ADDON_AW_API_ASYNC_SCAN_STATE_IDLE = 0,
+    SIGFOX_EP_ADDON_AW_API_ASYNC_SCAN_STATE_RUNNING,
+    SIGFOX_EP_ADDON_AW_API_ASYNC_SCAN_STATE_COMPLETE
+} SIGFOX_EP_ADDON_AW_API_async_scan_state_t;
 
-} SIGFOX_EP_ADDON_AW_API_context_t;
+/*******************************************************************/
+typedef enum {
+    SIGFOX_EP_ADDON_AW_API_ASYNC_BUFFER_STATE_FREE = 0,
+    SIGFOX_EP_ADDON_AW_API_ASYNC_BUFFER_STATE_READY,
+    SIGFOX_EP_ADDON_AW_API_ASYNC_BUFFER_STATE_SENDING
+} SIGFOX_EP_ADDON_AW_API_async_buffer_state_t;
+#endif
 
 /*** SIGFOX EP ADDON AW API local global variables ***/
 
+#ifndef SIGFOX_EP_ADDON_AW_STATIC_FILTERS
 static const SIGFOX_EP_ADDON_AW_API_filter_cb_t SIGFOX_EP_ADDON_AW_API_FILTER[SIGFOX_EP_ADDON_AW_API_FILTER_LAST] = {
     &_filter_locally_administered,
     &_filter_ssid_empty,
     &_filter_ssid_black_list,
+    &_filter_rssi_min,
+    &_filter_oui_black_list,
+};
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || ((defined SIGFOX_EP_ADDON_AW_PACKED_INPUT) && (defined SIGFOX_EP_ADDON_AW_STATISTICS)))
+// Filters execution order, from the cheapest to the most expensive one.
+static const SIGFOX_EP_ADDON_AW_API_filter_t SIGFOX_EP_ADDON_AW_API_FILTER_ORDER[SIGFOX_EP_ADDON_AW_API_FILTER_LAST] = {
+    SIGFOX_EP_ADDON_AW_API_FILTER_RSSI_MIN,
+    SIGFOX_EP_ADDON_AW_API_FILTER_LOCALLY_ADMINISTERED,
+    SIGFOX_EP_ADDON_AW_API_FILTER_SSID_EMPTY,
+    SIGFOX_EP_ADDON_AW_API_FILTER_OUI_BLACK_LIST,
+    SIGFOX_EP_ADDON_AW_API_FILTER_SSID_BLACK_LIST,
 };
+#endif
 
+#ifndef SIGFOX_EP_ADDON_AW_STATIC_SORTING
 static const SIGFOX_EP_ADDON_AW_API_sort_cb_t SIGFOX_EP_ADDON_AW_API_SORT[SIGFOX_EP_ADDON_AW_API_SORTING_LAST] = {
     &_sort_none,
     &_sort_rssi,
+    &_sort_scans,
+    &_sort_devices,
+};
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD
+// Fields of each access point in the 88 bits following the header (OUI code, then NIC and RSSI bits), indexed on the header layout bit.
+static const SIGFOX_EP_ADDON_AW_API_compact_layout_t SIGFOX_EP_ADDON_AW_API_COMPACT_LAYOUT[SIGFOX_EP_ADDON_AW_API_COMPACT_NB_LAYOUTS] = {
+    { 3, 20, 3 },
+    { 4, 14, 2 },
+};
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST))
+// Default SSID black list automaton, compiled from the words "phone", "huawei", "samsung", "android" and "apple" with SIGFOX_EP_ADDON_AW_API_compile_ssid_black_list().
+static const sfx_u8 SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_DEFAULT_CLASS_MAP[SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_CLASS_MAP_SIZE] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0x0D, 0x05, 0x00, 0x0C, 0x02, 0x09, 0x00, 0x00, 0x0F, 0x0B, 0x04, 0x03,
+    0x01, 0x00, 0x0E, 0x0A, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x00, 0x0D, 0x05, 0x00, 0x0C, 0x02, 0x09, 0x00, 0x00, 0x0F, 0x0B, 0x04, 0x03,
+    0x01, 0x00, 0x0E, 0x0A, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
-static const sfx_u8 SIGFOX_EP_ADDON_AW_API_SSID_PHONE[] = "phone";
-static const sfx_u8 SIGFOX_EP_ADDON_AW_API_SSID_HUAWEI[] = "huawei";
-static const sfx_u8 SIGFOX_EP_ADDON_AW_API_SSID_SAMSUNG[] = "samsung";
-static const sfx_u8 SIGFOX_EP_ADDON_AW_API_SSID_ANDROID[] = "android";
-static const sfx_u8 SIGFOX_EP_ADDON_AW_API_SSID_APPLE[] = "apple";
-
-static const sfx_u8* const SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST[SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_SIZE] = {
-    SIGFOX_EP_ADDON_AW_API_SSID_PHONE,
-    SIGFOX_EP_ADDON_AW_API_SSID_HUAWEI,
-    SIGFOX_EP_ADDON_AW_API_SSID_SAMSUNG,
-    SIGFOX_EP_ADDON_AW_API_SSID_ANDROID,
-    SIGFOX_EP_ADDON_AW_API_SSID_APPLE,
+static const sfx_u8 SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_DEFAULT_MATCH_BITMAP[] = {
+    0x00, 0x00, 0x10, 0x33,
 };
 
+static const sfx_u8 SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_DEFAULT_TRANSITION_TABLE[] = {
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0x02, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x0A, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0x02, 0x00, 0x08, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0D, 0x00, 0x00,
+    0x00, 0x0E, 0x05, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x0F, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x09, 0x02, 0x00, 0x08, 0x00, 0x00, 0x04, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x12, 0x00,
+    0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x16, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x17, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x18, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x19, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x1A, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x1B, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x1C, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1D, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const SIGFOX_EP_ADDON_AW_API_ssid_black_list_t SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_DEFAULT = {
+    .class_map = SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_DEFAULT_CLASS_MAP,
+    .match_bitmap = SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_DEFAULT_MATCH_BITMAP,
+    .transition_table = SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_DEFAULT_TRANSITION_TABLE,
+    .nb_states = 30,
+    .nb_classes = 16,
+};
+#endif
+
+#if ((defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) && (defined SIGFOX_EP_ADDON_AW_STATIC_SORTING) && !(defined SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST) && !(defined SIGFOX_EP_ADDON_AW_FILTER_RSSI_MIN))
+static SIGFOX_EP_ADDON_AW_API_context_t sigfox_ep_addon_aw_api_ctx;
+#else
 static SIGFOX_EP_ADDON_AW_API_context_t sigfox_ep_addon_aw_api_ctx = {
+#ifndef SIGFOX_EP_ADDON_AW_STATIC_FILTERS
     .filters = 0,
+#endif
+#ifndef SIGFOX_EP_ADDON_AW_STATIC_SORTING
     .sorting = SIGFOX_EP_ADDON_AW_API_SORTING_NONE,
+#endif
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST))
+    .ssid_black_list = &SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_DEFAULT,
+#endif
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_RSSI_MIN))
+    .rssi_min_dbm = SIGFOX_EP_ADDON_AW_API_RSSI_MIN_DBM_DEFAULT,
+#endif
 };
+#endif
 
 /*** SIGFOX EP ADDON AW API local functions ***/
 
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+/*******************************************************************/
+static sfx_u32 _timing_get_timestamp(SIGFOX_EP_ADDON_AW_API_context_t *context) {
+    return ((context->timestamp_cb == SIGFOX_NULL) ? 0 : context->timestamp_cb());
+}
+
 /*******************************************************************/
-static sfx_bool _compare_string(sfx_u8 *str, sfx_u8 *ref) {
+static void _timing_add_stage(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_stage_t stage, sfx_u32 *timestamp) {
+    // Local variables.
+    sfx_u32 now = _timing_get_timestamp(context);
+    // Unsigned difference handles the timestamp wrapping.
+    context->timing.stage_total[stage] += (now - (*timestamp));
+    (*timestamp) = now;
+}
+
+/*******************************************************************/
+static void _timing_reset(SIGFOX_EP_ADDON_AW_API_context_t *context) {
     // Local variables.
-    sfx_bool is_equal = SIGFOX_TRUE;
     sfx_u8 idx = 0;
-    // Loop on all characters.
-    while (ref[idx] != SIGFOX_EP_ADDON_AW_API_NULL_CHAR) {
-        // Check if all characters are the same.
-        if ((str[idx] != ref[idx]) || (str[idx] == SIGFOX_EP_ADDON_AW_API_NULL_CHAR)) {
-           is_equal = SIGFOX_FALSE;
-           break;
-        }
-        // Increment character index.
-        idx++;
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_STAGE_LAST; idx++) {
+        context->timing.stage_total[idx] = 0;
     }
-    return is_equal;
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_STATISTICS
+/*******************************************************************/
+static void _statistics_add_valid(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_s16 rssi_dbm) {
+    // Update RSSI range.
+    if (((context->statistics.nb_valid) == 0) || (rssi_dbm < (context->statistics.rssi_min_dbm))) {
+        context->statistics.rssi_min_dbm = rssi_dbm;
+    }
+    if (((context->statistics.nb_valid) == 0) || (rssi_dbm > (context->statistics.rssi_max_dbm))) {
+        context->statistics.rssi_max_dbm = rssi_dbm;
+    }
+    // Update count and sum (the mean is computed when reading the statistics).
+    context->statistics_rssi_sum += rssi_dbm;
+    context->statistics.nb_valid++;
 }
 
 /*******************************************************************/
-static sfx_bool _search_substring(sfx_u8 *full_string, sfx_u8 *substring) {
+static void _statistics_reset(SIGFOX_EP_ADDON_AW_API_context_t *context) {
     // Local variables.
-    sfx_bool substring_found = SIGFOX_FALSE;
     sfx_u8 idx = 0;
-    // Loop on all characters.
-    while (full_string[idx] != SIGFOX_EP_ADDON_AW_API_NULL_CHAR) {
-        // Compare with new shift.
-        substring_found = _compare_string(&(full_string[idx]), substring);
-        // Directly exit as soon as a black listed name is found.
-        if (substring_found == SIGFOX_TRUE) break;
-        // Increment character index.
-        idx++;
+    context->statistics.nb_reserved = 0;
+    context->statistics.nb_multicast = 0;
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_FILTER_LAST; idx++) {
+        context->statistics.nb_filtered_out[idx] = 0;
     }
-    return substring_found;
+    context->statistics.nb_valid = 0;
+    context->statistics.nb_duplicate = 0;
+    context->statistics.rssi_min_dbm = 0;
+    context->statistics.rssi_max_dbm = 0;
+    context->statistics.rssi_mean_dbm = 0;
+    context->statistics_rssi_sum = 0;
+}
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST))
+/*******************************************************************/
+static sfx_u8 _to_lowercase(sfx_u8 ascii_character) {
+    return (((ascii_character >= 'A') && (ascii_character <= 'Z')) ? (ascii_character + SIGFOX_EP_ADDON_AW_UPPERCASE_OFFSET) : (ascii_character));
 }
+#endif
 
+#ifndef SIGFOX_EP_ADDON_AW_SIMD
 /*******************************************************************/
-static SIGFOX_EP_ADDON_AW_API_status_t _ascii_to_value(sfx_u8 ascii_character, sfx_u8 *value) {
+static sfx_u32 _swar_is_in_range(sfx_u32 ascii_word, sfx_u8 min, sfx_u8 max) {
     // Local variables.
-#ifdef SIGFOX_EP_ERROR_CODES
-    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+    sfx_u32 low_word = (ascii_word & SIGFOX_EP_ADDON_AW_API_SWAR_BYTES(0x7F));
+    // Bit 7 of each byte is set when (byte >= min) and cleared when (byte > max).
+    return (((low_word + SIGFOX_EP_ADDON_AW_API_SWAR_BYTES(0x80 - min)) & (~(low_word + SIGFOX_EP_ADDON_AW_API_SWAR_BYTES(0x7F - max)))) & SIGFOX_EP_ADDON_AW_API_SWAR_BYTES(0x80));
+}
+
+/*******************************************************************/
+static sfx_u32 _swar_hex_to_bytes(sfx_u32 ascii_word, sfx_u8 *bytes) {
+    // Local variables.
+    sfx_u32 is_digit = _swar_is_in_range(ascii_word, '0', '9');
+    sfx_u32 is_letter = _swar_is_in_range((ascii_word | SIGFOX_EP_ADDON_AW_API_SWAR_BYTES(SIGFOX_EP_ADDON_AW_UPPERCASE_OFFSET)), 'a', 'f');
+    sfx_u32 nibbles = 0;
+    // Compute the 4 nibbles at once: digits are given by the 4 LSB, letters need an additional offset of 9.
+    nibbles = (ascii_word & SIGFOX_EP_ADDON_AW_API_SWAR_BYTES(0x0F)) + ((is_letter >> 7) * 9);
+    // Merge nibbles by pairs.
+    nibbles = (nibbles << 4) | (nibbles >> 8);
+    bytes[0] = (sfx_u8) ((nibbles >> 0) & 0xFF);
+    bytes[1] = (sfx_u8) ((nibbles >> 16) & 0xFF);
+    // Return invalid characters mask (neither digit nor letter, or non ASCII).
+    return (((~(is_digit | is_letter)) | ascii_word) & SIGFOX_EP_ADDON_AW_API_SWAR_BYTES(0x80));
+}
 #endif
-    // Reset value.
-    (*value) = 0;
-    // Convert to uppercase.
-    if (ascii_character > 'F') {
-        ascii_character -= SIGFOX_EP_ADDON_AW_UPPERCASE_OFFSET;
-    }
-    // Case of digit.
-    if ((ascii_character >= '0') && (ascii_character <= '9')) {
-        (*value) = (ascii_character - '0');
-    }
-    // Case of letter.
-    else if ((ascii_character >= 'A') && (ascii_character <= 'F')) {
-        (*value) = (ascii_character - 'A' + 10);
+
+#if (defined SIGFOX_EP_ADDON_AW_SIMD) && (defined __SSE2__)
+/*******************************************************************/
+static __m128i _simd_hex_to_nibbles(__m128i ascii_vector, __m128i *invalid_vector) {
+    // Local variables.
+    __m128i lowercase_vector = _mm_or_si128(ascii_vector, _mm_set1_epi8(SIGFOX_EP_ADDON_AW_UPPERCASE_OFFSET));
+    __m128i is_digit = _mm_setzero_si128();
+    __m128i is_letter = _mm_setzero_si128();
+    // Signed comparisons: non ASCII characters are negative and fail the lower bound check.
+    is_digit = _mm_and_si128(_mm_cmpgt_epi8(ascii_vector, _mm_set1_epi8('0' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), ascii_vector));
+    is_letter = _mm_and_si128(_mm_cmpgt_epi8(lowercase_vector, _mm_set1_epi8('a' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('f' + 1), lowercase_vector));
+    (*invalid_vector) = _mm_andnot_si128(_mm_or_si128(is_digit, is_letter), _mm_set1_epi8((char) 0xFF));
+    // Digits are given by the 4 LSB, letters need an additional offset of 9.
+    return _mm_add_epi8(_mm_and_si128(ascii_vector, _mm_set1_epi8(0x0F)), _mm_and_si128(is_letter, _mm_set1_epi8(9)));
+}
+#endif
+
+#if (defined SIGFOX_EP_ADDON_AW_SIMD) && !(defined __SSE2__)
+/*******************************************************************/
+static uint8x16_t _simd_hex_to_nibbles(uint8x16_t ascii_vector, uint8x16_t *invalid_vector) {
+    // Local variables.
+    uint8x16_t lowercase_vector = vorrq_u8(ascii_vector, vdupq_n_u8(SIGFOX_EP_ADDON_AW_UPPERCASE_OFFSET));
+    uint8x16_t is_digit = vandq_u8(vcgeq_u8(ascii_vector, vdupq_n_u8('0')), vcleq_u8(ascii_vector, vdupq_n_u8('9')));
+    uint8x16_t is_letter = vandq_u8(vcgeq_u8(lowercase_vector, vdupq_n_u8('a')), vcleq_u8(lowercase_vector, vdupq_n_u8('f')));
+    (*invalid_vector) = vmvnq_u8(vorrq_u8(is_digit, is_letter));
+    // Digits are given by the 4 LSB, letters need an additional offset of 9.
+    return vaddq_u8(vandq_u8(ascii_vector, vdupq_n_u8(0x0F)), vandq_u8(is_letter, vdupq_n_u8(9)));
+}
+
+/*******************************************************************/
+static sfx_u32 _simd_lanes_mask(uint8x16_t lanes_vector, sfx_u32 lanes_mask) {
+    // Local variables.
+    sfx_u8 lanes[16];
+    sfx_u32 mask = 0;
+    sfx_u8 idx = 0;
+    // Keep bit 7 of each selected lane, as the SSE2 movemask instruction.
+    vst1q_u8(lanes, lanes_vector);
+    for (idx = 0; idx < 16; idx++) {
+        mask |= ((sfx_u32) (lanes[idx] >> 7)) << idx;
     }
-    else {
-        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_MAC_ADDRESS_FORMAT);
+    return (mask & lanes_mask);
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_SIMD
+/*******************************************************************/
+static sfx_u32 _simd_mac_address_to_bytes(sfx_u8 *mac_address_ascii, sfx_u8 *mac_address_bytes, sfx_u32 *separator_error) {
+    // Local variables.
+    sfx_u8 bytes[16];
+    sfx_u32 format_error = 0;
+    sfx_u8 byte_idx = 0;
+#ifdef __SSE2__
+    // The high digits are in lanes 0, 3, ..., 15 of the first vector and the low digits in the same lanes of the second one (shifted by 1 character).
+    __m128i high_vector = _mm_loadu_si128((const __m128i*) (mac_address_ascii));
+    __m128i low_vector = _mm_loadu_si128((const __m128i*) (mac_address_ascii + 1));
+    __m128i high_invalid = _mm_setzero_si128();
+    __m128i low_invalid = _mm_setzero_si128();
+    __m128i high_nibbles = _simd_hex_to_nibbles(high_vector, &high_invalid);
+    __m128i low_nibbles = _simd_hex_to_nibbles(low_vector, &low_invalid);
+    // Nibbles are lower than 16 so that the 16-bit shift does not overflow on the next byte.
+    _mm_storeu_si128((__m128i*) bytes, _mm_or_si128(_mm_slli_epi16(high_nibbles, 4), low_nibbles));
+    format_error = ((sfx_u32) _mm_movemask_epi8(_mm_or_si128(high_invalid, low_invalid))) & SIGFOX_EP_ADDON_AW_API_SIMD_DIGITS_MASK;
+    (*separator_error) = (~((sfx_u32) _mm_movemask_epi8(_mm_cmpeq_epi8(high_vector, _mm_set1_epi8(SIGFOX_EP_ADDON_AW_API_MAC_BYTE_SEPARATOR_CHAR))))) & SIGFOX_EP_ADDON_AW_API_SIMD_SEPARATORS_MASK;
+#else
+    // The high digits are in lanes 0, 3, ..., 15 of the first vector and the low digits in the same lanes of the second one (shifted by 1 character).
+    uint8x16_t high_vector = vld1q_u8(mac_address_ascii);
+    uint8x16_t low_vector = vld1q_u8(mac_address_ascii + 1);
+    uint8x16_t high_invalid;
+    uint8x16_t low_invalid;
+    uint8x16_t high_nibbles = _simd_hex_to_nibbles(high_vector, &high_invalid);
+    uint8x16_t low_nibbles = _simd_hex_to_nibbles(low_vector, &low_invalid);
+    vst1q_u8(bytes, vorrq_u8(vshlq_n_u8(high_nibbles, 4), low_nibbles));
+    format_error = _simd_lanes_mask(vorrq_u8(high_invalid, low_invalid), SIGFOX_EP_ADDON_AW_API_SIMD_DIGITS_MASK);
+    (*separator_error) = _simd_lanes_mask(vmvnq_u8(vceqq_u8(high_vector, vdupq_n_u8(SIGFOX_EP_ADDON_AW_API_MAC_BYTE_SEPARATOR_CHAR))), SIGFOX_EP_ADDON_AW_API_SIMD_SEPARATORS_MASK);
+#endif
+    for (byte_idx = 0; byte_idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES; byte_idx++) {
+        mac_address_bytes[byte_idx] = bytes[3 * byte_idx];
     }
-errors:
-    SIGFOX_RETURN();
+    return format_error;
 }
+#endif
 
 /*******************************************************************/
 static SIGFOX_EP_ADDON_AW_API_status_t _mac_address_ascii_to_bytes_array(sfx_u8 *mac_address_ascii, sfx_u8 *mac_address_bytes) {
@@ -188,47 +566,45 @@ static SIGFOX_EP_ADDON_AW_API_status_t _mac_address_ascii_to_bytes_array(sfx_u8
 #ifdef SIGFOX_EP_ERROR_CODES
     SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
 #endif
-    sfx_u8 digit_value = 0;
+    sfx_u32 format_error = 0;
+    sfx_u32 separator_error = 0;
+#ifndef SIGFOX_EP_ADDON_AW_SIMD
     sfx_u8 char_idx = 0;
+#endif
     sfx_u8 byte_idx = 0;
-    // Reset output.
-    for (byte_idx = 0; byte_idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES; byte_idx++) {
-        mac_address_bytes[byte_idx] = 0x00;
+#ifdef SIGFOX_EP_ADDON_AW_SIMD
+    // Convert all digits and check all separators at once.
+    format_error = _simd_mac_address_to_bytes(mac_address_ascii, mac_address_bytes, &separator_error);
+#ifndef SIGFOX_EP_PARAMETERS_CHECK
+    separator_error = 0;
+#endif
+#else
+    // Convert ASCII to bytes, 4 digits (2 bytes) at a time.
+    for (char_idx = 0; char_idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR; char_idx += 6) {
+        format_error |= _swar_hex_to_bytes(SIGFOX_EP_ADDON_AW_API_SWAR_WORD(mac_address_ascii, char_idx, (char_idx + 1), (char_idx + 3), (char_idx + 4)), &(mac_address_bytes[byte_idx]));
+        byte_idx += 2;
     }
 #ifdef SIGFOX_EP_PARAMETERS_CHECK
-    // Check byte separator.
-    for (char_idx = 2; char_idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR; char_idx += 3) {
-        // Exit if separator is not found.
-        if (mac_address_ascii[char_idx] != SIGFOX_EP_ADDON_AW_API_MAC_BYTE_SEPARATOR_CHAR) {
-            SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_MAC_ADDRESS_SEPARATOR);
-        }
-    }
+    // Check byte separators in the same pass.
+    separator_error  = SIGFOX_EP_ADDON_AW_API_SWAR_WORD(mac_address_ascii, 2, 5, 8, 11) ^ SIGFOX_EP_ADDON_AW_API_SWAR_BYTES(SIGFOX_EP_ADDON_AW_API_MAC_BYTE_SEPARATOR_CHAR);
+    separator_error |= (sfx_u32) (mac_address_ascii[14] ^ SIGFOX_EP_ADDON_AW_API_MAC_BYTE_SEPARATOR_CHAR);
 #endif
-    byte_idx = 0;
-    // Convert ASCII to bytes.
-    for (char_idx = 0; char_idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR; char_idx += 3) {
-        // First digit.
-#ifdef SIGFOX_EP_ERROR_CODES
-        status = _ascii_to_value (mac_address_ascii[char_idx], &digit_value);
-        SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
-#else
-        _ascii_to_value (mac_address_ascii[char_idx], &digit_value);
 #endif
-        mac_address_bytes[byte_idx] = ((digit_value << 4) & 0xF0);
-        // Second digit.
-#ifdef SIGFOX_EP_ERROR_CODES
-        status = _ascii_to_value (mac_address_ascii[char_idx + 1], &digit_value);
-        SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
-#else
-        _ascii_to_value (mac_address_ascii[char_idx], &digit_value);
+    // Reset output in case of invalid digit or separator, so that the address is seen as reserved.
+    if ((format_error | separator_error) != 0) {
+        for (byte_idx = 0; byte_idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES; byte_idx++) {
+            mac_address_bytes[byte_idx] = 0x00;
+        }
+    }
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    if (separator_error != 0) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_MAC_ADDRESS_SEPARATOR);
+    }
 #endif
-        mac_address_bytes[byte_idx] |= ((digit_value << 0) & 0x0F);
-        // Increment output byte index.
-        byte_idx++;
+    if (format_error != 0) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_MAC_ADDRESS_FORMAT);
     }
-#if ((defined SIGFOX_EP_PARAMETERS_CHECK) || (defined SIGFOX_EP_ERROR_CODES))
 errors:
-#endif
     SIGFOX_RETURN();
 }
 
@@ -258,6 +634,7 @@ static sfx_bool _mac_address_is_multicast(sfx_u8 *mac_address_bytes) {
     return is_multicast;
 }
 
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_LOCALLY_ADMINISTERED))
 /*******************************************************************/
 static sfx_bool _mac_address_is_locally_administered(sfx_u8 *mac_address_bytes) {
     // Local variables.
@@ -268,10 +645,35 @@ static sfx_bool _mac_address_is_locally_administered(sfx_u8 *mac_address_bytes)
     }
     return is_locally_administered;
 }
+#endif
+
+/*******************************************************************/
+static sfx_bool _mac_address_is_equal(sfx_u8 *mac_address_bytes_1, sfx_u8 *mac_address_bytes_2) {
+    // Local variables.
+    sfx_bool is_equal = SIGFOX_TRUE;
+    sfx_u8 idx = 0;
+    // Compare bytes.
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES; idx++) {
+        if (mac_address_bytes_1[idx] != mac_address_bytes_2[idx]) {
+            is_equal = SIGFOX_FALSE;
+            break;
+        }
+    }
+    return is_equal;
+}
+
+/*******************************************************************/
+static sfx_u16 _mac_address_hash(sfx_u8 *mac_address_bytes) {
+    // Multiplicative hash on the 4 last bytes (the first ones are mostly the manufacturer identifier).
+    sfx_u32 key = SIGFOX_EP_ADDON_AW_API_SWAR_WORD(mac_address_bytes, 2, 3, 4, 5);
+    return (sfx_u16) (((key * SIGFOX_EP_ADDON_AW_API_DEDUPLICATION_HASH_FACTOR) >> 16) & (SIGFOX_EP_ADDON_AW_API_DEDUPLICATION_TABLE_SIZE - 1));
+}
 
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_SSID_EMPTY))
 /*******************************************************************/
-static void _filter_ssid_empty(SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_u8 *mac_address_bytes, sfx_bool *access_point_is_valid) {
+static void _filter_ssid_empty(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_u8 *mac_address_bytes, sfx_bool *access_point_is_valid) {
     // Unused parameter.
+    SIGFOX_UNUSED(context);
     SIGFOX_UNUSED(mac_address_bytes);
     // Reset output flag.
     (*access_point_is_valid) = SIGFOX_TRUE;
@@ -286,51 +688,50 @@ static void _filter_ssid_empty(SIGFOX_EP_ADDON_AW_API_access_point_t *access_poi
         return;
     }
 }
+#endif
 
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST))
 /*******************************************************************/
-static void _filter_ssid_black_list(SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_u8 *mac_address_bytes, sfx_bool *access_point_is_valid) {
-    // Unused parameter.
-    SIGFOX_UNUSED(mac_address_bytes);
+static sfx_bool _ssid_is_black_listed(const SIGFOX_EP_ADDON_AW_API_ssid_black_list_t *ssid_black_list, sfx_u8 *ssid) {
     // Local variables.
-    sfx_u8 ssid_lowercase[SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR];
     sfx_u8 ssid_char = SIGFOX_EP_ADDON_AW_API_NULL_CHAR;
-    sfx_u8 ssid_end = 0;
-    sfx_u8 idx = 0;
+    sfx_u8 state = SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_ROOT_STATE;
+    sfx_u8 char_class = SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_OTHER_CLASS;
     sfx_u8 char_idx = 0;
-    // Reset output flag.
-    (*access_point_is_valid) = SIGFOX_TRUE;
-    // Check if SSID exists.
-    if (access_point->ssid == SIGFOX_NULL) {
-        return;
+    // Check if SSID exists and if the black list is not empty.
+    if ((ssid == SIGFOX_NULL) || ((ssid_black_list->nb_states) == 0)) {
+        return SIGFOX_FALSE;
     }
-    // Loop on SSID black list.
-    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_SIZE; idx++) {
-        // Build lowercase SSID.
-        ssid_end = 0;
-        for (char_idx = 0; char_idx < SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR; char_idx++) {
-            // Reset byte and read initial character.
-            ssid_lowercase[char_idx] = SIGFOX_EP_ADDON_AW_API_NULL_CHAR;
-            ssid_char = (access_point->ssid[char_idx]);
-            // Check source string length.
-            if (ssid_char == SIGFOX_EP_ADDON_AW_API_NULL_CHAR) {
-                ssid_end = 1;
-            }
-            // Check end.
-            if (ssid_end == 0) {
-                ssid_lowercase[char_idx] = (((ssid_char >= 'A') && (ssid_char <= 'Z')) ? (ssid_char + SIGFOX_EP_ADDON_AW_UPPERCASE_OFFSET) : (ssid_char));
-            }
-        }
-        // Perform case insensitive comparison.
-        if (_search_substring(ssid_lowercase, (sfx_u8*) SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST[idx]) == SIGFOX_TRUE) {
-            (*access_point_is_valid) = SIGFOX_FALSE;
-            return;
+    // Run the automaton on the SSID (case folding is included in the class map).
+    for (char_idx = 0; char_idx < SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR; char_idx++) {
+        // Read character.
+        ssid_char = ssid[char_idx];
+        if (ssid_char == SIGFOX_EP_ADDON_AW_API_NULL_CHAR) break;
+        // Compute next state.
+        char_class = (ssid_char < SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_CLASS_MAP_SIZE) ? (ssid_black_list->class_map[ssid_char]) : SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_OTHER_CLASS;
+        state = ssid_black_list->transition_table[((sfx_u16) state * (ssid_black_list->nb_classes)) + char_class];
+        // Directly exit as soon as a black listed name is found.
+        if (((ssid_black_list->match_bitmap[state >> 3]) & (1 << (state & 0x07))) != 0) {
+            return SIGFOX_TRUE;
         }
     }
+    return SIGFOX_FALSE;
+}
+
+/*******************************************************************/
+static void _filter_ssid_black_list(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_u8 *mac_address_bytes, sfx_bool *access_point_is_valid) {
+    // Unused parameter.
+    SIGFOX_UNUSED(mac_address_bytes);
+    // Check SSID.
+    (*access_point_is_valid) = (_ssid_is_black_listed((context->ssid_black_list), (access_point->ssid)) == SIGFOX_TRUE) ? SIGFOX_FALSE : SIGFOX_TRUE;
 }
+#endif
 
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_LOCALLY_ADMINISTERED))
 /*******************************************************************/
-static void _filter_locally_administered(SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_u8 *mac_address_bytes, sfx_bool *access_point_is_valid) {
+static void _filter_locally_administered(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_u8 *mac_address_bytes, sfx_bool *access_point_is_valid) {
     // Unused parameter.
+    SIGFOX_UNUSED(context);
     SIGFOX_UNUSED(access_point);
     // Reset output flag.
     (*access_point_is_valid) = SIGFOX_TRUE;
@@ -339,18 +740,102 @@ static void _filter_locally_administered(SIGFOX_EP_ADDON_AW_API_access_point_t *
         (*access_point_is_valid) = SIGFOX_FALSE;
     }
 }
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_RSSI_MIN))
+/*******************************************************************/
+static void _filter_rssi_min(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_u8 *mac_address_bytes, sfx_bool *access_point_is_valid) {
+    // Unused parameter.
+    SIGFOX_UNUSED(mac_address_bytes);
+    // Check RSSI.
+    (*access_point_is_valid) = ((access_point->rssi_dbm) < (context->rssi_min_dbm)) ? SIGFOX_FALSE : SIGFOX_TRUE;
+}
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST) || (defined SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD))
+/*******************************************************************/
+static sfx_u32 _oui_get_key(const sfx_u8 *oui_bytes) {
+    // Big endian key, so that the keys order is the table order.
+    return (((sfx_u32) oui_bytes[0] << 16) | ((sfx_u32) oui_bytes[1] << 8) | ((sfx_u32) oui_bytes[2]));
+}
+
+/*******************************************************************/
+static sfx_bool _oui_table_search(const SIGFOX_EP_ADDON_AW_API_oui_table_t *oui_table, sfx_u8 *mac_address_bytes, sfx_u16 *oui_idx) {
+    // Local variables.
+    sfx_u32 oui_key = 0;
+    sfx_u16 base_idx = 0;
+    sfx_u16 half_size = 0;
+    sfx_u16 size = 0;
+    // Check if the table is not empty.
+    if ((oui_table == SIGFOX_NULL) || ((oui_table->nb_ouis) == 0)) {
+        return SIGFOX_FALSE;
+    }
+    // Binary search of the OUI in the sorted table (read in place, no RAM copy).
+    // The loop only halves the range without early exit, so that the compiler can use conditional moves instead of unpredictable branches.
+    oui_key = _oui_get_key(mac_address_bytes);
+    size = (oui_table->nb_ouis);
+    while (size > 1) {
+        half_size = (sfx_u16) (size >> 1);
+        if (_oui_get_key(&(oui_table->oui_table[(sfx_u32) (base_idx + half_size) * SIGFOX_EP_ADDON_AW_API_OUI_SIZE_BYTES])) <= oui_key) {
+            base_idx = (sfx_u16) (base_idx + half_size);
+        }
+        size = (sfx_u16) (size - half_size);
+    }
+    (*oui_idx) = base_idx;
+    return ((_oui_get_key(&(oui_table->oui_table[(sfx_u32) base_idx * SIGFOX_EP_ADDON_AW_API_OUI_SIZE_BYTES])) == oui_key) ? SIGFOX_TRUE : SIGFOX_FALSE);
+}
+
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+/*******************************************************************/
+static sfx_bool _oui_table_is_sorted(const SIGFOX_EP_ADDON_AW_API_oui_table_t *oui_table) {
+    // Local variables.
+    sfx_u16 oui_idx = 0;
+    // The binary search requires a strictly increasing table.
+    for (oui_idx = 1; oui_idx < (oui_table->nb_ouis); oui_idx++) {
+        if (_oui_get_key(&(oui_table->oui_table[(sfx_u32) oui_idx * SIGFOX_EP_ADDON_AW_API_OUI_SIZE_BYTES])) <= _oui_get_key(&(oui_table->oui_table[(sfx_u32) (oui_idx - 1) * SIGFOX_EP_ADDON_AW_API_OUI_SIZE_BYTES]))) {
+            return SIGFOX_FALSE;
+        }
+    }
+    return SIGFOX_TRUE;
+}
+#endif
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST))
+/*******************************************************************/
+static sfx_bool _oui_is_black_listed(const SIGFOX_EP_ADDON_AW_API_oui_table_t *oui_black_list, sfx_u8 *mac_address_bytes) {
+    // Local variables.
+    sfx_u16 oui_idx = 0;
+    // Search the OUI in the black list.
+    return _oui_table_search(oui_black_list, mac_address_bytes, &oui_idx);
+}
+
+/*******************************************************************/
+static void _filter_oui_black_list(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_u8 *mac_address_bytes, sfx_bool *access_point_is_valid) {
+    // Unused parameter.
+    SIGFOX_UNUSED(access_point);
+    // Check vendor.
+    (*access_point_is_valid) = (_oui_is_black_listed((context->oui_black_list), mac_address_bytes) == SIGFOX_TRUE) ? SIGFOX_FALSE : SIGFOX_TRUE;
+}
+#endif
 
 /*******************************************************************/
-static SIGFOX_EP_ADDON_AW_API_status_t _filter_list(SIGFOX_EP_ADDON_AW_API_input_data_t *input_data) {
+static SIGFOX_EP_ADDON_AW_API_status_t _filter_list(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data) {
     // Local variables.
 #ifdef SIGFOX_EP_ERROR_CODES
     SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
 #endif
-    sfx_u8 mac_address_bytes[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES];
     SIGFOX_EP_ADDON_AW_API_access_point_t *access_point;
     sfx_bool access_point_is_valid = SIGFOX_FALSE;
-    sfx_u8 ap_idx = 0;
+    SIGFOX_EP_ADDON_AW_API_index_t ap_idx = 0;
+#ifndef SIGFOX_EP_ADDON_AW_STATIC_FILTERS
+    SIGFOX_EP_ADDON_AW_API_filter_t filter = SIGFOX_EP_ADDON_AW_API_FILTER_LOCALLY_ADMINISTERED;
     sfx_u8 filter_idx = 0;
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+    sfx_u32 timestamp = 0;
+#endif
+    SIGFOX_EP_ADDON_AW_API_TIMING_START(context, timestamp);
     // Loop on all access points.
     for (ap_idx = 0; ap_idx < (input_data->access_point_list_size); ap_idx++) {
         // Update access point pointer.
@@ -361,211 +846,3188 @@ static SIGFOX_EP_ADDON_AW_API_status_t _filter_list(SIGFOX_EP_ADDON_AW_API_input
         }
 #endif
         // Check if access point has not already been processed.
+#ifdef SIGFOX_EP_ADDON_AW_LAZY_FILTERS
+        if ((access_point->status != SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_NEW) && (access_point->status != SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_PENDING)) {
+#else
         if (access_point->status != SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_NEW) {
+#endif
             continue;
         }
         // Reset result.
         access_point->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_FILTERED_OUT;
-        // Convert ASCII to bytes array.
+        // Convert ASCII to bytes array (only once for the life of the list).
 #ifdef SIGFOX_EP_ERROR_CODES
-        status = _mac_address_ascii_to_bytes_array((access_point->mac_address), mac_address_bytes);
+        status = _mac_address_ascii_to_bytes_array((access_point->mac_address), (access_point->mac_address_bytes));
         SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
 #else
-        _mac_address_ascii_to_bytes_array((access_point->mac_address), mac_address_bytes);
+        _mac_address_ascii_to_bytes_array((access_point->mac_address), (access_point->mac_address_bytes));
 #endif
+        SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, SIGFOX_EP_ADDON_AW_API_STAGE_MAC_ADDRESS_DECODING, timestamp);
         // Mandatory filters: do not keep reserved and multicast addresses.
-        if ((_mac_address_is_reserved(mac_address_bytes) == SIGFOX_TRUE) || (_mac_address_is_multicast(mac_address_bytes) == SIGFOX_TRUE)) {
+        access_point_is_valid = SIGFOX_FALSE;
+        if (_mac_address_is_reserved(access_point->mac_address_bytes) == SIGFOX_TRUE) {
+            SIGFOX_EP_ADDON_AW_API_STATISTICS_INCREMENT(context, nb_reserved);
+        }
+        else if (_mac_address_is_multicast(access_point->mac_address_bytes) == SIGFOX_TRUE) {
+            SIGFOX_EP_ADDON_AW_API_STATISTICS_INCREMENT(context, nb_multicast);
+        }
+        else {
+            // Set valid flag to true in case none filter is enabled.
+            access_point_is_valid = SIGFOX_TRUE;
+        }
+        SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, SIGFOX_EP_ADDON_AW_API_STAGE_MANDATORY_FILTERS, timestamp);
+        if (access_point_is_valid == SIGFOX_FALSE) {
             continue;
         }
-        // Set valid flag to true in case none filter is enabled.
-        access_point_is_valid = SIGFOX_TRUE;
         // Optional filters.
-        for (filter_idx = 0; filter_idx < SIGFOX_EP_ADDON_AW_API_FILTER_LAST; filter_idx++) {
-            // Check mask.
-            if ((sigfox_ep_addon_aw_api_ctx.filters & (1 << filter_idx)) != 0) {
-                // Execute filter function.
-                SIGFOX_EP_ADDON_AW_API_FILTER[filter_idx](access_point, mac_address_bytes, &access_point_is_valid);
-                // Directly exit as soon as an active filter fails.
-                if (access_point_is_valid == SIGFOX_FALSE) {
-                    break;
-                }
+#ifdef SIGFOX_EP_ADDON_AW_STATIC_FILTERS
+        // Filters fixed at compilation time, called directly in the same order.
+#ifdef SIGFOX_EP_ADDON_AW_FILTER_RSSI_MIN
+        if (access_point_is_valid == SIGFOX_TRUE) {
+            _filter_rssi_min(context, access_point, (access_point->mac_address_bytes), &access_point_is_valid);
+            SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, SIGFOX_EP_ADDON_AW_API_STAGE_FILTER_RSSI_MIN, timestamp);
+            if (access_point_is_valid == SIGFOX_FALSE) {
+                SIGFOX_EP_ADDON_AW_API_STATISTICS_INCREMENT(context, nb_filtered_out[SIGFOX_EP_ADDON_AW_API_FILTER_RSSI_MIN]);
             }
         }
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_FILTER_LOCALLY_ADMINISTERED
         if (access_point_is_valid == SIGFOX_TRUE) {
-            access_point->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID;
+            _filter_locally_administered(context, access_point, (access_point->mac_address_bytes), &access_point_is_valid);
+            SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, SIGFOX_EP_ADDON_AW_API_STAGE_FILTER_LOCALLY_ADMINISTERED, timestamp);
+            if (access_point_is_valid == SIGFOX_FALSE) {
+                SIGFOX_EP_ADDON_AW_API_STATISTICS_INCREMENT(context, nb_filtered_out[SIGFOX_EP_ADDON_AW_API_FILTER_LOCALLY_ADMINISTERED]);
+            }
         }
-    }
-#if ((defined SIGFOX_EP_PARAMETERS_CHECK) || (defined SIGFOX_EP_ERROR_CODES))
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_FILTER_SSID_EMPTY
+        if (access_point_is_valid == SIGFOX_TRUE) {
+            _filter_ssid_empty(context, access_point, (access_point->mac_address_bytes), &access_point_is_valid);
+            SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, SIGFOX_EP_ADDON_AW_API_STAGE_FILTER_SSID_EMPTY, timestamp);
+            if (access_point_is_valid == SIGFOX_FALSE) {
+                SIGFOX_EP_ADDON_AW_API_STATISTICS_INCREMENT(context, nb_filtered_out[SIGFOX_EP_ADDON_AW_API_FILTER_SSID_EMPTY]);
+            }
+        }
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST
+        if (access_point_is_valid == SIGFOX_TRUE) {
+            _filter_oui_black_list(context, access_point, (access_point->mac_address_bytes), &access_point_is_valid);
+            SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, SIGFOX_EP_ADDON_AW_API_STAGE_FILTER_OUI_BLACK_LIST, timestamp);
+            if (access_point_is_valid == SIGFOX_FALSE) {
+                SIGFOX_EP_ADDON_AW_API_STATISTICS_INCREMENT(context, nb_filtered_out[SIGFOX_EP_ADDON_AW_API_FILTER_OUI_BLACK_LIST]);
+            }
+        }
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST
+        if (access_point_is_valid == SIGFOX_TRUE) {
+            _filter_ssid_black_list(context, access_point, (access_point->mac_address_bytes), &access_point_is_valid);
+            SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, SIGFOX_EP_ADDON_AW_API_STAGE_FILTER_SSID_BLACK_LIST, timestamp);
+            if (access_point_is_valid == SIGFOX_FALSE) {
+                SIGFOX_EP_ADDON_AW_API_STATISTICS_INCREMENT(context, nb_filtered_out[SIGFOX_EP_ADDON_AW_API_FILTER_SSID_BLACK_LIST]);
+            }
+        }
+#endif
+#else
+        for (filter_idx = 0; filter_idx < SIGFOX_EP_ADDON_AW_API_FILTER_LAST; filter_idx++) {
+            // Check mask.
+            filter = SIGFOX_EP_ADDON_AW_API_FILTER_ORDER[filter_idx];
+            if (((context->filters) & (1 << filter)) != 0) {
+                // Execute filter function.
+                SIGFOX_EP_ADDON_AW_API_FILTER[filter](context, access_point, (access_point->mac_address_bytes), &access_point_is_valid);
+                SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, (SIGFOX_EP_ADDON_AW_API_stage_t) (SIGFOX_EP_ADDON_AW_API_STAGE_FILTER_LOCALLY_ADMINISTERED + filter), timestamp);
+                // Directly exit as soon as an active filter fails.
+                if (access_point_is_valid == SIGFOX_FALSE) {
+                    SIGFOX_EP_ADDON_AW_API_STATISTICS_INCREMENT(context, nb_filtered_out[filter]);
+                    break;
+                }
+            }
+        }
+#endif
+        if (access_point_is_valid == SIGFOX_TRUE) {
+            access_point->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID;
+            SIGFOX_EP_ADDON_AW_API_STATISTICS_ADD_VALID(context, (access_point->rssi_dbm));
+            context->deduplication_pending = SIGFOX_TRUE;
+        }
+    }
+#if ((defined SIGFOX_EP_PARAMETERS_CHECK) || (defined SIGFOX_EP_ERROR_CODES))
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+static void _deduplicate_list(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_index_t table[SIGFOX_EP_ADDON_AW_API_DEDUPLICATION_TABLE_SIZE];
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_point;
+    SIGFOX_EP_ADDON_AW_API_access_point_t *other_access_point;
+    SIGFOX_EP_ADDON_AW_API_access_point_t *duplicate_access_point;
+    SIGFOX_EP_ADDON_AW_API_index_t ap_idx = 0;
+    sfx_u16 slot_idx = 0;
+    sfx_u16 probe_count = 0;
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+    sfx_u32 timestamp = 0;
+#endif
+    // Directly exit if no access point has been validated since the last call.
+    if ((context->deduplication_pending) == SIGFOX_FALSE) {
+        return;
+    }
+    context->deduplication_pending = SIGFOX_FALSE;
+    SIGFOX_EP_ADDON_AW_API_TIMING_START(context, timestamp);
+    // Reset table.
+    for (slot_idx = 0; slot_idx < SIGFOX_EP_ADDON_AW_API_DEDUPLICATION_TABLE_SIZE; slot_idx++) {
+        table[slot_idx] = SIGFOX_EP_ADDON_AW_API_BEST_INDEX_NONE;
+    }
+    // Loop on all access points (already sent ones are kept as reference).
+    for (ap_idx = 0; ap_idx < (input_data->access_point_list_size); ap_idx++) {
+        access_point = (input_data->access_point_list[ap_idx]);
+        if (((access_point->status) != SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID) && ((access_point->status) != SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_SENT)) continue;
+        // Open addressing with linear probing (the access point is kept if the table is full).
+        slot_idx = _mac_address_hash(access_point->mac_address_bytes);
+        for (probe_count = 0; probe_count < SIGFOX_EP_ADDON_AW_API_DEDUPLICATION_TABLE_SIZE; probe_count++) {
+            // New MAC address.
+            if (table[slot_idx] == SIGFOX_EP_ADDON_AW_API_BEST_INDEX_NONE) {
+                table[slot_idx] = ap_idx;
+                break;
+            }
+            other_access_point = (input_data->access_point_list[table[slot_idx]]);
+            if (_mac_address_is_equal((access_point->mac_address_bytes), (other_access_point->mac_address_bytes)) == SIGFOX_TRUE) {
+                // Keep the sent access point, otherwise the best RSSI (the first one in case of equal RSSI).
+                if ((other_access_point->status) == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_SENT) {
+                    duplicate_access_point = access_point;
+                }
+                else if (((access_point->status) == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_SENT) || ((access_point->rssi_dbm) > (other_access_point->rssi_dbm))) {
+                    duplicate_access_point = other_access_point;
+                    table[slot_idx] = ap_idx;
+                }
+                else {
+                    duplicate_access_point = access_point;
+                }
+                if ((duplicate_access_point->status) == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID) {
+                    duplicate_access_point->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_DUPLICATE;
+                    SIGFOX_EP_ADDON_AW_API_STATISTICS_INCREMENT(context, nb_duplicate);
+                }
+                break;
+            }
+            slot_idx = ((slot_idx + 1) & (SIGFOX_EP_ADDON_AW_API_DEDUPLICATION_TABLE_SIZE - 1));
+        }
+    }
+    SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, SIGFOX_EP_ADDON_AW_API_STAGE_DEDUPLICATION, timestamp);
+}
+
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+/*******************************************************************/
+static void _history_get_key(sfx_u8 *mac_address_bytes, sfx_u8 *key) {
+    // Local variables.
+    sfx_u8 byte_idx = 0;
+    // Fold the OUI on the NIC, so that neighbour access points of a same vendor and virtual access points of a same device give different keys.
+    for (byte_idx = 0; byte_idx < SIGFOX_EP_ADDON_AW_API_HISTORY_KEY_SIZE_BYTES; byte_idx++) {
+        key[byte_idx] = (sfx_u8) (mac_address_bytes[byte_idx] ^ mac_address_bytes[byte_idx + SIGFOX_EP_ADDON_AW_API_HISTORY_KEY_SIZE_BYTES]);
+    }
+}
+
+/*******************************************************************/
+static sfx_u8 _history_search(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_u8 *key) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_history_entry_t *entry;
+    sfx_u8 entry_idx = 0;
+    // Return the index of the entry (or the history size if not found).
+    for (entry_idx = 0; entry_idx < SIGFOX_EP_ADDON_AW_API_HISTORY_SIZE; entry_idx++) {
+        entry = &(context->history[entry_idx]);
+        if (((entry->age) == SIGFOX_EP_ADDON_AW_API_HISTORY_AGE_NONE) || ((entry->age) > (context->history_age_max))) continue;
+        if (((entry->key[0]) == key[0]) && ((entry->key[1]) == key[1]) && ((entry->key[2]) == key[2])) break;
+    }
+    return entry_idx;
+}
+
+/*******************************************************************/
+static sfx_u8 _history_get_age(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_u8 *mac_address_bytes) {
+    // Local variables.
+    sfx_u8 key[SIGFOX_EP_ADDON_AW_API_HISTORY_KEY_SIZE_BYTES];
+    sfx_u8 entry_idx = 0;
+    // Directly exit if the history is disabled.
+    if ((context->history_mode) == SIGFOX_EP_ADDON_AW_API_HISTORY_MODE_NONE) {
+        return SIGFOX_EP_ADDON_AW_API_HISTORY_AGE_NONE;
+    }
+    // Return the number of payloads since the MAC address has been sent (or 0 if it has not been sent recently).
+    _history_get_key(mac_address_bytes, key);
+    entry_idx = _history_search(context, key);
+    return ((entry_idx < SIGFOX_EP_ADDON_AW_API_HISTORY_SIZE) ? (context->history[entry_idx].age) : SIGFOX_EP_ADDON_AW_API_HISTORY_AGE_NONE);
+}
+
+/*******************************************************************/
+static void _history_mark_list(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_point;
+    SIGFOX_EP_ADDON_AW_API_index_t ap_idx = 0;
+    // Directly exit if the history is disabled.
+    if ((context->history_mode) == SIGFOX_EP_ADDON_AW_API_HISTORY_MODE_NONE) {
+        return;
+    }
+    // Set aside the valid access points which have been sent in the previous messages.
+    for (ap_idx = 0; ap_idx < (input_data->access_point_list_size); ap_idx++) {
+        access_point = (input_data->access_point_list[ap_idx]);
+        if (((access_point->status) == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID) && (_history_get_age(context, (access_point->mac_address_bytes)) != SIGFOX_EP_ADDON_AW_API_HISTORY_AGE_NONE)) {
+            access_point->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_RECENT;
+        }
+    }
+}
+
+/*******************************************************************/
+static sfx_bool _history_release_list(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, sfx_u8 age_min) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_point;
+    SIGFOX_EP_ADDON_AW_API_index_t ap_idx = 0;
+    sfx_bool released = SIGFOX_FALSE;
+    // Give the recent access points sent at least age_min payloads ago back to the selection (they may be duplicates of each other or of the sent ones).
+    for (ap_idx = 0; ap_idx < (input_data->access_point_list_size); ap_idx++) {
+        access_point = (input_data->access_point_list[ap_idx]);
+        if (((access_point->status) == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_RECENT) && (_history_get_age(context, (access_point->mac_address_bytes)) >= age_min)) {
+            access_point->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID;
+            context->deduplication_pending = SIGFOX_TRUE;
+            released = SIGFOX_TRUE;
+        }
+    }
+    return released;
+}
+
+/*******************************************************************/
+static void _history_add_ul_payload(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_u8 *ul_payload, sfx_u8 nb_mac_ul_payload) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_history_entry_t *entry;
+    sfx_u8 key[SIGFOX_EP_ADDON_AW_API_HISTORY_KEY_SIZE_BYTES];
+    sfx_u8 entry_idx = 0;
+    sfx_u8 oldest_entry_idx = 0;
+    sfx_u8 mac_idx = 0;
+    sfx_u8 byte_idx = 0;
+    // Directly exit if the history is disabled or if the payload is empty.
+    if (((context->history_mode) == SIGFOX_EP_ADDON_AW_API_HISTORY_MODE_NONE) || (nb_mac_ul_payload == 0)) {
+        return;
+    }
+    // Age all entries and free the expired ones (including the invalid ages of a restored history).
+    for (entry_idx = 0; entry_idx < SIGFOX_EP_ADDON_AW_API_HISTORY_SIZE; entry_idx++) {
+        entry = &(context->history[entry_idx]);
+        if ((entry->age) == SIGFOX_EP_ADDON_AW_API_HISTORY_AGE_NONE) continue;
+        entry->age = ((entry->age) >= (context->history_age_max)) ? SIGFOX_EP_ADDON_AW_API_HISTORY_AGE_NONE : (sfx_u8) ((entry->age) + 1);
+    }
+    // Insert the MAC addresses of the payload, replacing a free entry or the least recently sent one.
+    for (mac_idx = 0; mac_idx < nb_mac_ul_payload; mac_idx++) {
+        _history_get_key(&(ul_payload[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES * mac_idx]), key);
+        entry_idx = _history_search(context, key);
+        if (entry_idx >= SIGFOX_EP_ADDON_AW_API_HISTORY_SIZE) {
+            oldest_entry_idx = 0;
+            for (entry_idx = 0; entry_idx < SIGFOX_EP_ADDON_AW_API_HISTORY_SIZE; entry_idx++) {
+                if ((context->history[entry_idx].age) == SIGFOX_EP_ADDON_AW_API_HISTORY_AGE_NONE) break;
+                if ((context->history[entry_idx].age) > (context->history[oldest_entry_idx].age)) {
+                    oldest_entry_idx = entry_idx;
+                }
+            }
+            if (entry_idx >= SIGFOX_EP_ADDON_AW_API_HISTORY_SIZE) {
+                entry_idx = oldest_entry_idx;
+            }
+        }
+        entry = &(context->history[entry_idx]);
+        for (byte_idx = 0; byte_idx < SIGFOX_EP_ADDON_AW_API_HISTORY_KEY_SIZE_BYTES; byte_idx++) {
+            entry->key[byte_idx] = key[byte_idx];
+        }
+        entry->age = 1;
+    }
+}
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_SORTING) || (defined SIGFOX_EP_ADDON_AW_SORTING_NONE))
+/*******************************************************************/
+static void _sort_none(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, SIGFOX_EP_ADDON_AW_API_index_t *best_index, SIGFOX_EP_ADDON_AW_API_index_t nb_best) {
+    // Unused parameter.
+    SIGFOX_UNUSED(context);
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_index_t ap_idx = 0;
+    SIGFOX_EP_ADDON_AW_API_index_t ap_select_count = 0;
+    // Loop on all access points.
+    for (ap_idx = 0; ap_idx < (input_data->access_point_list_size); ap_idx++) {
+        if (ap_select_count >= nb_best) {
+            break;
+        }
+        // Select elements in initial list order.
+        if (SIGFOX_EP_ADDON_AW_API_IS_SELECTABLE(input_data->access_point_list[ap_idx]->status)) {
+            best_index[ap_select_count] = ap_idx;
+            ap_select_count++;
+        }
+    }
+}
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_SORTING) || (defined SIGFOX_EP_ADDON_AW_SORTING_RSSI))
+/*******************************************************************/
+static void _sort_rssi(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, SIGFOX_EP_ADDON_AW_API_index_t *best_index, SIGFOX_EP_ADDON_AW_API_index_t nb_best) {
+    // Unused parameter.
+    SIGFOX_UNUSED(context);
+    // Local variables.
+    sfx_s16 rssi_dbm = 0;
+    SIGFOX_EP_ADDON_AW_API_index_t ap_idx = 0;
+    SIGFOX_EP_ADDON_AW_API_index_t ap_select_count = 0;
+    SIGFOX_EP_ADDON_AW_API_index_t idx = 0;
+    // Single pass on all access points, keeping the best ones in a sorted insertion buffer.
+    for (ap_idx = 0; ap_idx < (input_data->access_point_list_size); ap_idx++) {
+        // Directly exit if the access point has been filtered out.
+        if (!(SIGFOX_EP_ADDON_AW_API_IS_SELECTABLE(input_data->access_point_list[ap_idx]->status))) continue;
+        rssi_dbm = (input_data->access_point_list[ap_idx]->rssi_dbm);
+        // Directly exit if the buffer is full and the access point is not better than the last one.
+        if ((ap_select_count >= nb_best) && (rssi_dbm <= (input_data->access_point_list[best_index[nb_best - 1]]->rssi_dbm))) continue;
+        // Insert element (strict comparison keeps the list order in case of equal RSSI).
+        idx = (ap_select_count < nb_best) ? ap_select_count : (nb_best - 1);
+        while ((idx > 0) && (rssi_dbm > (input_data->access_point_list[best_index[idx - 1]]->rssi_dbm))) {
+            best_index[idx] = best_index[idx - 1];
+            idx--;
+        }
+        best_index[idx] = ap_idx;
+        if (ap_select_count < nb_best) {
+            ap_select_count++;
+        }
+    }
+}
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_SORTING) || (defined SIGFOX_EP_ADDON_AW_SORTING_SCANS))
+/*******************************************************************/
+static sfx_s32 _get_scans_sort_key(SIGFOX_EP_ADDON_AW_API_access_point_t *access_point) {
+    // Scans count first, then RSSI.
+    return ((((sfx_s32) (access_point->nb_scans)) << 16) + ((sfx_s32) (access_point->rssi_dbm)));
+}
+
+/*******************************************************************/
+static void _sort_scans(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, SIGFOX_EP_ADDON_AW_API_index_t *best_index, SIGFOX_EP_ADDON_AW_API_index_t nb_best) {
+    // Unused parameter.
+    SIGFOX_UNUSED(context);
+    // Local variables.
+    sfx_s32 sort_key = 0;
+    SIGFOX_EP_ADDON_AW_API_index_t ap_idx = 0;
+    SIGFOX_EP_ADDON_AW_API_index_t ap_select_count = 0;
+    SIGFOX_EP_ADDON_AW_API_index_t idx = 0;
+    // Same single pass as the RSSI sorting, on the scans count and RSSI key.
+    for (ap_idx = 0; ap_idx < (input_data->access_point_list_size); ap_idx++) {
+        // Directly exit if the access point has been filtered out.
+        if (!(SIGFOX_EP_ADDON_AW_API_IS_SELECTABLE(input_data->access_point_list[ap_idx]->status))) continue;
+        sort_key = _get_scans_sort_key(input_data->access_point_list[ap_idx]);
+        // Directly exit if the buffer is full and the access point is not better than the last one.
+        if ((ap_select_count >= nb_best) && (sort_key <= _get_scans_sort_key(input_data->access_point_list[best_index[nb_best - 1]]))) continue;
+        // Insert element (strict comparison keeps the list order in case of equal key).
+        idx = (ap_select_count < nb_best) ? ap_select_count : (nb_best - 1);
+        while ((idx > 0) && (sort_key > _get_scans_sort_key(input_data->access_point_list[best_index[idx - 1]]))) {
+            best_index[idx] = best_index[idx - 1];
+            idx--;
+        }
+        best_index[idx] = ap_idx;
+        if (ap_select_count < nb_best) {
+            ap_select_count++;
+        }
+    }
+}
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_SORTING) || (defined SIGFOX_EP_ADDON_AW_SORTING_DEVICES))
+/*******************************************************************/
+static sfx_bool _mac_address_is_same_device(sfx_u8 *mac_address_bytes_1, sfx_u8 *mac_address_bytes_2) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    // Compare the MAC addresses without the last byte and the U/L bit.
+    if (((mac_address_bytes_1[SIGFOX_EP_ADDON_AW_API_UL_BYTE_INDEX] ^ mac_address_bytes_2[SIGFOX_EP_ADDON_AW_API_UL_BYTE_INDEX]) & (~SIGFOX_EP_ADDON_AW_API_UL_BIT_MASK)) != 0) {
+        return SIGFOX_FALSE;
+    }
+    for (idx = 1; idx < SIGFOX_EP_ADDON_AW_API_DEVICE_PREFIX_SIZE_BYTES; idx++) {
+        if (mac_address_bytes_1[idx] != mac_address_bytes_2[idx]) {
+            return SIGFOX_FALSE;
+        }
+    }
+    return SIGFOX_TRUE;
+}
+
+/*******************************************************************/
+static void _sort_devices_add_spare(SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, SIGFOX_EP_ADDON_AW_API_index_t *best_index, SIGFOX_EP_ADDON_AW_API_index_t nb_best, SIGFOX_EP_ADDON_AW_API_index_t nb_devices, SIGFOX_EP_ADDON_AW_API_index_t *nb_spares, SIGFOX_EP_ADDON_AW_API_index_t ap_idx) {
+    // Local variables.
+    sfx_s16 rssi_dbm = (input_data->access_point_list[ap_idx]->rssi_dbm);
+    SIGFOX_EP_ADDON_AW_API_index_t idx = 0;
+    // Spares are stored at the end of the buffer, in increasing RSSI order (so that the worst one is the first to be overwritten by a device).
+    if ((nb_devices + (*nb_spares)) < nb_best) {
+        (*nb_spares)++;
+    }
+    else if (((*nb_spares) == 0) || (rssi_dbm <= (input_data->access_point_list[best_index[nb_best - (*nb_spares)]]->rssi_dbm))) {
+        return;
+    }
+    else {
+        // Drop the worst spare.
+        for (idx = (nb_best - (*nb_spares)); idx < (nb_best - 1); idx++) {
+            if (rssi_dbm <= (input_data->access_point_list[best_index[idx + 1]]->rssi_dbm)) break;
+            best_index[idx] = best_index[idx + 1];
+        }
+        best_index[idx] = ap_idx;
+        return;
+    }
+    // Insert element (non-strict comparison keeps the list order in case of equal RSSI).
+    idx = (nb_best - (*nb_spares));
+    while ((idx < (nb_best - 1)) && (rssi_dbm > (input_data->access_point_list[best_index[idx + 1]]->rssi_dbm))) {
+        best_index[idx] = best_index[idx + 1];
+        idx++;
+    }
+    best_index[idx] = ap_idx;
+}
+
+/*******************************************************************/
+static void _sort_devices(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, SIGFOX_EP_ADDON_AW_API_index_t *best_index, SIGFOX_EP_ADDON_AW_API_index_t nb_best) {
+    // Unused parameter.
+    SIGFOX_UNUSED(context);
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_point = SIGFOX_NULL;
+    SIGFOX_EP_ADDON_AW_API_index_t spare_idx = 0;
+    SIGFOX_EP_ADDON_AW_API_index_t ap_idx = 0;
+    SIGFOX_EP_ADDON_AW_API_index_t nb_devices = 0;
+    SIGFOX_EP_ADDON_AW_API_index_t nb_spares = 0;
+    SIGFOX_EP_ADDON_AW_API_index_t idx = 0;
+    // Single pass keeping the best access point of each device at the beginning of the buffer (as the RSSI sorting does).
+    // While there are less devices than places, the other access points are kept at the end of the buffer to fill the payloads.
+    for (ap_idx = 0; ap_idx < (input_data->access_point_list_size); ap_idx++) {
+        access_point = (input_data->access_point_list[ap_idx]);
+        // Directly exit if the access point has been filtered out.
+        if ((access_point->status) != SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID) continue;
+        // Search the device of the access point in the selected ones.
+        for (idx = 0; idx < nb_devices; idx++) {
+            if (_mac_address_is_same_device((input_data->access_point_list[best_index[idx]]->mac_address_bytes), (access_point->mac_address_bytes)) == SIGFOX_TRUE) break;
+        }
+        if (idx < nb_devices) {
+            spare_idx = ap_idx;
+            // Keep the best access point of the device (strict comparison keeps the list order in case of equal RSSI).
+            if ((access_point->rssi_dbm) > (input_data->access_point_list[best_index[idx]]->rssi_dbm)) {
+                spare_idx = best_index[idx];
+                while ((idx > 0) && ((access_point->rssi_dbm) > (input_data->access_point_list[best_index[idx - 1]]->rssi_dbm))) {
+                    best_index[idx] = best_index[idx - 1];
+                    idx--;
+                }
+                best_index[idx] = ap_idx;
+            }
+            // Spares are only needed while there are less devices than places.
+            if (nb_devices < nb_best) {
+                _sort_devices_add_spare(input_data, best_index, nb_best, nb_devices, &nb_spares, spare_idx);
+            }
+            continue;
+        }
+        // New device: directly exit if the buffer is full and the access point is not better than the last one.
+        if ((nb_devices >= nb_best) && ((access_point->rssi_dbm) <= (input_data->access_point_list[best_index[nb_best - 1]]->rssi_dbm))) continue;
+        // Overwrite the worst spare if needed.
+        if ((nb_devices < nb_best) && ((nb_devices + nb_spares) >= nb_best)) {
+            nb_spares--;
+        }
+        // Insert element (strict comparison keeps the list order in case of equal RSSI).
+        idx = (nb_devices < nb_best) ? nb_devices : (nb_best - 1);
+        while ((idx > 0) && ((access_point->rssi_dbm) > (input_data->access_point_list[best_index[idx - 1]]->rssi_dbm))) {
+            best_index[idx] = best_index[idx - 1];
+            idx--;
+        }
+        best_index[idx] = ap_idx;
+        if (nb_devices < nb_best) {
+            nb_devices++;
+        }
+    }
+    // Fall back on the other access points of the selected devices, in decreasing RSSI order.
+    for (idx = 0; idx < (nb_spares / 2); idx++) {
+        spare_idx = best_index[nb_best - nb_spares + idx];
+        best_index[nb_best - nb_spares + idx] = best_index[nb_best - 1 - idx];
+        best_index[nb_best - 1 - idx] = spare_idx;
+    }
+    for (idx = 0; idx < nb_spares; idx++) {
+        best_index[nb_devices + idx] = best_index[nb_best - nb_spares + idx];
+    }
+    for (idx = (nb_devices + nb_spares); idx < nb_best; idx++) {
+        best_index[idx] = SIGFOX_EP_ADDON_AW_API_BEST_INDEX_NONE;
+    }
+}
+#endif
+
+/*******************************************************************/
+static void _sort(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, SIGFOX_EP_ADDON_AW_API_index_t *best_index, SIGFOX_EP_ADDON_AW_API_index_t nb_best) {
+#if (defined SIGFOX_EP_ADDON_AW_STATIC_SORTING) && (defined SIGFOX_EP_ADDON_AW_SORTING_NONE)
+    _sort_none(context, input_data, best_index, nb_best);
+#elif (defined SIGFOX_EP_ADDON_AW_STATIC_SORTING) && (defined SIGFOX_EP_ADDON_AW_SORTING_RSSI)
+    _sort_rssi(context, input_data, best_index, nb_best);
+#elif (defined SIGFOX_EP_ADDON_AW_STATIC_SORTING) && (defined SIGFOX_EP_ADDON_AW_SORTING_SCANS)
+    _sort_scans(context, input_data, best_index, nb_best);
+#elif (defined SIGFOX_EP_ADDON_AW_STATIC_SORTING) && (defined SIGFOX_EP_ADDON_AW_SORTING_DEVICES)
+    _sort_devices(context, input_data, best_index, nb_best);
+#else
+    SIGFOX_EP_ADDON_AW_API_SORT[context->sorting](context, input_data, best_index, nb_best);
+#endif
+}
+
+/*******************************************************************/
+static SIGFOX_EP_ADDON_AW_API_status_t _sort_list(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    sfx_u8 idx = 0;
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+    sfx_u32 timestamp = 0;
+#endif
+    SIGFOX_EP_ADDON_AW_API_TIMING_START(context, timestamp);
+    // Reset selected indexes.
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD; idx++) {
+        context->best_index[idx] = SIGFOX_EP_ADDON_AW_API_BEST_INDEX_NONE;
+    }
+    // Execute sorting function.
+    _sort(context, input_data, (context->best_index), SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD);
+    SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, SIGFOX_EP_ADDON_AW_API_STAGE_SORTING, timestamp);
+    SIGFOX_RETURN();
+}
+
+#ifdef SIGFOX_EP_ADDON_AW_LAZY_FILTERS
+/*******************************************************************/
+static SIGFOX_EP_ADDON_AW_API_status_t _lazy_prefilter_list(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_point;
+    SIGFOX_EP_ADDON_AW_API_index_t ap_idx = 0;
+    sfx_u8 ascii_character = SIGFOX_EP_ADDON_AW_API_NULL_CHAR;
+    sfx_u8 nibble = 0;
+    sfx_bool new_candidate = SIGFOX_FALSE;
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+    sfx_u32 timestamp = 0;
+#endif
+#if ((defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) && !(defined SIGFOX_EP_ADDON_AW_FILTER_RSSI_MIN))
+    // Unused parameter.
+    SIGFOX_UNUSED(context);
+#endif
+    SIGFOX_EP_ADDON_AW_API_TIMING_START(context, timestamp);
+    // Loop on all access points.
+    for (ap_idx = 0; ap_idx < (input_data->access_point_list_size); ap_idx++) {
+        // Update access point pointer.
+        access_point = (input_data->access_point_list[ap_idx]);
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+        if (access_point == SIGFOX_NULL) {
+            SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+        }
+#endif
+        // Check if access point has not already been processed.
+        if (access_point->status != SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_NEW) {
+            continue;
+        }
+        access_point->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_FILTERED_OUT;
+        // Filters which do not need the MAC address decoding.
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_RSSI_MIN))
+        if ((SIGFOX_EP_ADDON_AW_API_FILTER_IS_ENABLED(context, SIGFOX_EP_ADDON_AW_API_FILTER_RSSI_MIN)) && ((access_point->rssi_dbm) < (context->rssi_min_dbm))) continue;
+#endif
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_SSID_EMPTY))
+        if ((SIGFOX_EP_ADDON_AW_API_FILTER_IS_ENABLED(context, SIGFOX_EP_ADDON_AW_API_FILTER_SSID_EMPTY)) && ((access_point->ssid[0]) == SIGFOX_EP_ADDON_AW_API_NULL_CHAR)) continue;
+#endif
+        // The IG and UL bits are both in the second character: decode this single nibble (the other characters are checked when decoding the whole address).
+        ascii_character = (access_point->mac_address[1]);
+        nibble = (sfx_u8) ((ascii_character & 0x0F) + ((ascii_character >= 'A') ? 9 : 0));
+        if (((ascii_character >= '0') && (ascii_character <= '9')) || (((ascii_character | SIGFOX_EP_ADDON_AW_UPPERCASE_OFFSET) >= 'a') && ((ascii_character | SIGFOX_EP_ADDON_AW_UPPERCASE_OFFSET) <= 'f'))) {
+            if ((nibble & SIGFOX_EP_ADDON_AW_API_IG_BIT_MASK) != 0) continue;
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_LOCALLY_ADMINISTERED))
+            if ((SIGFOX_EP_ADDON_AW_API_FILTER_IS_ENABLED(context, SIGFOX_EP_ADDON_AW_API_FILTER_LOCALLY_ADMINISTERED)) && ((nibble & SIGFOX_EP_ADDON_AW_API_UL_BIT_MASK) != 0)) continue;
+#endif
+        }
+        access_point->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_PENDING;
+        new_candidate = SIGFOX_TRUE;
+    }
+    // A new candidate may be a better duplicate of an access point which has already been evaluated.
+    if (new_candidate == SIGFOX_TRUE) {
+        for (ap_idx = 0; ap_idx < (input_data->access_point_list_size); ap_idx++) {
+            access_point = (input_data->access_point_list[ap_idx]);
+            if ((access_point->status) == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID) {
+                access_point->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_PENDING;
+            }
+        }
+    }
+    SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, SIGFOX_EP_ADDON_AW_API_STAGE_MANDATORY_FILTERS, timestamp);
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+static SIGFOX_EP_ADDON_AW_API_status_t _lazy_filter_access_point(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_bool *access_point_is_valid) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    // Reset result.
+    (*access_point_is_valid) = SIGFOX_FALSE;
+    access_point->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_FILTERED_OUT;
+    // Convert ASCII to bytes array.
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _mac_address_ascii_to_bytes_array((access_point->mac_address), (access_point->mac_address_bytes));
+    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
+#else
+    _mac_address_ascii_to_bytes_array((access_point->mac_address), (access_point->mac_address_bytes));
+#endif
+    // Filters which need the MAC address decoding, then the SSID black list (the most expensive one).
+    (*access_point_is_valid) = ((_mac_address_is_reserved(access_point->mac_address_bytes) == SIGFOX_TRUE) || (_mac_address_is_multicast(access_point->mac_address_bytes) == SIGFOX_TRUE)) ? SIGFOX_FALSE : SIGFOX_TRUE;
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_LOCALLY_ADMINISTERED))
+    if (((*access_point_is_valid) == SIGFOX_TRUE) && (SIGFOX_EP_ADDON_AW_API_FILTER_IS_ENABLED(context, SIGFOX_EP_ADDON_AW_API_FILTER_LOCALLY_ADMINISTERED)) && (_mac_address_is_locally_administered(access_point->mac_address_bytes) == SIGFOX_TRUE)) {
+        (*access_point_is_valid) = SIGFOX_FALSE;
+    }
+#endif
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST))
+    if (((*access_point_is_valid) == SIGFOX_TRUE) && (SIGFOX_EP_ADDON_AW_API_FILTER_IS_ENABLED(context, SIGFOX_EP_ADDON_AW_API_FILTER_OUI_BLACK_LIST)) && (_oui_is_black_listed((context->oui_black_list), (access_point->mac_address_bytes)) == SIGFOX_TRUE)) {
+        (*access_point_is_valid) = SIGFOX_FALSE;
+    }
+#endif
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST))
+    if (((*access_point_is_valid) == SIGFOX_TRUE) && (SIGFOX_EP_ADDON_AW_API_FILTER_IS_ENABLED(context, SIGFOX_EP_ADDON_AW_API_FILTER_SSID_BLACK_LIST)) && (_ssid_is_black_listed((context->ssid_black_list), (access_point->ssid)) == SIGFOX_TRUE)) {
+        (*access_point_is_valid) = SIGFOX_FALSE;
+    }
+#endif
+    // The access point stays pending until its duplicates have been checked.
+    if ((*access_point_is_valid) == SIGFOX_TRUE) {
+        access_point->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_PENDING;
+    }
+#if ((defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) && !(defined SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST) && !(defined SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST))
+    SIGFOX_UNUSED(context);
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+static sfx_bool _mac_address_ascii_is_equal(sfx_u8 *mac_address_ascii_1, sfx_u8 *mac_address_ascii_2) {
+    // Local variables.
+    sfx_u8 char_idx = 0;
+    // Compare digits from the end (the first ones are mostly the manufacturer identifier), case insensitive and without the separators.
+    for (char_idx = SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR; char_idx > 0; char_idx--) {
+        if ((char_idx % 3) == 0) continue;
+        if (((mac_address_ascii_1[char_idx - 1]) | SIGFOX_EP_ADDON_AW_UPPERCASE_OFFSET) != ((mac_address_ascii_2[char_idx - 1]) | SIGFOX_EP_ADDON_AW_UPPERCASE_OFFSET)) {
+            return SIGFOX_FALSE;
+        }
+    }
+    return SIGFOX_TRUE;
+}
+
+/*******************************************************************/
+static SIGFOX_EP_ADDON_AW_API_status_t _lazy_evaluate_access_point(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, SIGFOX_EP_ADDON_AW_API_index_t ap_idx) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_point = (input_data->access_point_list[ap_idx]);
+    SIGFOX_EP_ADDON_AW_API_access_point_t *other_access_point;
+    SIGFOX_EP_ADDON_AW_API_index_t other_ap_idx = 0;
+    sfx_bool access_point_is_valid = SIGFOX_FALSE;
+    sfx_bool other_access_point_is_valid = SIGFOX_FALSE;
+    sfx_bool other_access_point_is_better = SIGFOX_FALSE;
+    sfx_bool duplicate_found = SIGFOX_FALSE;
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+    sfx_u32 timestamp = 0;
+#endif
+    SIGFOX_EP_ADDON_AW_API_TIMING_START(context, timestamp);
+    // Apply the remaining filters.
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lazy_filter_access_point(context, access_point, &access_point_is_valid);
+    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
+#else
+    _lazy_filter_access_point(context, access_point, &access_point_is_valid);
+#endif
+    SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, SIGFOX_EP_ADDON_AW_API_STAGE_MAC_ADDRESS_DECODING, timestamp);
+    if (access_point_is_valid == SIGFOX_FALSE) goto errors;
+    // Compare with all the other access points which are (or may be) valid, with the same rule as the list deduplication.
+    for (other_ap_idx = 0; other_ap_idx < (input_data->access_point_list_size); other_ap_idx++) {
+        other_access_point = (input_data->access_point_list[other_ap_idx]);
+        if ((other_ap_idx == ap_idx) || (((other_access_point->status) != SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID) && ((other_access_point->status) != SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_SENT) && ((other_access_point->status) != SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_PENDING))) continue;
+        if (_mac_address_ascii_is_equal((access_point->mac_address), (other_access_point->mac_address)) == SIGFOX_FALSE) continue;
+        // Keep the sent access point, otherwise the best RSSI (the first one in case of equal RSSI).
+        other_access_point_is_better = SIGFOX_FALSE;
+        if (((other_access_point->status) == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_SENT) || ((other_access_point->rssi_dbm) > (access_point->rssi_dbm)) || (((other_access_point->rssi_dbm) == (access_point->rssi_dbm)) && (other_ap_idx < ap_idx))) {
+            other_access_point_is_better = SIGFOX_TRUE;
+        }
+        if (other_access_point_is_better == SIGFOX_FALSE) {
+            if ((other_access_point->status) == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID) {
+                other_access_point->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_DUPLICATE;
+            }
+            continue;
+        }
+        // A better access point only removes this one if it is valid itself.
+        if ((other_access_point->status) == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_PENDING) {
+#ifdef SIGFOX_EP_ERROR_CODES
+            status = _lazy_filter_access_point(context, other_access_point, &other_access_point_is_valid);
+            SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
+#else
+            _lazy_filter_access_point(context, other_access_point, &other_access_point_is_valid);
+#endif
+            if (other_access_point_is_valid == SIGFOX_FALSE) continue;
+        }
+        duplicate_found = SIGFOX_TRUE;
+    }
+    access_point->status = (duplicate_found == SIGFOX_TRUE) ? SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_DUPLICATE : SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID;
+    SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, SIGFOX_EP_ADDON_AW_API_STAGE_DEDUPLICATION, timestamp);
+errors:
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+static SIGFOX_EP_ADDON_AW_API_status_t _lazy_select_list(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    SIGFOX_EP_ADDON_AW_API_index_t best_idx = 0;
+    sfx_bool selection_is_valid = SIGFOX_FALSE;
+    sfx_u8 round_idx = 0;
+    sfx_u8 idx = 0;
+    // Cheap filters on all the new access points.
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lazy_prefilter_list(context, input_data);
+    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
+#else
+    _lazy_prefilter_list(context, input_data);
+#endif
+    // The devices sorting needs the decoded MAC addresses of all the candidates.
+#if (defined SIGFOX_EP_ADDON_AW_STATIC_SORTING) && (defined SIGFOX_EP_ADDON_AW_SORTING_DEVICES)
+    round_idx = SIGFOX_EP_ADDON_AW_API_LAZY_ROUNDS_MAX;
+#elif !(defined SIGFOX_EP_ADDON_AW_STATIC_SORTING)
+    if ((context->sorting) == SIGFOX_EP_ADDON_AW_API_SORTING_DEVICES) {
+        round_idx = SIGFOX_EP_ADDON_AW_API_LAZY_ROUNDS_MAX;
+    }
+#endif
+    // Sort the candidates and only evaluate the selected ones, until the selection does not change anymore.
+    for (; round_idx < SIGFOX_EP_ADDON_AW_API_LAZY_ROUNDS_MAX; round_idx++) {
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _sort_list(context, input_data);
+        SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
+#else
+        _sort_list(context, input_data);
+#endif
+        selection_is_valid = SIGFOX_TRUE;
+        for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD; idx++) {
+            best_idx = context->best_index[idx];
+            if (best_idx == SIGFOX_EP_ADDON_AW_API_BEST_INDEX_NONE) continue;
+            // The access point may also have been rejected while evaluating the previous one.
+            if ((input_data->access_point_list[best_idx]->status) == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_PENDING) {
+#ifdef SIGFOX_EP_ERROR_CODES
+                status = _lazy_evaluate_access_point(context, input_data, best_idx);
+                SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
+#else
+                _lazy_evaluate_access_point(context, input_data, best_idx);
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+                // Set aside the access point if it has been sent in the previous messages.
+                if (((input_data->access_point_list[best_idx]->status) == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID) && (_history_get_age(context, (input_data->access_point_list[best_idx]->mac_address_bytes)) != SIGFOX_EP_ADDON_AW_API_HISTORY_AGE_NONE)) {
+                    input_data->access_point_list[best_idx]->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_RECENT;
+                }
+#endif
+            }
+            if ((input_data->access_point_list[best_idx]->status) != SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID) {
+                selection_is_valid = SIGFOX_FALSE;
+            }
+        }
+        if (selection_is_valid == SIGFOX_TRUE) goto errors;
+    }
+    // Too many rejected candidates: evaluate all the remaining access points at once.
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _filter_list(context, input_data);
+    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
+#else
+    _filter_list(context, input_data);
+#endif
+    _deduplicate_list(context, input_data);
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+    _history_mark_list(context, input_data);
+#endif
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _sort_list(context, input_data);
+    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
+#else
+    _sort_list(context, input_data);
+#endif
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+/*******************************************************************/
+static void _reset_ul_payload(sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload) {
+    // Local variables.
+    sfx_u8 byte_idx = 0;
+    // Reset payload and MAC address count.
+    for (byte_idx = 0; byte_idx < SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES; byte_idx ++) {
+        ul_payload[byte_idx] = 0x00;
+    }
+    (*nb_mac_ul_payload) = 0;
+}
+
+/*******************************************************************/
+static void _encode_mac_address(sfx_u8 *mac_address_bytes, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload) {
+    // Local variables.
+    sfx_u8 byte_idx = 0;
+    // Fill payload with the MAC address decoded during filtering.
+    for (byte_idx = 0; byte_idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES; byte_idx++) {
+        ul_payload[(SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES * (*nb_mac_ul_payload)) + byte_idx] = mac_address_bytes[byte_idx];
+    }
+    // Update MAC address count.
+    (*nb_mac_ul_payload)++;
+}
+
+/*******************************************************************/
+static void _encode_access_point(SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload) {
+    // Fill payload.
+    _encode_mac_address((access_point->mac_address_bytes), ul_payload, nb_mac_ul_payload);
+    // Update access point status.
+    access_point->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_SENT;
+}
+
+/*******************************************************************/
+static void _encode_selection(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_index_t best_idx = 0;
+    sfx_u8 ap_idx = 0;
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+    sfx_u32 timestamp = 0;
+#endif
+    SIGFOX_EP_ADDON_AW_API_TIMING_START(context, timestamp);
+    // Select the best indexes (after the MAC addresses which are already in the payload).
+    for (ap_idx = 0; ap_idx < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD; ap_idx++) {
+        if ((*nb_mac_ul_payload) >= SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD) break;
+        // Read best index.
+        best_idx = context->best_index[ap_idx];
+        // Check best index.
+        if (best_idx != SIGFOX_EP_ADDON_AW_API_BEST_INDEX_NONE) {
+            _encode_access_point((input_data->access_point_list[best_idx]), ul_payload, nb_mac_ul_payload);
+        }
+    }
+    SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, SIGFOX_EP_ADDON_AW_API_STAGE_ENCODING, timestamp);
+}
+
+/*******************************************************************/
+static SIGFOX_EP_ADDON_AW_API_status_t _build_ul_payload(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+    sfx_u8 age = 0;
+#endif
+    // Reset payload and MAC address count.
+    _reset_ul_payload(ul_payload, nb_mac_ul_payload);
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check input data.
+    if (input_data->access_point_list == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+    if (input_data->access_point_list_size == 0) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_ACCESS_POINT_LIST_SIZE);
+    }
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_LAZY_FILTERS
+    // Only evaluate the access points which can be selected.
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _lazy_select_list(context, input_data);
+    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
+#else
+    _lazy_select_list(context, input_data);
+#endif
+#else
+    // Apply filters.
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _filter_list(context, input_data);
+    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
+#else
+    _filter_list(context, input_data);
+#endif
+    // Remove duplicated MAC addresses.
+    _deduplicate_list(context, input_data);
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+    // Set aside the access points sent in the previous messages.
+    _history_mark_list(context, input_data);
+#endif
+    // Sort list.
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _sort_list(context, input_data);
+    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
+#else
+    _sort_list(context, input_data);
+#endif
+#endif
+    // Encode the selected access points.
+    _encode_selection(context, input_data, ul_payload, nb_mac_ul_payload);
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+    // Complete the payload with the least recently sent access points if there are not enough new ones (no pending access point remains in this case).
+    if ((context->history_mode) == SIGFOX_EP_ADDON_AW_API_HISTORY_MODE_PENALIZE) {
+        for (age = (context->history_age_max); (age > 0) && ((*nb_mac_ul_payload) < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD); age--) {
+            if (_history_release_list(context, input_data, age) == SIGFOX_FALSE) continue;
+            _deduplicate_list(context, input_data);
+#ifdef SIGFOX_EP_ERROR_CODES
+            status = _sort_list(context, input_data);
+            SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
+#else
+            _sort_list(context, input_data);
+#endif
+            _encode_selection(context, input_data, ul_payload, nb_mac_ul_payload);
+        }
+    }
+    // Remember the sent MAC addresses.
+    _history_add_ul_payload(context, ul_payload, (*nb_mac_ul_payload));
+#endif
+    // Check if at least one valid MAC address has been found.
+    if ((*nb_mac_ul_payload) == 0) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NONE_VALID_ACCESS_POINT);
+    }
+errors:
+    SIGFOX_RETURN();
+}
+
+#ifdef SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD
+/*******************************************************************/
+static sfx_u32 _compact_get_key(const SIGFOX_EP_ADDON_AW_API_oui_table_t *compact_dictionary, sfx_u8 *mac_address_bytes, sfx_u8 nb_nic_bits) {
+    // Local variables.
+    sfx_u32 oui_hash = 0;
+    sfx_u32 nic = 0;
+    sfx_u16 oui_code = 0;
+    sfx_u16 nb_ouis = 0;
+    // The OUIs of the dictionary are coded by their index.
+    if (_oui_table_search(compact_dictionary, mac_address_bytes, &oui_code) == SIGFOX_FALSE) {
+        // The other OUIs are hashed on the remaining codes (32-bits product whatever the size of the sfx_u32 type).
+        nb_ouis = (compact_dictionary == SIGFOX_NULL) ? 0 : (compact_dictionary->nb_ouis);
+        oui_hash = (((_oui_get_key(mac_address_bytes) * SIGFOX_EP_ADDON_AW_API_COMPACT_OUI_HASH_FACTOR) & 0xFFFFFFFFUL) >> 16);
+        oui_code = (sfx_u16) (nb_ouis + ((oui_hash * (sfx_u32) (SIGFOX_EP_ADDON_AW_API_COMPACT_NB_OUI_CODES - nb_ouis)) >> 16));
+    }
+    // Keep the last NIC bits, which differ the most between neighbour access points.
+    nic = _oui_get_key(&(mac_address_bytes[SIGFOX_EP_ADDON_AW_API_OUI_SIZE_BYTES]));
+    return ((((sfx_u32) oui_code) << nb_nic_bits) | (nic & ((1UL << nb_nic_bits) - 1)));
+}
+
+/*******************************************************************/
+static void _compact_write_bits(sfx_u8 *ul_payload, sfx_u8 *bit_idx, sfx_u32 value, sfx_u8 nb_bits) {
+    // Write the bits most significant first (the payload is already cleared).
+    while (nb_bits > 0) {
+        nb_bits--;
+        if (((value >> nb_bits) & 0x01) != 0) {
+            ul_payload[(*bit_idx) >> 3] |= (sfx_u8) (0x80 >> ((*bit_idx) & 0x07));
+        }
+        (*bit_idx)++;
+    }
+}
+
+/*******************************************************************/
+static sfx_u8 _compact_quantize_rssi(sfx_s16 rssi_dbm, sfx_u8 nb_rssi_bits) {
+    // Local variables.
+    sfx_s16 level = 0;
+    // Saturate on the quantized range.
+    if (rssi_dbm <= SIGFOX_EP_ADDON_AW_API_COMPACT_RSSI_FLOOR_DBM) {
+        return 0;
+    }
+    level = (sfx_s16) ((rssi_dbm - SIGFOX_EP_ADDON_AW_API_COMPACT_RSSI_FLOOR_DBM) >> (SIGFOX_EP_ADDON_AW_API_COMPACT_RSSI_RANGE_SIZE_BITS - nb_rssi_bits));
+    return (level >= (1 << nb_rssi_bits)) ? (sfx_u8) ((1 << nb_rssi_bits) - 1) : (sfx_u8) level;
+}
+
+/*******************************************************************/
+static SIGFOX_EP_ADDON_AW_API_status_t _build_ul_payload_compact(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, sfx_u8 *ul_payload, sfx_u8 *nb_access_points_ul_payload) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    SIGFOX_EP_ADDON_AW_API_index_t best_index[SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS];
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_point;
+    const SIGFOX_EP_ADDON_AW_API_compact_layout_t *layout;
+    sfx_u8 layout_idx = 0;
+    sfx_u8 nb_selected = 0;
+    sfx_u8 bit_idx = 0;
+    sfx_u8 idx = 0;
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+    sfx_u32 timestamp = 0;
+#endif
+    // Reset payload and access point count.
+    _reset_ul_payload(ul_payload, nb_access_points_ul_payload);
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check input data.
+    if (input_data->access_point_list == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+    if (input_data->access_point_list_size == 0) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_ACCESS_POINT_LIST_SIZE);
+    }
+#endif
+    // Apply filters (the lazy selection is limited to the Atlas WiFi payload size).
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _filter_list(context, input_data);
+    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
+#else
+    _filter_list(context, input_data);
+#endif
+    // Remove duplicated MAC addresses.
+    _deduplicate_list(context, input_data);
+    // Select the best access points.
+    SIGFOX_EP_ADDON_AW_API_TIMING_START(context, timestamp);
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS; idx++) {
+        best_index[idx] = SIGFOX_EP_ADDON_AW_API_BEST_INDEX_NONE;
+    }
+    _sort(context, input_data, best_index, SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS);
+    SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, SIGFOX_EP_ADDON_AW_API_STAGE_SORTING, timestamp);
+    SIGFOX_EP_ADDON_AW_API_TIMING_START(context, timestamp);
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS; idx++) {
+        if (best_index[idx] != SIGFOX_EP_ADDON_AW_API_BEST_INDEX_NONE) {
+            best_index[nb_selected] = best_index[idx];
+            nb_selected++;
+        }
+    }
+    if (nb_selected < SIGFOX_EP_ADDON_AW_API_COMPACT_NB_ACCESS_POINTS_MIN) {
+        // Standard Atlas WiFi payload.
+        for (idx = 0; idx < nb_selected; idx++) {
+            _encode_access_point((input_data->access_point_list[best_index[idx]]), ul_payload, nb_access_points_ul_payload);
+        }
+    }
+    else {
+        // Header giving the custom payload type, the format identifier and the layout.
+        layout_idx = (nb_selected > SIGFOX_EP_ADDON_AW_API_COMPACT_LAYOUT[0].nb_access_points) ? 1 : 0;
+        layout = &(SIGFOX_EP_ADDON_AW_API_COMPACT_LAYOUT[layout_idx]);
+        ul_payload[0] = (sfx_u8) (SIGFOX_EP_ADDON_AW_API_COMPACT_HEADER | (layout_idx << SIGFOX_EP_ADDON_AW_API_COMPACT_LAYOUT_BIT_INDEX));
+        bit_idx = SIGFOX_EP_ADDON_AW_API_COMPACT_HEADER_SIZE_BITS;
+        // Access points fields.
+        for (idx = 0; idx < (layout->nb_access_points); idx++) {
+            access_point = (input_data->access_point_list[best_index[idx]]);
+            _compact_write_bits(ul_payload, &bit_idx, _compact_get_key((context->compact_dictionary), (access_point->mac_address_bytes), (layout->nb_nic_bits)), (sfx_u8) (SIGFOX_EP_ADDON_AW_API_COMPACT_OUI_CODE_SIZE_BITS + (layout->nb_nic_bits)));
+            _compact_write_bits(ul_payload, &bit_idx, _compact_quantize_rssi((access_point->rssi_dbm), (layout->nb_rssi_bits)), (layout->nb_rssi_bits));
+            access_point->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_SENT;
+        }
+        (*nb_access_points_ul_payload) = (layout->nb_access_points);
+    }
+    SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, SIGFOX_EP_ADDON_AW_API_STAGE_ENCODING, timestamp);
+    // Check if at least one valid access point has been found.
+    if ((*nb_access_points_ul_payload) == 0) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NONE_VALID_ACCESS_POINT);
+    }
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#if ((defined SIGFOX_EP_ADDON_AW_PACKED_INPUT) || (defined SIGFOX_EP_ADDON_AW_STREAM))
+/*******************************************************************/
+static sfx_bool _is_sorted_by_rssi(SIGFOX_EP_ADDON_AW_API_context_t *context) {
+    // The scans count and the devices are not kept, so that scans and devices sortings give the RSSI order (as for a list which has not been aggregated).
+#if (defined SIGFOX_EP_ADDON_AW_STATIC_SORTING) && (defined SIGFOX_EP_ADDON_AW_SORTING_NONE)
+    SIGFOX_UNUSED(context);
+    return SIGFOX_FALSE;
+#elif (defined SIGFOX_EP_ADDON_AW_STATIC_SORTING)
+    SIGFOX_UNUSED(context);
+    return SIGFOX_TRUE;
+#else
+    return (((context->sorting) == SIGFOX_EP_ADDON_AW_API_SORTING_NONE) ? SIGFOX_FALSE : SIGFOX_TRUE);
+#endif
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_PACKED_INPUT
+/*******************************************************************/
+static void _packed_filter_list(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_packed_input_data_t *packed_input_data) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_packed_access_point_t *packed_access_point;
+    SIGFOX_EP_ADDON_AW_API_index_t ap_idx = 0;
+    sfx_u8 rejected_filters = 0;
+#ifdef SIGFOX_EP_ADDON_AW_STATIC_FILTERS
+    sfx_u8 filters = SIGFOX_EP_ADDON_AW_API_STATIC_FILTERS_MASK;
+#else
+    sfx_u8 filters = (context->filters);
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_STATISTICS
+    sfx_u8 filter_idx = 0;
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+    sfx_u32 timestamp = 0;
+#endif
+    SIGFOX_EP_ADDON_AW_API_TIMING_START(context, timestamp);
+    // Loop on all access points (MAC addresses and SSID flags have been computed when packing).
+    for (ap_idx = 0; ap_idx < (packed_input_data->packed_access_point_list_size); ap_idx++) {
+        packed_access_point = &(packed_input_data->packed_access_point_list[ap_idx]);
+        // Check if access point has not already been processed.
+        if (SIGFOX_EP_ADDON_AW_API_PACKED_GET_STATUS(packed_access_point) != SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_NEW) {
+            continue;
+        }
+        SIGFOX_EP_ADDON_AW_API_PACKED_SET_STATUS(packed_access_point, SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_FILTERED_OUT);
+        // Mandatory filters: do not keep reserved and multicast addresses.
+        if (_mac_address_is_reserved(packed_access_point->mac_address_bytes) == SIGFOX_TRUE) {
+            SIGFOX_EP_ADDON_AW_API_STATISTICS_INCREMENT(context, nb_reserved);
+            continue;
+        }
+        if (_mac_address_is_multicast(packed_access_point->mac_address_bytes) == SIGFOX_TRUE) {
+            SIGFOX_EP_ADDON_AW_API_STATISTICS_INCREMENT(context, nb_multicast);
+            continue;
+        }
+        // Optional filters: bit i is set if the filter i rejects the access point.
+        rejected_filters = 0;
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_LOCALLY_ADMINISTERED))
+        if (_mac_address_is_locally_administered(packed_access_point->mac_address_bytes) == SIGFOX_TRUE) {
+            rejected_filters |= (1 << SIGFOX_EP_ADDON_AW_API_FILTER_LOCALLY_ADMINISTERED);
+        }
+#endif
+        if (((packed_access_point->info) & SIGFOX_EP_ADDON_AW_API_PACKED_INFO_SSID_EMPTY) != 0) {
+            rejected_filters |= (1 << SIGFOX_EP_ADDON_AW_API_FILTER_SSID_EMPTY);
+        }
+        if (((packed_access_point->info) & SIGFOX_EP_ADDON_AW_API_PACKED_INFO_SSID_BLACK_LISTED) != 0) {
+            rejected_filters |= (1 << SIGFOX_EP_ADDON_AW_API_FILTER_SSID_BLACK_LIST);
+        }
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_RSSI_MIN))
+        if ((packed_access_point->rssi_dbm) < (context->rssi_min_dbm)) {
+            rejected_filters |= (1 << SIGFOX_EP_ADDON_AW_API_FILTER_RSSI_MIN);
+        }
+#endif
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST))
+        if ((((filters) & (1 << SIGFOX_EP_ADDON_AW_API_FILTER_OUI_BLACK_LIST)) != 0) && (_oui_is_black_listed((context->oui_black_list), (packed_access_point->mac_address_bytes)) == SIGFOX_TRUE)) {
+            rejected_filters |= (1 << SIGFOX_EP_ADDON_AW_API_FILTER_OUI_BLACK_LIST);
+        }
+#endif
+        rejected_filters &= filters;
+        if (rejected_filters != 0) {
+#ifdef SIGFOX_EP_ADDON_AW_STATISTICS
+            // Count the access point on the first failing filter, in the list path execution order.
+            for (filter_idx = 0; (rejected_filters & (1 << SIGFOX_EP_ADDON_AW_API_FILTER_ORDER[filter_idx])) == 0; filter_idx++);
+            SIGFOX_EP_ADDON_AW_API_STATISTICS_INCREMENT(context, nb_filtered_out[SIGFOX_EP_ADDON_AW_API_FILTER_ORDER[filter_idx]]);
+#endif
+            continue;
+        }
+        SIGFOX_EP_ADDON_AW_API_PACKED_SET_STATUS(packed_access_point, SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID);
+        SIGFOX_EP_ADDON_AW_API_STATISTICS_ADD_VALID(context, (packed_access_point->rssi_dbm));
+        context->deduplication_pending = SIGFOX_TRUE;
+    }
+    SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, SIGFOX_EP_ADDON_AW_API_STAGE_MANDATORY_FILTERS, timestamp);
+}
+
+/*******************************************************************/
+static void _packed_deduplicate_list(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_packed_input_data_t *packed_input_data) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_index_t table[SIGFOX_EP_ADDON_AW_API_DEDUPLICATION_TABLE_SIZE];
+    SIGFOX_EP_ADDON_AW_API_packed_access_point_t *packed_access_point;
+    SIGFOX_EP_ADDON_AW_API_packed_access_point_t *other_packed_access_point;
+    SIGFOX_EP_ADDON_AW_API_packed_access_point_t *duplicate_packed_access_point;
+    SIGFOX_EP_ADDON_AW_API_access_point_status_t access_point_status;
+    SIGFOX_EP_ADDON_AW_API_index_t ap_idx = 0;
+    sfx_u16 slot_idx = 0;
+    sfx_u16 probe_count = 0;
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+    sfx_u32 timestamp = 0;
+#endif
+    // Directly exit if no access point has been validated since the last call.
+    if ((context->deduplication_pending) == SIGFOX_FALSE) {
+        return;
+    }
+    context->deduplication_pending = SIGFOX_FALSE;
+    SIGFOX_EP_ADDON_AW_API_TIMING_START(context, timestamp);
+    // Reset table.
+    for (slot_idx = 0; slot_idx < SIGFOX_EP_ADDON_AW_API_DEDUPLICATION_TABLE_SIZE; slot_idx++) {
+        table[slot_idx] = SIGFOX_EP_ADDON_AW_API_BEST_INDEX_NONE;
+    }
+    // Same selection as the list path: the sent access point is kept, otherwise the best RSSI.
+    for (ap_idx = 0; ap_idx < (packed_input_data->packed_access_point_list_size); ap_idx++) {
+        packed_access_point = &(packed_input_data->packed_access_point_list[ap_idx]);
+        access_point_status = SIGFOX_EP_ADDON_AW_API_PACKED_GET_STATUS(packed_access_point);
+        if ((access_point_status != SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID) && (access_point_status != SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_SENT)) continue;
+        slot_idx = _mac_address_hash(packed_access_point->mac_address_bytes);
+        for (probe_count = 0; probe_count < SIGFOX_EP_ADDON_AW_API_DEDUPLICATION_TABLE_SIZE; probe_count++) {
+            // New MAC address.
+            if (table[slot_idx] == SIGFOX_EP_ADDON_AW_API_BEST_INDEX_NONE) {
+                table[slot_idx] = ap_idx;
+                break;
+            }
+            other_packed_access_point = &(packed_input_data->packed_access_point_list[table[slot_idx]]);
+            if (_mac_address_is_equal((packed_access_point->mac_address_bytes), (other_packed_access_point->mac_address_bytes)) == SIGFOX_TRUE) {
+                if (SIGFOX_EP_ADDON_AW_API_PACKED_GET_STATUS(other_packed_access_point) == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_SENT) {
+                    duplicate_packed_access_point = packed_access_point;
+                }
+                else if ((access_point_status == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_SENT) || ((packed_access_point->rssi_dbm) > (other_packed_access_point->rssi_dbm))) {
+                    duplicate_packed_access_point = other_packed_access_point;
+                    table[slot_idx] = ap_idx;
+                }
+                else {
+                    duplicate_packed_access_point = packed_access_point;
+                }
+                if (SIGFOX_EP_ADDON_AW_API_PACKED_GET_STATUS(duplicate_packed_access_point) == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID) {
+                    SIGFOX_EP_ADDON_AW_API_PACKED_SET_STATUS(duplicate_packed_access_point, SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_DUPLICATE);
+                    SIGFOX_EP_ADDON_AW_API_STATISTICS_INCREMENT(context, nb_duplicate);
+                }
+                break;
+            }
+            slot_idx = ((slot_idx + 1) & (SIGFOX_EP_ADDON_AW_API_DEDUPLICATION_TABLE_SIZE - 1));
+        }
+    }
+    SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, SIGFOX_EP_ADDON_AW_API_STAGE_DEDUPLICATION, timestamp);
+}
+
+/*******************************************************************/
+static void _packed_sort_list(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_packed_input_data_t *packed_input_data) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_packed_access_point_t *packed_access_point_list = (packed_input_data->packed_access_point_list);
+    SIGFOX_EP_ADDON_AW_API_index_t *best_index = (context->best_index);
+    sfx_s8 rssi_dbm = 0;
+    SIGFOX_EP_ADDON_AW_API_index_t ap_idx = 0;
+    SIGFOX_EP_ADDON_AW_API_index_t ap_select_count = 0;
+    SIGFOX_EP_ADDON_AW_API_index_t idx = 0;
+    sfx_bool sort_by_rssi = _is_sorted_by_rssi(context);
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+    sfx_u32 timestamp = 0;
+#endif
+    SIGFOX_EP_ADDON_AW_API_TIMING_START(context, timestamp);
+    // Reset selected indexes.
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD; idx++) {
+        best_index[idx] = SIGFOX_EP_ADDON_AW_API_BEST_INDEX_NONE;
+    }
+    // Single pass on all access points, keeping the best ones in a sorted insertion buffer.
+    for (ap_idx = 0; ap_idx < (packed_input_data->packed_access_point_list_size); ap_idx++) {
+        if (SIGFOX_EP_ADDON_AW_API_PACKED_GET_STATUS(&(packed_access_point_list[ap_idx])) != SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID) continue;
+        if (sort_by_rssi == SIGFOX_FALSE) {
+            // Select elements in initial list order.
+            best_index[ap_select_count] = ap_idx;
+            ap_select_count++;
+            if (ap_select_count >= SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD) break;
+            continue;
+        }
+        rssi_dbm = (packed_access_point_list[ap_idx].rssi_dbm);
+        if ((ap_select_count >= SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD) && (rssi_dbm <= (packed_access_point_list[best_index[SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD - 1]].rssi_dbm))) continue;
+        // Insert element (strict comparison keeps the list order in case of equal RSSI).
+        idx = (ap_select_count < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD) ? ap_select_count : (SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD - 1);
+        while ((idx > 0) && (rssi_dbm > (packed_access_point_list[best_index[idx - 1]].rssi_dbm))) {
+            best_index[idx] = best_index[idx - 1];
+            idx--;
+        }
+        best_index[idx] = ap_idx;
+        if (ap_select_count < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD) {
+            ap_select_count++;
+        }
+    }
+    SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, SIGFOX_EP_ADDON_AW_API_STAGE_SORTING, timestamp);
+}
+
+/*******************************************************************/
+static SIGFOX_EP_ADDON_AW_API_status_t _build_ul_payload_packed(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_packed_input_data_t *packed_input_data, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    SIGFOX_EP_ADDON_AW_API_packed_access_point_t *packed_access_point;
+    SIGFOX_EP_ADDON_AW_API_index_t best_idx = 0;
+    sfx_u8 ap_idx = 0;
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+    sfx_u32 timestamp = 0;
+#endif
+    // Reset payload and MAC address count.
+    _reset_ul_payload(ul_payload, nb_mac_ul_payload);
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check input data.
+    if (packed_input_data->packed_access_point_list == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+    if (packed_input_data->packed_access_point_list_size == 0) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_ACCESS_POINT_LIST_SIZE);
+    }
+#endif
+    // Same stages as the list path.
+    _packed_filter_list(context, packed_input_data);
+    _packed_deduplicate_list(context, packed_input_data);
+    _packed_sort_list(context, packed_input_data);
+    SIGFOX_EP_ADDON_AW_API_TIMING_START(context, timestamp);
+    for (ap_idx = 0; ap_idx < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD; ap_idx++) {
+        best_idx = context->best_index[ap_idx];
+        if (best_idx != SIGFOX_EP_ADDON_AW_API_BEST_INDEX_NONE) {
+            packed_access_point = &(packed_input_data->packed_access_point_list[best_idx]);
+            _encode_mac_address((packed_access_point->mac_address_bytes), ul_payload, nb_mac_ul_payload);
+            SIGFOX_EP_ADDON_AW_API_PACKED_SET_STATUS(packed_access_point, SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_SENT);
+        }
+    }
+    SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, SIGFOX_EP_ADDON_AW_API_STAGE_ENCODING, timestamp);
+    // Check if at least one valid MAC address has been found.
+    if ((*nb_mac_ul_payload) == 0) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NONE_VALID_ACCESS_POINT);
+    }
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_STREAM
+/*******************************************************************/
+static void _stream_reset_record(SIGFOX_EP_ADDON_AW_API_stream_t *stream) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR; idx++) {
+        stream->record.mac_address[idx] = SIGFOX_EP_ADDON_AW_API_NULL_CHAR;
+    }
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR; idx++) {
+        stream->record.ssid[idx] = SIGFOX_EP_ADDON_AW_API_NULL_CHAR;
+    }
+    stream->record.rssi_dbm = 0;
+    stream->record.status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_NEW;
+    stream->record.nb_scans = 0;
+}
+
+/*******************************************************************/
+static void _stream_select(SIGFOX_EP_ADDON_AW_API_stream_t *stream, SIGFOX_EP_ADDON_AW_API_access_point_t *access_point) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_stream_candidate_t *candidate = (stream->candidate);
+    SIGFOX_EP_ADDON_AW_API_stream_candidate_t swap_candidate;
+    sfx_bool sort_by_rssi = _is_sorted_by_rssi(stream->context);
+    sfx_u8 idx = 0;
+    sfx_u8 byte_idx = 0;
+    // Same MAC address already selected: only keep the best RSSI.
+    for (idx = 0; idx < (stream->nb_candidates); idx++) {
+        if (_mac_address_is_equal((candidate[idx].mac_address_bytes), (access_point->mac_address_bytes)) == SIGFOX_TRUE) {
+            SIGFOX_EP_ADDON_AW_API_STATISTICS_INCREMENT(stream->context, nb_duplicate);
+            if ((access_point->rssi_dbm) <= (candidate[idx].rssi_dbm)) return;
+            candidate[idx].rssi_dbm = (access_point->rssi_dbm);
+            // Move the candidate up (strict comparison keeps the arrival order in case of equal RSSI).
+            while ((sort_by_rssi == SIGFOX_TRUE) && (idx > 0) && ((candidate[idx].rssi_dbm) > (candidate[idx - 1].rssi_dbm))) {
+                swap_candidate = candidate[idx - 1];
+                candidate[idx - 1] = candidate[idx];
+                candidate[idx] = swap_candidate;
+                idx--;
+            }
+            return;
+        }
+    }
+    if (sort_by_rssi == SIGFOX_FALSE) {
+        // Keep the first access points.
+        if ((stream->nb_candidates) >= SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD) return;
+        idx = (stream->nb_candidates);
+    }
+    else {
+        // Directly exit if all the candidates are better.
+        if (((stream->nb_candidates) >= SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD) && ((access_point->rssi_dbm) <= (candidate[SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD - 1].rssi_dbm))) return;
+        // Insert element (same sorted insertion as the list path).
+        idx = ((stream->nb_candidates) < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD) ? (stream->nb_candidates) : (SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD - 1);
+        while ((idx > 0) && ((access_point->rssi_dbm) > (candidate[idx - 1].rssi_dbm))) {
+            candidate[idx] = candidate[idx - 1];
+            idx--;
+        }
+    }
+    for (byte_idx = 0; byte_idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES; byte_idx++) {
+        candidate[idx].mac_address_bytes[byte_idx] = (access_point->mac_address_bytes[byte_idx]);
+    }
+    candidate[idx].rssi_dbm = (access_point->rssi_dbm);
+    if ((stream->nb_candidates) < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD) {
+        stream->nb_candidates++;
+    }
+}
+
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+/*******************************************************************/
+static sfx_s32 _stream_get_recent_key(sfx_bool sort_by_rssi, sfx_u8 age, sfx_s16 rssi_dbm) {
+    // Least recently sent first, then the stream order.
+    return ((((sfx_s32) age) << 16) + ((sort_by_rssi == SIGFOX_TRUE) ? ((sfx_s32) rssi_dbm) : 0));
+}
+
+/*******************************************************************/
+static void _stream_select_recent(SIGFOX_EP_ADDON_AW_API_stream_t *stream, SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, sfx_u8 age) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_stream_candidate_t *recent_candidate = (stream->recent_candidate);
+    sfx_bool sort_by_rssi = _is_sorted_by_rssi(stream->context);
+    sfx_s32 key = _stream_get_recent_key(sort_by_rssi, age, (access_point->rssi_dbm));
+    sfx_u8 idx = 0;
+    sfx_u8 byte_idx = 0;
+    // Same MAC address already selected: only keep the best RSSI (the candidate is removed and inserted again).
+    for (idx = 0; idx < (stream->nb_recent_candidates); idx++) {
+        if (_mac_address_is_equal((recent_candidate[idx].mac_address_bytes), (access_point->mac_address_bytes)) == SIGFOX_TRUE) {
+            SIGFOX_EP_ADDON_AW_API_STATISTICS_INCREMENT(stream->context, nb_duplicate);
+            if ((access_point->rssi_dbm) <= (recent_candidate[idx].rssi_dbm)) return;
+            for (; idx < ((stream->nb_recent_candidates) - 1); idx++) {
+                recent_candidate[idx] = recent_candidate[idx + 1];
+            }
+            stream->nb_recent_candidates--;
+            break;
+        }
+    }
+    // Directly exit if all the candidates are better.
+    if (((stream->nb_recent_candidates) >= SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD) && (key <= _stream_get_recent_key(sort_by_rssi, (recent_candidate[SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD - 1].age), (recent_candidate[SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD - 1].rssi_dbm)))) return;
+    // Insert element (strict comparison keeps the arrival order in case of equal key).
+    idx = ((stream->nb_recent_candidates) < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD) ? (stream->nb_recent_candidates) : (SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD - 1);
+    while ((idx > 0) && (key > _stream_get_recent_key(sort_by_rssi, (recent_candidate[idx - 1].age), (recent_candidate[idx - 1].rssi_dbm)))) {
+        recent_candidate[idx] = recent_candidate[idx - 1];
+        idx--;
+    }
+    for (byte_idx = 0; byte_idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES; byte_idx++) {
+        recent_candidate[idx].mac_address_bytes[byte_idx] = (access_point->mac_address_bytes[byte_idx]);
+    }
+    recent_candidate[idx].rssi_dbm = (access_point->rssi_dbm);
+    recent_candidate[idx].age = age;
+    if ((stream->nb_recent_candidates) < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD) {
+        stream->nb_recent_candidates++;
+    }
+}
+#endif
+
+/*******************************************************************/
+static SIGFOX_EP_ADDON_AW_API_status_t _stream_add_access_point(SIGFOX_EP_ADDON_AW_API_stream_t *stream, SIGFOX_EP_ADDON_AW_API_access_point_t *access_point) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    SIGFOX_EP_ADDON_AW_API_input_data_t input_data;
+    sfx_bool deduplication_pending = (stream->context->deduplication_pending);
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+    sfx_u8 age = 0;
+#endif
+    // Apply the list filters on a single access point list.
+    input_data.access_point_list = &access_point;
+    input_data.access_point_list_size = 1;
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _filter_list((stream->context), &input_data);
+#else
+    _filter_list((stream->context), &input_data);
+#endif
+    // Duplicates are removed by the selection, not by the list deduplication.
+    stream->context->deduplication_pending = deduplication_pending;
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+    // The access points sent in the previous messages are selected apart, to complete the payload if needed.
+    if ((access_point->status) == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID) {
+        age = _history_get_age((stream->context), (access_point->mac_address_bytes));
+    }
+    if (age != SIGFOX_EP_ADDON_AW_API_HISTORY_AGE_NONE) {
+        access_point->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_RECENT;
+        if ((stream->context->history_mode) == SIGFOX_EP_ADDON_AW_API_HISTORY_MODE_PENALIZE) {
+            _stream_select_recent(stream, access_point, age);
+        }
+    }
+#endif
+    if ((access_point->status) == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID) {
+        _stream_select(stream, access_point);
+    }
+#ifdef SIGFOX_EP_ERROR_CODES
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+static void _stream_store_char(SIGFOX_EP_ADDON_AW_API_stream_t *stream, sfx_u8 ascii_character) {
+    // Store character in the current field (other fields are ignored).
+    if ((stream->field_idx) == SIGFOX_EP_ADDON_AW_API_STREAM_FIELD_SSID) {
+        // Longer SSID are truncated.
+        if ((stream->char_idx) < SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR) {
+            stream->record.ssid[stream->char_idx] = ascii_character;
+        }
+    }
+    else if ((stream->field_idx) == SIGFOX_EP_ADDON_AW_API_STREAM_FIELD_RSSI) {
+        if (((stream->char_idx) == 0) && (ascii_character == '-')) {
+            stream->parser_flags |= SIGFOX_EP_ADDON_AW_API_STREAM_FLAG_NEGATIVE;
+        }
+        else if ((ascii_character >= '0') && (ascii_character <= '9')) {
+            if ((stream->record.rssi_dbm) < SIGFOX_EP_ADDON_AW_API_STREAM_RSSI_MAGNITUDE_MAX) {
+                stream->record.rssi_dbm = (sfx_s16) (((stream->record.rssi_dbm) * 10) + (ascii_character - '0'));
+            }
+        }
+        else {
+            stream->parser_flags |= SIGFOX_EP_ADDON_AW_API_STREAM_FLAG_INVALID;
+        }
+    }
+    else if ((stream->field_idx) == SIGFOX_EP_ADDON_AW_API_STREAM_FIELD_MAC_ADDRESS) {
+        if ((stream->char_idx) < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR) {
+            stream->record.mac_address[stream->char_idx] = ascii_character;
+        }
+    }
+    if ((stream->char_idx) < SIGFOX_EP_ADDON_AW_API_STREAM_INDEX_MAX) {
+        stream->char_idx++;
+    }
+}
+
+/*******************************************************************/
+static void _stream_end_field(SIGFOX_EP_ADDON_AW_API_stream_t *stream) {
+    // Check field.
+    if ((stream->field_idx) == SIGFOX_EP_ADDON_AW_API_STREAM_FIELD_RSSI) {
+        // At least one digit is required.
+        if (((stream->char_idx) == 0) || (((stream->char_idx) == 1) && (((stream->parser_flags) & SIGFOX_EP_ADDON_AW_API_STREAM_FLAG_NEGATIVE) != 0))) {
+            stream->parser_flags |= SIGFOX_EP_ADDON_AW_API_STREAM_FLAG_INVALID;
+        }
+        if (((stream->parser_flags) & SIGFOX_EP_ADDON_AW_API_STREAM_FLAG_NEGATIVE) != 0) {
+            stream->record.rssi_dbm = (sfx_s16) (-(stream->record.rssi_dbm));
+        }
+    }
+    else if ((stream->field_idx) == SIGFOX_EP_ADDON_AW_API_STREAM_FIELD_MAC_ADDRESS) {
+        if ((stream->char_idx) != SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR) {
+            stream->parser_flags |= SIGFOX_EP_ADDON_AW_API_STREAM_FLAG_INVALID;
+        }
+    }
+    // Go to next field.
+    if ((stream->field_idx) < SIGFOX_EP_ADDON_AW_API_STREAM_INDEX_MAX) {
+        stream->field_idx++;
+    }
+    stream->char_idx = 0;
+}
+
+/*******************************************************************/
+static void _stream_parse_char(SIGFOX_EP_ADDON_AW_API_stream_t *stream, sfx_u8 ascii_character) {
+    // A new line always restarts the prefix matching (truncated records are dropped).
+    if (ascii_character == '\n') {
+        stream->parser_state = SIGFOX_EP_ADDON_AW_API_STREAM_STATE_PREFIX;
+        stream->char_idx = 0;
+        return;
+    }
+    if ((stream->parser_state) == SIGFOX_EP_ADDON_AW_API_STREAM_STATE_PREFIX) {
+        if (ascii_character != (sfx_u8) (SIGFOX_EP_ADDON_AW_API_STREAM_CWLAP_PREFIX[stream->char_idx])) {
+            stream->parser_state = SIGFOX_EP_ADDON_AW_API_STREAM_STATE_SKIP_LINE;
+            return;
+        }
+        stream->char_idx++;
+        if ((stream->char_idx) >= SIGFOX_EP_ADDON_AW_API_STREAM_CWLAP_PREFIX_SIZE) {
+            // Start a new record.
+            _stream_reset_record(stream);
+            stream->parser_state = SIGFOX_EP_ADDON_AW_API_STREAM_STATE_FIELDS;
+            stream->parser_flags = 0;
+            stream->field_idx = 0;
+            stream->char_idx = 0;
+        }
+        return;
+    }
+    if ((stream->parser_state) != SIGFOX_EP_ADDON_AW_API_STREAM_STATE_FIELDS) {
+        return;
+    }
+    // Quoted strings (SSID and MAC address) may contain separators and escaped characters.
+    if (((stream->parser_flags) & SIGFOX_EP_ADDON_AW_API_STREAM_FLAG_QUOTED) != 0) {
+        if (((stream->parser_flags) & SIGFOX_EP_ADDON_AW_API_STREAM_FLAG_ESCAPED) != 0) {
+            stream->parser_flags &= (sfx_u8) (~SIGFOX_EP_ADDON_AW_API_STREAM_FLAG_ESCAPED);
+            _stream_store_char(stream, ascii_character);
+        }
+        else if (ascii_character == '\\') {
+            stream->parser_flags |= SIGFOX_EP_ADDON_AW_API_STREAM_FLAG_ESCAPED;
+        }
+        else if (ascii_character == '"') {
+            stream->parser_flags &= (sfx_u8) (~SIGFOX_EP_ADDON_AW_API_STREAM_FLAG_QUOTED);
+        }
+        else {
+            _stream_store_char(stream, ascii_character);
+        }
+    }
+    else if (ascii_character == '"') {
+        stream->parser_flags |= SIGFOX_EP_ADDON_AW_API_STREAM_FLAG_QUOTED;
+    }
+    else if (ascii_character == ',') {
+        _stream_end_field(stream);
+    }
+    else if (ascii_character == ')') {
+        _stream_end_field(stream);
+        // Malformed records are ignored, as well as the invalid MAC addresses.
+        if (((stream->field_idx) > SIGFOX_EP_ADDON_AW_API_STREAM_FIELD_MAC_ADDRESS) && (((stream->parser_flags) & SIGFOX_EP_ADDON_AW_API_STREAM_FLAG_INVALID) == 0)) {
+            _stream_add_access_point(stream, &(stream->record));
+        }
+        stream->parser_state = SIGFOX_EP_ADDON_AW_API_STREAM_STATE_SKIP_LINE;
+    }
+    else {
+        _stream_store_char(stream, ascii_character);
+    }
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_DECODER
+/*******************************************************************/
+static void _decode_ul_payload(sfx_u8 *ul_payload, SIGFOX_EP_ADDON_AW_API_decoded_payload_t *decoded_payload) {
+    // Local variables.
+    sfx_u8 *mac_address_bytes = SIGFOX_NULL;
+    sfx_u8 mac_idx = 0;
+    sfx_u8 byte_idx = 0;
+    sfx_u8 padding = 0;
+    // Reset result.
+    decoded_payload->nb_mac = 0;
+    decoded_payload->errors = 0;
+    // Check payload type header.
+    if ((ul_payload[SIGFOX_EP_ADDON_AW_API_IG_BYTE_INDEX] & SIGFOX_EP_ADDON_AW_API_IG_BIT_MASK) != 0) {
+        decoded_payload->payload_type = ((ul_payload[SIGFOX_EP_ADDON_AW_API_UL_BYTE_INDEX] & SIGFOX_EP_ADDON_AW_API_UL_BIT_MASK) != 0) ? SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_CUSTOM : SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_RESERVED;
+        return;
+    }
+    decoded_payload->payload_type = SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_ATLAS_WIFI;
+    // Extract MAC addresses.
+    for (mac_idx = 0; mac_idx < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD; mac_idx++) {
+        mac_address_bytes = &(ul_payload[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES * mac_idx]);
+        padding = 0;
+        for (byte_idx = 0; byte_idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES; byte_idx++) {
+            decoded_payload->mac_address_bytes[mac_idx][byte_idx] = mac_address_bytes[byte_idx];
+            padding |= mac_address_bytes[byte_idx];
+        }
+        // The first MAC address is always present, the next ones can be replaced by zero padding.
+        if ((mac_idx > 0) && (padding == 0)) break;
+        // Check MAC address (the I/G bit of the first one is already known to be cleared).
+        if (_mac_address_is_reserved(mac_address_bytes) == SIGFOX_TRUE) {
+            decoded_payload->errors |= SIGFOX_EP_ADDON_AW_API_DECODER_ERROR_RESERVED_MAC_ADDRESS;
+        }
+        else if (_mac_address_is_multicast(mac_address_bytes) == SIGFOX_TRUE) {
+            decoded_payload->errors |= SIGFOX_EP_ADDON_AW_API_DECODER_ERROR_MULTICAST_MAC_ADDRESS;
+        }
+        decoded_payload->nb_mac++;
+    }
+    if (((decoded_payload->nb_mac) > 1) && (_mac_address_is_equal((decoded_payload->mac_address_bytes[0]), (decoded_payload->mac_address_bytes[1])) == SIGFOX_TRUE)) {
+        decoded_payload->errors |= SIGFOX_EP_ADDON_AW_API_DECODER_ERROR_DUPLICATE_MAC_ADDRESS;
+    }
+}
+
+#ifdef SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD
+/*******************************************************************/
+static sfx_u32 _compact_read_bits(sfx_u8 *ul_payload, sfx_u8 *bit_idx, sfx_u8 nb_bits) {
+    // Local variables.
+    sfx_u32 value = 0;
+    // Read the bits most significant first.
+    while (nb_bits > 0) {
+        value = ((value << 1) | ((sfx_u32) ((ul_payload[(*bit_idx) >> 3] >> (7 - ((*bit_idx) & 0x07))) & 0x01)));
+        (*bit_idx)++;
+        nb_bits--;
+    }
+    return value;
+}
+#endif
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_ASYNC
+/*******************************************************************/
+static sfx_u8 _async_find_buffer(SIGFOX_EP_ADDON_AW_API_async_t *async, SIGFOX_EP_ADDON_AW_API_async_buffer_state_t buffer_state) {
+    // Local variables.
+    sfx_u8 idx = 0;
+    // Returns SIGFOX_EP_ADDON_AW_API_ASYNC_NB_BUFFERS if no buffer is in the given state.
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_ASYNC_NB_BUFFERS; idx++) {
+        if ((async->buffer_state[idx]) == ((sfx_u8) buffer_state)) break;
+    }
+    return idx;
+}
+
+/*******************************************************************/
+static void _async_request_process(SIGFOX_EP_ADDON_AW_API_async_t *async) {
+    if ((async->callbacks.process_cb) != SIGFOX_NULL) {
+        async->callbacks.process_cb();
+    }
+}
+#endif
+
+/*** SIGFOX EP ADDON AW API functions ***/
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_filter(sfx_u8 filters, SIGFOX_EP_ADDON_AW_API_sorting_t sorting) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+    // Configure default context.
+    status = SIGFOX_EP_ADDON_AW_API_set_filter_ctx(&sigfox_ep_addon_aw_api_ctx, filters, sorting);
+#else
+    SIGFOX_EP_ADDON_AW_API_set_filter_ctx(&sigfox_ep_addon_aw_api_ctx, filters, sorting);
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_build_ul_payload(SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+    // Use default context.
+    status = SIGFOX_EP_ADDON_AW_API_build_ul_payload_ctx(&sigfox_ep_addon_aw_api_ctx, input_data, ul_payload, nb_mac_ul_payload);
+#else
+    SIGFOX_EP_ADDON_AW_API_build_ul_payload_ctx(&sigfox_ep_addon_aw_api_ctx, input_data, ul_payload, nb_mac_ul_payload);
+#endif
+    SIGFOX_RETURN();
+}
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST))
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_ssid_black_list(const SIGFOX_EP_ADDON_AW_API_ssid_black_list_t *ssid_black_list) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+    // Configure default context.
+    status = SIGFOX_EP_ADDON_AW_API_set_ssid_black_list_ctx(&sigfox_ep_addon_aw_api_ctx, ssid_black_list);
+#else
+    SIGFOX_EP_ADDON_AW_API_set_ssid_black_list_ctx(&sigfox_ep_addon_aw_api_ctx, ssid_black_list);
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_RSSI_MIN))
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_rssi_min(sfx_s16 rssi_min_dbm) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+    // Configure default context.
+    status = SIGFOX_EP_ADDON_AW_API_set_rssi_min_ctx(&sigfox_ep_addon_aw_api_ctx, rssi_min_dbm);
+#else
+    SIGFOX_EP_ADDON_AW_API_set_rssi_min_ctx(&sigfox_ep_addon_aw_api_ctx, rssi_min_dbm);
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST))
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_oui_black_list(const SIGFOX_EP_ADDON_AW_API_oui_table_t *oui_black_list) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+    // Configure default context.
+    status = SIGFOX_EP_ADDON_AW_API_set_oui_black_list_ctx(&sigfox_ep_addon_aw_api_ctx, oui_black_list);
+#else
+    SIGFOX_EP_ADDON_AW_API_set_oui_black_list_ctx(&sigfox_ep_addon_aw_api_ctx, oui_black_list);
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_drain_init(SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, SIGFOX_EP_ADDON_AW_API_index_t *index_buffer, SIGFOX_EP_ADDON_AW_API_index_t index_buffer_size) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+    // Use default context.
+    status = SIGFOX_EP_ADDON_AW_API_drain_init_ctx(&sigfox_ep_addon_aw_api_ctx, input_data, index_buffer, index_buffer_size);
+#else
+    SIGFOX_EP_ADDON_AW_API_drain_init_ctx(&sigfox_ep_addon_aw_api_ctx, input_data, index_buffer, index_buffer_size);
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_drain_next(sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+    // Use default context.
+    status = SIGFOX_EP_ADDON_AW_API_drain_next_ctx(&sigfox_ep_addon_aw_api_ctx, ul_payload, nb_mac_ul_payload);
+#else
+    SIGFOX_EP_ADDON_AW_API_drain_next_ctx(&sigfox_ep_addon_aw_api_ctx, ul_payload, nb_mac_ul_payload);
+#endif
+    SIGFOX_RETURN();
+}
+
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_timestamp_callback(SIGFOX_EP_ADDON_AW_API_timestamp_cb_t timestamp_cb) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+    // Use default context.
+    status = SIGFOX_EP_ADDON_AW_API_set_timestamp_callback_ctx(&sigfox_ep_addon_aw_api_ctx, timestamp_cb);
+#else
+    SIGFOX_EP_ADDON_AW_API_set_timestamp_callback_ctx(&sigfox_ep_addon_aw_api_ctx, timestamp_cb);
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_get_timing(SIGFOX_EP_ADDON_AW_API_timing_t *timing) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+    // Use default context.
+    status = SIGFOX_EP_ADDON_AW_API_get_timing_ctx(&sigfox_ep_addon_aw_api_ctx, timing);
+#else
+    SIGFOX_EP_ADDON_AW_API_get_timing_ctx(&sigfox_ep_addon_aw_api_ctx, timing);
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_STATISTICS
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_get_statistics(SIGFOX_EP_ADDON_AW_API_statistics_t *statistics) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+    // Use default context.
+    status = SIGFOX_EP_ADDON_AW_API_get_statistics_ctx(&sigfox_ep_addon_aw_api_ctx, statistics);
+#else
+    SIGFOX_EP_ADDON_AW_API_get_statistics_ctx(&sigfox_ep_addon_aw_api_ctx, statistics);
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_PACKED_INPUT
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_pack_access_point(sfx_u8 *mac_address, sfx_u8 *ssid, sfx_s16 rssi_dbm, SIGFOX_EP_ADDON_AW_API_packed_access_point_t *packed_access_point) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+    // Use default context.
+    status = SIGFOX_EP_ADDON_AW_API_pack_access_point_ctx(&sigfox_ep_addon_aw_api_ctx, mac_address, ssid, rssi_dbm, packed_access_point);
+#else
+    SIGFOX_EP_ADDON_AW_API_pack_access_point_ctx(&sigfox_ep_addon_aw_api_ctx, mac_address, ssid, rssi_dbm, packed_access_point);
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_build_ul_payload_packed(SIGFOX_EP_ADDON_AW_API_packed_input_data_t *packed_input_data, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+    // Use default context.
+    status = SIGFOX_EP_ADDON_AW_API_build_ul_payload_packed_ctx(&sigfox_ep_addon_aw_api_ctx, packed_input_data, ul_payload, nb_mac_ul_payload);
+#else
+    SIGFOX_EP_ADDON_AW_API_build_ul_payload_packed_ctx(&sigfox_ep_addon_aw_api_ctx, packed_input_data, ul_payload, nb_mac_ul_payload);
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_STREAM
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_stream_init(SIGFOX_EP_ADDON_AW_API_stream_t *stream) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+    // Use default context.
+    status = SIGFOX_EP_ADDON_AW_API_stream_init_ctx(&sigfox_ep_addon_aw_api_ctx, stream);
+#else
+    SIGFOX_EP_ADDON_AW_API_stream_init_ctx(&sigfox_ep_addon_aw_api_ctx, stream);
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_stream_add_record(SIGFOX_EP_ADDON_AW_API_stream_t *stream, sfx_u8 *mac_address, sfx_u8 *ssid, sfx_s16 rssi_dbm) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    sfx_u8 idx = 0;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((stream == SIGFOX_NULL) || (mac_address == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Copy the record (the SSID is only needed by the filters).
+    _stream_reset_record(stream);
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR; idx++) {
+        stream->record.mac_address[idx] = mac_address[idx];
+    }
+    for (idx = 0; (ssid != SIGFOX_NULL) && (idx < SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR); idx++) {
+        if (ssid[idx] == SIGFOX_EP_ADDON_AW_API_NULL_CHAR) break;
+        stream->record.ssid[idx] = ssid[idx];
+    }
+    stream->record.rssi_dbm = rssi_dbm;
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _stream_add_access_point(stream, &(stream->record));
+#else
+    _stream_add_access_point(stream, &(stream->record));
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_stream_push(SIGFOX_EP_ADDON_AW_API_stream_t *stream, SIGFOX_EP_ADDON_AW_API_access_point_t *access_point) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((stream == SIGFOX_NULL) || (access_point == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // The selected candidates are copied, so that the access point is not used after this call.
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _stream_add_access_point(stream, access_point);
+#else
+    _stream_add_access_point(stream, access_point);
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_stream_parse_cwlap(SIGFOX_EP_ADDON_AW_API_stream_t *stream, const sfx_u8 *chunk, sfx_u32 chunk_size) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    sfx_u32 idx = 0;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((stream == SIGFOX_NULL) || ((chunk == SIGFOX_NULL) && (chunk_size != 0))) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // The parser state is kept in the stream, so that a record can be split over several chunks.
+    for (idx = 0; idx < chunk_size; idx++) {
+        _stream_parse_char(stream, chunk[idx]);
+    }
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_stream_build_ul_payload(SIGFOX_EP_ADDON_AW_API_stream_t *stream, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    sfx_u8 idx = 0;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((stream == SIGFOX_NULL) || (ul_payload == SIGFOX_NULL) || (nb_mac_ul_payload == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Encode the candidates (already sorted).
+    _reset_ul_payload(ul_payload, nb_mac_ul_payload);
+    for (idx = 0; idx < (stream->nb_candidates); idx++) {
+        _encode_mac_address((stream->candidate[idx].mac_address_bytes), ul_payload, nb_mac_ul_payload);
+    }
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+    // Complete the payload with the least recently sent access points (only selected in penalize mode).
+    for (idx = 0; (idx < (stream->nb_recent_candidates)) && ((*nb_mac_ul_payload) < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD); idx++) {
+        _encode_mac_address((stream->recent_candidate[idx].mac_address_bytes), ul_payload, nb_mac_ul_payload);
+    }
+    // Remember the sent MAC addresses.
+    _history_add_ul_payload((stream->context), ul_payload, (*nb_mac_ul_payload));
+#endif
+    // Check if at least one valid MAC address has been found.
+    if ((*nb_mac_ul_payload) == 0) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NONE_VALID_ACCESS_POINT);
+    }
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_compact_dictionary(const SIGFOX_EP_ADDON_AW_API_oui_table_t *compact_dictionary) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+    // Configure default context.
+    status = SIGFOX_EP_ADDON_AW_API_set_compact_dictionary_ctx(&sigfox_ep_addon_aw_api_ctx, compact_dictionary);
+#else
+    SIGFOX_EP_ADDON_AW_API_set_compact_dictionary_ctx(&sigfox_ep_addon_aw_api_ctx, compact_dictionary);
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_build_ul_payload_compact(SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, sfx_u8 *ul_payload, sfx_u8 *nb_access_points_ul_payload) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+    // Use default context.
+    status = SIGFOX_EP_ADDON_AW_API_build_ul_payload_compact_ctx(&sigfox_ep_addon_aw_api_ctx, input_data, ul_payload, nb_access_points_ul_payload);
+#else
+    SIGFOX_EP_ADDON_AW_API_build_ul_payload_compact_ctx(&sigfox_ep_addon_aw_api_ctx, input_data, ul_payload, nb_access_points_ul_payload);
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_ASYNC
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_async_init(SIGFOX_EP_ADDON_AW_API_async_t *async, SIGFOX_EP_ADDON_AW_API_async_callbacks_t *callbacks) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+    // Use default context.
+    status = SIGFOX_EP_ADDON_AW_API_async_init_ctx(&sigfox_ep_addon_aw_api_ctx, async, callbacks);
+#else
+    SIGFOX_EP_ADDON_AW_API_async_init_ctx(&sigfox_ep_addon_aw_api_ctx, async, callbacks);
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_async_scan_start(SIGFOX_EP_ADDON_AW_API_async_t *async) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if (async == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // The stream is only reused once the previous scan has been encoded.
+    if ((async->scan_state) != SIGFOX_EP_ADDON_AW_API_ASYNC_SCAN_STATE_IDLE) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_ASYNC_STATE);
+    }
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = SIGFOX_EP_ADDON_AW_API_stream_init_ctx((async->context), &(async->stream));
+    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
+#else
+    SIGFOX_EP_ADDON_AW_API_stream_init_ctx((async->context), &(async->stream));
+#endif
+    async->scan_state = SIGFOX_EP_ADDON_AW_API_ASYNC_SCAN_STATE_RUNNING;
+errors:
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_async_scan_end(SIGFOX_EP_ADDON_AW_API_async_t *async) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if (async == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    if ((async->scan_state) != SIGFOX_EP_ADDON_AW_API_ASYNC_SCAN_STATE_RUNNING) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_ASYNC_STATE);
+    }
+    // The payload is built by the main loop.
+    async->scan_state = SIGFOX_EP_ADDON_AW_API_ASYNC_SCAN_STATE_COMPLETE;
+    _async_request_process(async);
+errors:
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_async_send_complete(SIGFOX_EP_ADDON_AW_API_async_t *async) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if (async == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    if (_async_find_buffer(async, SIGFOX_EP_ADDON_AW_API_ASYNC_BUFFER_STATE_SENDING) >= SIGFOX_EP_ADDON_AW_API_ASYNC_NB_BUFFERS) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_ASYNC_STATE);
+    }
+    // The buffer is released by the main loop.
+    async->send_complete = 1;
+    _async_request_process(async);
+errors:
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_async_process(SIGFOX_EP_ADDON_AW_API_async_t *async) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    sfx_u8 idx = 0;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if (async == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Release the sent payload.
+    if ((async->send_complete) != 0) {
+        async->send_complete = 0;
+        idx = _async_find_buffer(async, SIGFOX_EP_ADDON_AW_API_ASYNC_BUFFER_STATE_SENDING);
+        if (idx < SIGFOX_EP_ADDON_AW_API_ASYNC_NB_BUFFERS) {
+            async->buffer_state[idx] = SIGFOX_EP_ADDON_AW_API_ASYNC_BUFFER_STATE_FREE;
+        }
+    }
+    // Build the payload of the completed scan (the scan waits while all the buffers are used).
+    if ((async->scan_state) == SIGFOX_EP_ADDON_AW_API_ASYNC_SCAN_STATE_COMPLETE) {
+        idx = _async_find_buffer(async, SIGFOX_EP_ADDON_AW_API_ASYNC_BUFFER_STATE_FREE);
+        if (idx < SIGFOX_EP_ADDON_AW_API_ASYNC_NB_BUFFERS) {
+#ifdef SIGFOX_EP_ERROR_CODES
+            status = SIGFOX_EP_ADDON_AW_API_stream_build_ul_payload(&(async->stream), (async->ul_payload[idx]), &(async->nb_mac_ul_payload[idx]));
+            // A scan without valid access point only gives an empty payload, which is not sent.
+            if (status == SIGFOX_EP_ADDON_AW_API_ERROR_NONE_VALID_ACCESS_POINT) {
+                status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+            }
+            SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
+#else
+            SIGFOX_EP_ADDON_AW_API_stream_build_ul_payload(&(async->stream), (async->ul_payload[idx]), &(async->nb_mac_ul_payload[idx]));
+#endif
+            async->buffer_state[idx] = ((async->nb_mac_ul_payload[idx]) != 0) ? SIGFOX_EP_ADDON_AW_API_ASYNC_BUFFER_STATE_READY : SIGFOX_EP_ADDON_AW_API_ASYNC_BUFFER_STATE_FREE;
+            // The stream is released before the callback, so that the next scan can be started from it.
+            async->scan_state = SIGFOX_EP_ADDON_AW_API_ASYNC_SCAN_STATE_IDLE;
+            if ((async->callbacks.scan_cpl_cb) != SIGFOX_NULL) {
+                async->callbacks.scan_cpl_cb(async->nb_mac_ul_payload[idx]);
+            }
+        }
+    }
+    // Request the transmission of the next payload (one transmission at a time, so that at most one payload is waiting).
+    if (_async_find_buffer(async, SIGFOX_EP_ADDON_AW_API_ASYNC_BUFFER_STATE_SENDING) >= SIGFOX_EP_ADDON_AW_API_ASYNC_NB_BUFFERS) {
+        idx = _async_find_buffer(async, SIGFOX_EP_ADDON_AW_API_ASYNC_BUFFER_STATE_READY);
+        if (idx < SIGFOX_EP_ADDON_AW_API_ASYNC_NB_BUFFERS) {
+            async->buffer_state[idx] = SIGFOX_EP_ADDON_AW_API_ASYNC_BUFFER_STATE_SENDING;
+            async->callbacks.send_cb((async->ul_payload[idx]), (async->nb_mac_ul_payload[idx]));
+        }
+    }
+#if ((defined SIGFOX_EP_PARAMETERS_CHECK) || (defined SIGFOX_EP_ERROR_CODES))
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_history_mode(SIGFOX_EP_ADDON_AW_API_history_mode_t history_mode, sfx_u8 history_age_max) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+    // Configure default context.
+    status = SIGFOX_EP_ADDON_AW_API_set_history_mode_ctx(&sigfox_ep_addon_aw_api_ctx, history_mode, history_age_max);
+#else
+    SIGFOX_EP_ADDON_AW_API_set_history_mode_ctx(&sigfox_ep_addon_aw_api_ctx, history_mode, history_age_max);
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_get_history(sfx_u8 *history_data) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+    // Use default context.
+    status = SIGFOX_EP_ADDON_AW_API_get_history_ctx(&sigfox_ep_addon_aw_api_ctx, history_data);
+#else
+    SIGFOX_EP_ADDON_AW_API_get_history_ctx(&sigfox_ep_addon_aw_api_ctx, history_data);
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_history(const sfx_u8 *history_data) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+    // Configure default context.
+    status = SIGFOX_EP_ADDON_AW_API_set_history_ctx(&sigfox_ep_addon_aw_api_ctx, history_data);
+#else
+    SIGFOX_EP_ADDON_AW_API_set_history_ctx(&sigfox_ep_addon_aw_api_ctx, history_data);
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_DECODER
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_decode_ul_payload(sfx_u8 *ul_payload, sfx_u8 ul_payload_size_bytes, SIGFOX_EP_ADDON_AW_API_decoded_payload_t *decoded_payload) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((decoded_payload == SIGFOX_NULL) || ((ul_payload == SIGFOX_NULL) && (ul_payload_size_bytes != 0))) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Atlas WiFi payloads always have a fixed length.
+    if (ul_payload_size_bytes != SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES) {
+        decoded_payload->payload_type = SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_CUSTOM;
+        decoded_payload->nb_mac = 0;
+        decoded_payload->errors = 0;
+    }
+    else {
+        _decode_ul_payload(ul_payload, decoded_payload);
+    }
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_decode_ul_payload_batch(sfx_u8 *ul_payloads, sfx_u32 nb_ul_payloads, SIGFOX_EP_ADDON_AW_API_decoded_payload_t *decoded_payloads, SIGFOX_EP_ADDON_AW_API_decoder_summary_t *summary) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    SIGFOX_EP_ADDON_AW_API_decoded_payload_t local_decoded_payload;
+    SIGFOX_EP_ADDON_AW_API_decoded_payload_t *decoded_payload = &local_decoded_payload;
+    sfx_u32 payload_idx = 0;
+    sfx_u8 type_idx = 0;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((ul_payloads == SIGFOX_NULL) && (nb_ul_payloads != 0)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Reset summary.
+    if (summary != SIGFOX_NULL) {
+        for (type_idx = 0; type_idx < SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_LAST; type_idx++) {
+            summary->nb_payloads[type_idx] = 0;
+        }
+        summary->nb_mac_addresses = 0;
+        summary->nb_invalid = 0;
+    }
+    // Payloads are decoded in place, without any parameters check nor copy of the input.
+    for (payload_idx = 0; payload_idx < nb_ul_payloads; payload_idx++) {
+        if (decoded_payloads != SIGFOX_NULL) {
+            decoded_payload = &(decoded_payloads[payload_idx]);
+        }
+        _decode_ul_payload(&(ul_payloads[SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES * payload_idx]), decoded_payload);
+        if (summary != SIGFOX_NULL) {
+            summary->nb_payloads[decoded_payload->payload_type]++;
+            summary->nb_mac_addresses += (decoded_payload->nb_mac);
+            summary->nb_invalid += ((decoded_payload->errors) != 0) ? 1 : 0;
+        }
+    }
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+
+#ifdef SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_decode_compact_payload(sfx_u8 *ul_payload, sfx_u8 ul_payload_size_bytes, SIGFOX_EP_ADDON_AW_API_decoded_compact_payload_t *decoded_compact_payload) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    SIGFOX_EP_ADDON_AW_API_compact_access_point_t *access_point;
+    const SIGFOX_EP_ADDON_AW_API_compact_layout_t *layout;
+    sfx_u8 rssi_shift = 0;
+    sfx_u8 bit_idx = SIGFOX_EP_ADDON_AW_API_COMPACT_HEADER_SIZE_BITS;
+    sfx_u8 idx = 0;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((decoded_compact_payload == SIGFOX_NULL) || ((ul_payload == SIGFOX_NULL) && (ul_payload_size_bytes != 0))) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    decoded_compact_payload->nb_access_points = 0;
+    decoded_compact_payload->nb_nic_bits = 0;
+    // Check size and header (all bits except the layout one).
+    if ((ul_payload_size_bytes != SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES) || ((ul_payload[0] & (sfx_u8) (~(1 << SIGFOX_EP_ADDON_AW_API_COMPACT_LAYOUT_BIT_INDEX))) != SIGFOX_EP_ADDON_AW_API_COMPACT_HEADER)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_COMPACT_PAYLOAD);
+    }
+    layout = &(SIGFOX_EP_ADDON_AW_API_COMPACT_LAYOUT[(ul_payload[0] >> SIGFOX_EP_ADDON_AW_API_COMPACT_LAYOUT_BIT_INDEX) & 0x01]);
+    rssi_shift = (sfx_u8) (SIGFOX_EP_ADDON_AW_API_COMPACT_RSSI_RANGE_SIZE_BITS - (layout->nb_rssi_bits));
+    // Extract access points fields.
+    for (idx = 0; idx < (layout->nb_access_points); idx++) {
+        access_point = &(decoded_compact_payload->access_point[idx]);
+        access_point->key = _compact_read_bits(ul_payload, &bit_idx, (sfx_u8) (SIGFOX_EP_ADDON_AW_API_COMPACT_OUI_CODE_SIZE_BITS + (layout->nb_nic_bits)));
+        access_point->rssi_dbm = (sfx_s16) (SIGFOX_EP_ADDON_AW_API_COMPACT_RSSI_FLOOR_DBM + (sfx_s16) (_compact_read_bits(ul_payload, &bit_idx, (layout->nb_rssi_bits)) << rssi_shift) + (1 << (rssi_shift - 1)));
+    }
+    decoded_compact_payload->nb_access_points = (layout->nb_access_points);
+    decoded_compact_payload->nb_nic_bits = (layout->nb_nic_bits);
+errors:
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_get_compact_key(const SIGFOX_EP_ADDON_AW_API_oui_table_t *compact_dictionary, sfx_u8 *mac_address_bytes, sfx_u8 nb_nic_bits, sfx_u32 *key) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((mac_address_bytes == SIGFOX_NULL) || (key == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+    if ((compact_dictionary != SIGFOX_NULL) && ((compact_dictionary->nb_ouis) > SIGFOX_EP_ADDON_AW_API_COMPACT_DICTIONARY_SIZE_MAX)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_COMPACT_DICTIONARY);
+    }
+#endif
+    // Same key as the one written by the end-point.
+    (*key) = _compact_get_key(compact_dictionary, mac_address_bytes, nb_nic_bits);
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+#endif
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_init_context(SIGFOX_EP_ADDON_AW_API_context_t *context) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    sfx_u8 idx = 0;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if (context == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Set default configuration.
+#ifndef SIGFOX_EP_ADDON_AW_STATIC_FILTERS
+    context->filters = 0;
+#endif
+#ifndef SIGFOX_EP_ADDON_AW_STATIC_SORTING
+    context->sorting = SIGFOX_EP_ADDON_AW_API_SORTING_NONE;
+#endif
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD; idx++) {
+        context->best_index[idx] = SIGFOX_EP_ADDON_AW_API_BEST_INDEX_NONE;
+    }
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST))
+    context->ssid_black_list = &SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_DEFAULT;
+#endif
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_RSSI_MIN))
+    context->rssi_min_dbm = SIGFOX_EP_ADDON_AW_API_RSSI_MIN_DBM_DEFAULT;
+#endif
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST))
+    context->oui_black_list = SIGFOX_NULL;
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD
+    context->compact_dictionary = SIGFOX_NULL;
+#endif
+    context->drain_input_data = SIGFOX_NULL;
+    context->drain_index = SIGFOX_NULL;
+    context->drain_index_size = 0;
+    context->drain_position = 0;
+    context->deduplication_pending = SIGFOX_FALSE;
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+    context->timestamp_cb = SIGFOX_NULL;
+    _timing_reset(context);
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_STATISTICS
+    _statistics_reset(context);
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+    context->history_mode = SIGFOX_EP_ADDON_AW_API_HISTORY_MODE_NONE;
+    context->history_age_max = 0;
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_HISTORY_SIZE; idx++) {
+        context->history[idx].age = SIGFOX_EP_ADDON_AW_API_HISTORY_AGE_NONE;
+    }
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_filter_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_u8 filters, SIGFOX_EP_ADDON_AW_API_sorting_t sorting) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if (context == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#ifndef SIGFOX_EP_ADDON_AW_STATIC_SORTING
+    if (sorting >= SIGFOX_EP_ADDON_AW_API_SORTING_LAST) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_SORTING);
+    }
+#endif
+#endif
+    // Update context (the configuration fixed at compilation time is not modified).
+#if ((defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) && (defined SIGFOX_EP_ADDON_AW_STATIC_SORTING))
+    SIGFOX_UNUSED(context);
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_STATIC_FILTERS
+    SIGFOX_UNUSED(filters);
+#else
+    context->filters = filters;
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_STATIC_SORTING
+    SIGFOX_UNUSED(sorting);
+#else
+    context->sorting = sorting;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_build_ul_payload_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((context == SIGFOX_NULL) || (input_data == SIGFOX_NULL) || (ul_payload == SIGFOX_NULL) || (nb_mac_ul_payload == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Build payload.
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _build_ul_payload(context, input_data, ul_payload, nb_mac_ul_payload);
+#else
+    _build_ul_payload(context, input_data, ul_payload, nb_mac_ul_payload);
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_build_ul_payload_batch(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data_list, sfx_u32 input_data_list_size, SIGFOX_EP_ADDON_AW_API_output_data_t *output_data_list) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    sfx_u32 idx = 0;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((context == SIGFOX_NULL) || (input_data_list == SIGFOX_NULL) || (output_data_list == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Loop on all access points lists.
+    for (idx = 0; idx < input_data_list_size; idx++) {
+        // Build payload and store individual status without aborting the batch.
+#ifdef SIGFOX_EP_ERROR_CODES
+        output_data_list[idx].status = _build_ul_payload(context, &(input_data_list[idx]), output_data_list[idx].ul_payload, &(output_data_list[idx].nb_mac_ul_payload));
+#else
+        _build_ul_payload(context, &(input_data_list[idx]), output_data_list[idx].ul_payload, &(output_data_list[idx].nb_mac_ul_payload));
+#endif
+    }
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_drain_init_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, SIGFOX_EP_ADDON_AW_API_index_t *index_buffer, SIGFOX_EP_ADDON_AW_API_index_t index_buffer_size) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    SIGFOX_EP_ADDON_AW_API_index_t idx = 0;
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+    sfx_u32 timestamp = 0;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((context == SIGFOX_NULL) || (input_data == SIGFOX_NULL) || (index_buffer == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+    if (input_data->access_point_list == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+    if ((input_data->access_point_list_size == 0) || (index_buffer_size == 0)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_ACCESS_POINT_LIST_SIZE);
+    }
+#endif
+    // Reset iterator.
+    context->drain_input_data = input_data;
+    context->drain_index = index_buffer;
+    context->drain_index_size = index_buffer_size;
+    context->drain_position = 0;
+    for (idx = 0; idx < index_buffer_size; idx++) {
+        index_buffer[idx] = SIGFOX_EP_ADDON_AW_API_BEST_INDEX_NONE;
+    }
+    // Apply filters.
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _filter_list(context, input_data);
+    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
+#else
+    _filter_list(context, input_data);
+#endif
+    // Remove duplicated MAC addresses.
+    _deduplicate_list(context, input_data);
+    // Rank all the access points which fit in the buffer, only once.
+    SIGFOX_EP_ADDON_AW_API_TIMING_START(context, timestamp);
+    _sort(context, input_data, index_buffer, index_buffer_size);
+    SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, SIGFOX_EP_ADDON_AW_API_STAGE_SORTING, timestamp);
+#if ((defined SIGFOX_EP_PARAMETERS_CHECK) || (defined SIGFOX_EP_ERROR_CODES))
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_drain_next_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_point;
+    SIGFOX_EP_ADDON_AW_API_index_t best_idx = 0;
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+    sfx_u32 timestamp = 0;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((context == SIGFOX_NULL) || (ul_payload == SIGFOX_NULL) || (nb_mac_ul_payload == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+    if ((context->drain_input_data == SIGFOX_NULL) || (context->drain_index == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Reset payload and MAC address count.
+    _reset_ul_payload(ul_payload, nb_mac_ul_payload);
+    SIGFOX_EP_ADDON_AW_API_TIMING_START(context, timestamp);
+    // Take the next ranked access points.
+    while (((*nb_mac_ul_payload) < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD) && ((context->drain_position) < (context->drain_index_size))) {
+        best_idx = context->drain_index[context->drain_position];
+        // End of ranked access points.
+        if (best_idx == SIGFOX_EP_ADDON_AW_API_BEST_INDEX_NONE) {
+            context->drain_position = (context->drain_index_size);
+            break;
+        }
+        context->drain_position++;
+        // Skip access points which have been sent in the meantime.
+        access_point = (context->drain_input_data->access_point_list[best_idx]);
+        if ((access_point->status) == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID) {
+            _encode_access_point(access_point, ul_payload, nb_mac_ul_payload);
+        }
+    }
+    SIGFOX_EP_ADDON_AW_API_TIMING_STAGE(context, SIGFOX_EP_ADDON_AW_API_STAGE_ENCODING, timestamp);
+    // Check if at least one valid MAC address has been found.
+    if ((*nb_mac_ul_payload) == 0) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NONE_VALID_ACCESS_POINT);
+    }
+errors:
+    SIGFOX_RETURN();
+}
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST))
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_ssid_black_list_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, const SIGFOX_EP_ADDON_AW_API_ssid_black_list_t *ssid_black_list) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if (context == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Update context (NULL selects the default black list).
+    context->ssid_black_list = (ssid_black_list == SIGFOX_NULL) ? &SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_DEFAULT : ssid_black_list;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_compile_ssid_black_list(const sfx_u8 * const *word_list, sfx_u8 word_list_size, sfx_u8 *buffer, sfx_u16 buffer_size, SIGFOX_EP_ADDON_AW_API_ssid_black_list_t *ssid_black_list) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    sfx_u8 *class_map = buffer;
+    sfx_u8 *match_bitmap = SIGFOX_NULL;
+    sfx_u8 *transition_table = SIGFOX_NULL;
+    sfx_u16 nb_chars = 0;
+    sfx_u16 word_length = 0;
+    sfx_u16 word_length_max = 0;
+    sfx_u16 table_size = 0;
+    sfx_u16 idx = 0;
+    sfx_u8 nb_states = 1;
+    sfx_u8 nb_classes = 1;
+    sfx_u8 word_idx = 0;
+    sfx_u8 depth = 0;
+    sfx_u8 state = 0;
+    sfx_u8 next_state = 0;
+    sfx_u8 fail_state = 0;
+    sfx_u8 char_class = 0;
+    sfx_u8 ascii_character = 0;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((word_list == SIGFOX_NULL) || (buffer == SIGFOX_NULL) || (ssid_black_list == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Mark output as empty until the compilation succeeds.
+    ssid_black_list->nb_states = 0;
+    if (buffer_size < SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_CLASS_MAP_SIZE) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_SSID_BLACK_LIST);
+    }
+    // Build the characters class map.
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_CLASS_MAP_SIZE; idx++) {
+        class_map[idx] = SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_OTHER_CLASS;
+    }
+    for (word_idx = 0; word_idx < word_list_size; word_idx++) {
+        // Empty words would match any SSID.
+        if ((word_list[word_idx] == SIGFOX_NULL) || (word_list[word_idx][0] == SIGFOX_EP_ADDON_AW_API_NULL_CHAR)) {
+            SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_SSID_BLACK_LIST);
+        }
+        for (word_length = 0; word_list[word_idx][word_length] != SIGFOX_EP_ADDON_AW_API_NULL_CHAR; word_length++) {
+            ascii_character = _to_lowercase(word_list[word_idx][word_length]);
+            if ((ascii_character >= SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_CLASS_MAP_SIZE) || (word_length >= SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR)) {
+                SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_SSID_BLACK_LIST);
+            }
+            if (class_map[ascii_character] == SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_OTHER_CLASS) {
+                class_map[ascii_character] = nb_classes;
+                nb_classes++;
+            }
+        }
+        nb_chars += word_length;
+        word_length_max = (word_length > word_length_max) ? word_length : word_length_max;
+    }
+    // Case folding.
+    for (ascii_character = 'A'; ascii_character <= 'Z'; ascii_character++) {
+        class_map[ascii_character] = class_map[ascii_character + SIGFOX_EP_ADDON_AW_UPPERCASE_OFFSET];
+    }
+    // Check memory (number of states is bounded by the number of characters).
+    if ((nb_chars + 1) > SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_NB_STATES_MAX) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_SSID_BLACK_LIST);
+    }
+    table_size = (sfx_u16) ((nb_chars + 1) * nb_classes);
+    if (buffer_size < SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_BUFFER_SIZE(nb_chars, (nb_classes - 1))) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_SSID_BLACK_LIST);
+    }
+    match_bitmap = &(buffer[SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_CLASS_MAP_SIZE]);
+    transition_table = &(match_bitmap[(nb_chars + 8) / 8]);
+    for (idx = 0; idx < ((nb_chars + 8) / 8); idx++) {
+        match_bitmap[idx] = 0;
+    }
+    for (idx = 0; idx < table_size; idx++) {
+        transition_table[idx] = SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_ROOT_STATE;
+    }
+    // Build the trie depth by depth, so that states are numbered in breadth-first order.
+    for (depth = 0; depth < word_length_max; depth++) {
+        for (word_idx = 0; word_idx < word_list_size; word_idx++) {
+            // Go to the state of the current prefix.
+            state = SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_ROOT_STATE;
+            for (idx = 0; idx <= depth; idx++) {
+                if (word_list[word_idx][idx] == SIGFOX_EP_ADDON_AW_API_NULL_CHAR) break;
+                char_class = class_map[word_list[word_idx][idx]];
+                next_state = transition_table[((sfx_u16) state * nb_classes) + char_class];
+                // Create missing state (only the last character of the prefix can be new).
+                if (next_state == SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_ROOT_STATE) {
+                    next_state = nb_states;
+                    transition_table[((sfx_u16) state * nb_classes) + char_class] = next_state;
+                    nb_states++;
+                }
+                state = next_state;
+            }
+            // Mark end of word.
+            if ((idx == (depth + 1)) && (word_list[word_idx][idx] == SIGFOX_EP_ADDON_AW_API_NULL_CHAR)) {
+                match_bitmap[state >> 3] |= (1 << (state & 0x07));
+            }
+        }
+    }
+    // Convert the trie to a deterministic automaton (failure links are temporarily stored in the unused class 0 column).
+    for (state = 0; state < nb_states; state++) {
+        fail_state = transition_table[(sfx_u16) state * nb_classes];
+        for (char_class = 1; char_class < nb_classes; char_class++) {
+            next_state = transition_table[((sfx_u16) state * nb_classes) + char_class];
+            if (next_state != SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_ROOT_STATE) {
+                // Trie edge: compute failure link of the child and inherit its matches.
+                idx = (state == SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_ROOT_STATE) ? SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_ROOT_STATE : transition_table[((sfx_u16) fail_state * nb_classes) + char_class];
+                transition_table[(sfx_u16) next_state * nb_classes] = (sfx_u8) idx;
+                if (((match_bitmap[idx >> 3]) & (1 << (idx & 0x07))) != 0) {
+                    match_bitmap[next_state >> 3] |= (1 << (next_state & 0x07));
+                }
+            }
+            else if (state != SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_ROOT_STATE) {
+                // Missing edge: follow the failure link.
+                transition_table[((sfx_u16) state * nb_classes) + char_class] = transition_table[((sfx_u16) fail_state * nb_classes) + char_class];
+            }
+        }
+    }
+    // Characters which are not part of any word always go back to the root state.
+    for (state = 0; state < nb_states; state++) {
+        transition_table[(sfx_u16) state * nb_classes] = SIGFOX_EP_ADDON_AW_API_SSID_BLACK_LIST_ROOT_STATE;
+    }
+    // Update output.
+    ssid_black_list->class_map = class_map;
+    ssid_black_list->match_bitmap = match_bitmap;
+    ssid_black_list->transition_table = transition_table;
+    ssid_black_list->nb_classes = nb_classes;
+    ssid_black_list->nb_states = nb_states;
+errors:
+    SIGFOX_RETURN();
+}
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_RSSI_MIN))
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_rssi_min_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_s16 rssi_min_dbm) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if (context == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Update context.
+    context->rssi_min_dbm = rssi_min_dbm;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST))
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_oui_black_list_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, const SIGFOX_EP_ADDON_AW_API_oui_table_t *oui_black_list) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if (context == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+    if (oui_black_list != SIGFOX_NULL) {
+        if (((oui_black_list->oui_table) == SIGFOX_NULL) && ((oui_black_list->nb_ouis) != 0)) {
+            SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+        }
+        if (_oui_table_is_sorted(oui_black_list) == SIGFOX_FALSE) {
+            SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_OUI_BLACK_LIST);
+        }
+    }
+#endif
+    // Update context (NULL selects an empty black list).
+    context->oui_black_list = oui_black_list;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_aggregator_init(SIGFOX_EP_ADDON_AW_API_aggregator_t *aggregator, SIGFOX_EP_ADDON_AW_API_access_point_t *access_point_table, SIGFOX_EP_ADDON_AW_API_access_point_t **access_point_list, SIGFOX_EP_ADDON_AW_API_index_t size) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((aggregator == SIGFOX_NULL) || (access_point_table == SIGFOX_NULL) || (access_point_list == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+    if (size == 0) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_ACCESS_POINT_LIST_SIZE);
+    }
+#endif
+    // Empty table.
+    aggregator->access_point_table = access_point_table;
+    aggregator->access_point_table_size = size;
+    aggregator->input_data.access_point_list = access_point_list;
+    aggregator->input_data.access_point_list_size = 0;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
 errors:
 #endif
     SIGFOX_RETURN();
 }
 
 /*******************************************************************/
-static void _sort_none(SIGFOX_EP_ADDON_AW_API_input_data_t *input_data) {
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_aggregator_add_scan(SIGFOX_EP_ADDON_AW_API_aggregator_t *aggregator, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data) {
     // Local variables.
-    sfx_u8 ap_idx = 0;
-    sfx_u8 ap_select_count = 0;
-    // Loop on all access points.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_point;
+    SIGFOX_EP_ADDON_AW_API_access_point_t *merged_access_point = SIGFOX_NULL;
+    sfx_u8 mac_address_bytes[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES];
+    SIGFOX_EP_ADDON_AW_API_index_t ap_idx = 0;
+    SIGFOX_EP_ADDON_AW_API_index_t merged_idx = 0;
+    sfx_s32 rssi_delta_dbm = 0;
+    sfx_u8 idx = 0;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((aggregator == SIGFOX_NULL) || (input_data == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+    if ((aggregator->access_point_table == SIGFOX_NULL) || (input_data->access_point_list == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Loop on all access points of the scan.
     for (ap_idx = 0; ap_idx < (input_data->access_point_list_size); ap_idx++) {
-        // Select elements in initial list order.
-        if (input_data->access_point_list[ap_idx]->status == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID) {
-            sigfox_ep_addon_aw_api_ctx.best_index[ap_select_count] = ap_idx;
-            ap_select_count++;
+        access_point = (input_data->access_point_list[ap_idx]);
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+        if (access_point == SIGFOX_NULL) {
+            SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
         }
-        if (ap_select_count >= SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD) {
-            break;
+#endif
+        // Access points are identified by their decoded MAC address.
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = _mac_address_ascii_to_bytes_array((access_point->mac_address), mac_address_bytes);
+        SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
+#else
+        _mac_address_ascii_to_bytes_array((access_point->mac_address), mac_address_bytes);
+#endif
+        // Search access point in table.
+        merged_access_point = SIGFOX_NULL;
+        for (merged_idx = 0; merged_idx < (aggregator->input_data.access_point_list_size); merged_idx++) {
+            if (_mac_address_is_equal((aggregator->access_point_table[merged_idx].mac_address_bytes), mac_address_bytes) == SIGFOX_TRUE) {
+                merged_access_point = &(aggregator->access_point_table[merged_idx]);
+                break;
+            }
+        }
+        if (merged_access_point == SIGFOX_NULL) {
+            // Ignore new access points when the table is full.
+            if ((aggregator->input_data.access_point_list_size) >= (aggregator->access_point_table_size)) continue;
+            // Add access point.
+            merged_access_point = &(aggregator->access_point_table[aggregator->input_data.access_point_list_size]);
+            (*merged_access_point) = (*access_point);
+            for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES; idx++) {
+                merged_access_point->mac_address_bytes[idx] = mac_address_bytes[idx];
+            }
+            merged_access_point->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_NEW;
+            merged_access_point->nb_scans = 1;
+            aggregator->input_data.access_point_list[aggregator->input_data.access_point_list_size] = merged_access_point;
+            aggregator->input_data.access_point_list_size++;
+            continue;
+        }
+        // Update RSSI running mean (rounded to the nearest integer) and scans count.
+        if ((merged_access_point->nb_scans) < 0xFF) {
+            merged_access_point->nb_scans++;
         }
+        rssi_delta_dbm = ((sfx_s32) (access_point->rssi_dbm)) - ((sfx_s32) (merged_access_point->rssi_dbm));
+        rssi_delta_dbm = (rssi_delta_dbm >= 0) ? ((rssi_delta_dbm + ((merged_access_point->nb_scans) / 2)) / (merged_access_point->nb_scans)) : -(((-rssi_delta_dbm) + ((merged_access_point->nb_scans) / 2)) / (merged_access_point->nb_scans));
+        merged_access_point->rssi_dbm = (sfx_s16) ((merged_access_point->rssi_dbm) + rssi_delta_dbm);
     }
+#if ((defined SIGFOX_EP_PARAMETERS_CHECK) || (defined SIGFOX_EP_ERROR_CODES))
+errors:
+#endif
+    SIGFOX_RETURN();
 }
 
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
 /*******************************************************************/
-static void _sort_rssi(SIGFOX_EP_ADDON_AW_API_input_data_t *input_data) {
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_timestamp_callback_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_timestamp_cb_t timestamp_cb) {
     // Local variables.
-    sfx_s16 rssi_dbm_max = 0;
-    sfx_u8 rssi_dbm_max_idx = 0;
-    sfx_u8 ap_idx = 0;
-    sfx_bool new_ap_idx = SIGFOX_TRUE;
-    sfx_u8 ap_select_count = 0;
-    sfx_u8 search_idx = 0;
-    sfx_u8 idx = 0;
-    // Search loop.
-    for (search_idx = 0; search_idx < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD; search_idx++) {
-        // Reset reference.
-        rssi_dbm_max = SIGFOX_EP_ADDON_AW_API_S16_MIN;
-        rssi_dbm_max_idx = SIGFOX_EP_ADDON_AW_API_BEST_INDEX_NONE;
-        // Loop on all access points.
-        for (ap_idx = 0; ap_idx < (input_data->access_point_list_size); ap_idx++) {
-            // Directly exit if the access point has been filtered out.
-            if (input_data->access_point_list[ap_idx]->status != SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_VALID) continue;
-            // Compare to reference.
-            if ((input_data->access_point_list[ap_idx]->rssi_dbm) > rssi_dbm_max) {
-                // Check if index has not already been selected.
-                new_ap_idx = SIGFOX_TRUE;
-                for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD; idx++) {
-                    if (ap_idx == sigfox_ep_addon_aw_api_ctx.best_index[idx]) {
-                        new_ap_idx = SIGFOX_FALSE;
-                        break;
-                    }
-                }
-                if (new_ap_idx == SIGFOX_TRUE) {
-                    // Store new reference.
-                    rssi_dbm_max = (input_data->access_point_list[ap_idx]->rssi_dbm);
-                    rssi_dbm_max_idx = ap_idx;
-                }
-            }
-        }
-        sigfox_ep_addon_aw_api_ctx.best_index[ap_select_count] = rssi_dbm_max_idx;
-        ap_select_count++;
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if (context == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
     }
+#endif
+    // Update callback and restart measurements.
+    context->timestamp_cb = timestamp_cb;
+    _timing_reset(context);
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
 }
 
 /*******************************************************************/
-static SIGFOX_EP_ADDON_AW_API_status_t _sort_list(SIGFOX_EP_ADDON_AW_API_input_data_t *input_data) {
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_get_timing_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_timing_t *timing) {
     // Local variables.
 #ifdef SIGFOX_EP_ERROR_CODES
     SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
 #endif
     sfx_u8 idx = 0;
-    // Reset selected indexes.
-    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD; idx++) {
-        sigfox_ep_addon_aw_api_ctx.best_index[idx] = SIGFOX_EP_ADDON_AW_API_BEST_INDEX_NONE;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((context == SIGFOX_NULL) || (timing == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
     }
-    // Execute sorting function.
-    SIGFOX_EP_ADDON_AW_API_SORT[sigfox_ep_addon_aw_api_ctx.sorting](input_data);
+#endif
+    // Copy and reset totals.
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_STAGE_LAST; idx++) {
+        timing->stage_total[idx] = context->timing.stage_total[idx];
+    }
+    _timing_reset(context);
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
     SIGFOX_RETURN();
 }
+#endif
 
-/*** SIGFOX EP ADDON AW API functions ***/
+#ifdef SIGFOX_EP_ADDON_AW_STATISTICS
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_get_statistics_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_statistics_t *statistics) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((context == SIGFOX_NULL) || (statistics == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Compute mean RSSI.
+    if ((context->statistics.nb_valid) != 0) {
+        context->statistics.rssi_mean_dbm = (sfx_s16) ((context->statistics_rssi_sum) / ((sfx_s32) (context->statistics.nb_valid)));
+    }
+    // Copy and reset statistics.
+    (*statistics) = (context->statistics);
+    _statistics_reset(context);
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+#endif
 
+#ifdef SIGFOX_EP_ADDON_AW_PACKED_INPUT
 /*******************************************************************/
-SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_filter(sfx_u8 filters, SIGFOX_EP_ADDON_AW_API_sorting_t sorting) {
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_pack_access_point_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_u8 *mac_address, sfx_u8 *ssid, sfx_s16 rssi_dbm, SIGFOX_EP_ADDON_AW_API_packed_access_point_t *packed_access_point) {
     // Local variables.
 #ifdef SIGFOX_EP_ERROR_CODES
     SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
 #endif
 #ifdef SIGFOX_EP_PARAMETERS_CHECK
     // Check parameters.
-    if (sorting >= SIGFOX_EP_ADDON_AW_API_SORTING_LAST) {
-        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_SORTING);
+    if ((context == SIGFOX_NULL) || (mac_address == SIGFOX_NULL) || (packed_access_point == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+#if ((defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) && !(defined SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST))
+    SIGFOX_UNUSED(context);
+#endif
+    // Decode MAC address.
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _mac_address_ascii_to_bytes_array(mac_address, (packed_access_point->mac_address_bytes));
+    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
+#else
+    _mac_address_ascii_to_bytes_array(mac_address, (packed_access_point->mac_address_bytes));
+#endif
+    // Saturate RSSI.
+    if (rssi_dbm < SIGFOX_EP_ADDON_AW_API_PACKED_RSSI_MIN_DBM) {
+        rssi_dbm = SIGFOX_EP_ADDON_AW_API_PACKED_RSSI_MIN_DBM;
+    }
+    if (rssi_dbm > SIGFOX_EP_ADDON_AW_API_PACKED_RSSI_MAX_DBM) {
+        rssi_dbm = SIGFOX_EP_ADDON_AW_API_PACKED_RSSI_MAX_DBM;
+    }
+    packed_access_point->rssi_dbm = (sfx_s8) rssi_dbm;
+    // Compute SSID flags, so that the SSID does not need to be stored.
+    packed_access_point->info = (sfx_u8) SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_NEW;
+    if ((ssid == SIGFOX_NULL) || (ssid[0] == SIGFOX_EP_ADDON_AW_API_NULL_CHAR)) {
+        packed_access_point->info |= SIGFOX_EP_ADDON_AW_API_PACKED_INFO_SSID_EMPTY;
+    }
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_SSID_BLACK_LIST))
+    else if (_ssid_is_black_listed((context->ssid_black_list), ssid) == SIGFOX_TRUE) {
+        packed_access_point->info |= SIGFOX_EP_ADDON_AW_API_PACKED_INFO_SSID_BLACK_LISTED;
+    }
+#endif
+#if ((defined SIGFOX_EP_PARAMETERS_CHECK) || (defined SIGFOX_EP_ERROR_CODES))
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_build_ul_payload_packed_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_packed_input_data_t *packed_input_data, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((context == SIGFOX_NULL) || (packed_input_data == SIGFOX_NULL) || (ul_payload == SIGFOX_NULL) || (nb_mac_ul_payload == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
     }
 #endif
-    // Update local context.
-    sigfox_ep_addon_aw_api_ctx.filters = filters;
-    sigfox_ep_addon_aw_api_ctx.sorting = sorting;
+    // Build payload.
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = _build_ul_payload_packed(context, packed_input_data, ul_payload, nb_mac_ul_payload);
+#else
+    _build_ul_payload_packed(context, packed_input_data, ul_payload, nb_mac_ul_payload);
+#endif
 #ifdef SIGFOX_EP_PARAMETERS_CHECK
 errors:
 #endif
     SIGFOX_RETURN();
 }
+#endif
 
+#ifdef SIGFOX_EP_ADDON_AW_STREAM
 /*******************************************************************/
-SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_build_ul_payload(SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, sfx_u8 *ul_payload, sfx_u8 *nb_mac_ul_payload) {
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_stream_init_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_stream_t *stream) {
     // Local variables.
 #ifdef SIGFOX_EP_ERROR_CODES
     SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
 #endif
-    sfx_u8 mac_address_bytes[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES];
-    sfx_u8 ap_idx = 0;
-    sfx_u8 best_idx = 0;
-    sfx_u8 byte_idx = 0;
 #ifdef SIGFOX_EP_PARAMETERS_CHECK
-    if ((input_data == SIGFOX_NULL) || (ul_payload == SIGFOX_NULL) || (nb_mac_ul_payload == SIGFOX_NULL)) {
+    // Check parameters.
+    if ((context == SIGFOX_NULL) || (stream == SIGFOX_NULL)) {
         SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
     }
-    if (input_data->access_point_list == SIGFOX_NULL) {
+#endif
+    // Reset stream.
+    stream->context = context;
+    _stream_reset_record(stream);
+    stream->parser_state = SIGFOX_EP_ADDON_AW_API_STREAM_STATE_PREFIX;
+    stream->parser_flags = 0;
+    stream->field_idx = 0;
+    stream->char_idx = 0;
+    stream->nb_candidates = 0;
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+    stream->nb_recent_candidates = 0;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_COMPACT_PAYLOAD
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_compact_dictionary_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, const SIGFOX_EP_ADDON_AW_API_oui_table_t *compact_dictionary) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if (context == SIGFOX_NULL) {
         SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
     }
-    if (input_data->access_point_list_size == 0) {
-        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_ACCESS_POINT_LIST_SIZE);
+    if (compact_dictionary != SIGFOX_NULL) {
+        if (((compact_dictionary->oui_table) == SIGFOX_NULL) && ((compact_dictionary->nb_ouis) != 0)) {
+            SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+        }
+        if (((compact_dictionary->nb_ouis) > SIGFOX_EP_ADDON_AW_API_COMPACT_DICTIONARY_SIZE_MAX) || (_oui_table_is_sorted(compact_dictionary) == SIGFOX_FALSE)) {
+            SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_COMPACT_DICTIONARY);
+        }
     }
 #endif
-    // Reset payload and MAC address count.
-    for (byte_idx = 0; byte_idx < SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES; byte_idx ++) {
-        ul_payload[byte_idx] = 0x00;
+    // Update context (NULL selects an empty dictionary).
+    context->compact_dictionary = compact_dictionary;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_build_ul_payload_compact_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, sfx_u8 *ul_payload, sfx_u8 *nb_access_points_ul_payload) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((context == SIGFOX_NULL) || (input_data == SIGFOX_NULL) || (ul_payload == SIGFOX_NULL) || (nb_access_points_ul_payload == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
     }
-    (*nb_mac_ul_payload) = 0;
-    // Apply filters.
+#endif
+    // Build payload.
 #ifdef SIGFOX_EP_ERROR_CODES
-    status = _filter_list(input_data);
-    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
+    status = _build_ul_payload_compact(context, input_data, ul_payload, nb_access_points_ul_payload);
 #else
-    _filter_list(input_data);
+    _build_ul_payload_compact(context, input_data, ul_payload, nb_access_points_ul_payload);
 #endif
-    // Sort list.
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_ASYNC
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_async_init_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_async_t *async, SIGFOX_EP_ADDON_AW_API_async_callbacks_t *callbacks) {
+    // Local variables.
 #ifdef SIGFOX_EP_ERROR_CODES
-    status = _sort_list(input_data);
-    SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
-#else
-    _sort_list(input_data);
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
 #endif
-    // Select the best indexes.
-    for (ap_idx = 0; ap_idx < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD; ap_idx++) {
-        // Read best index.
-        best_idx = sigfox_ep_addon_aw_api_ctx.best_index[ap_idx];
-        // Check best index.
-        if (best_idx != SIGFOX_EP_ADDON_AW_API_BEST_INDEX_NONE) {
-            // Convert ASCII to bytes array.
+    sfx_u8 idx = 0;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((context == SIGFOX_NULL) || (async == SIGFOX_NULL) || (callbacks == SIGFOX_NULL) || ((callbacks->send_cb) == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Reset async layer.
+    async->context = context;
+    async->callbacks = (*callbacks);
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_ASYNC_NB_BUFFERS; idx++) {
+        async->nb_mac_ul_payload[idx] = 0;
+        async->buffer_state[idx] = SIGFOX_EP_ADDON_AW_API_ASYNC_BUFFER_STATE_FREE;
+    }
+    async->scan_state = SIGFOX_EP_ADDON_AW_API_ASYNC_SCAN_STATE_IDLE;
+    async->send_complete = 0;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+#endif
+
+#ifdef SIGFOX_EP_ADDON_AW_HISTORY
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_history_mode_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_history_mode_t history_mode, sfx_u8 history_age_max) {
+    // Local variables.
 #ifdef SIGFOX_EP_ERROR_CODES
-            status = _mac_address_ascii_to_bytes_array((input_data->access_point_list[best_idx]->mac_address), mac_address_bytes);
-            SIGFOX_CHECK_STATUS(SIGFOX_EP_ADDON_AW_API_SUCCESS);
-#else
-            _mac_address_ascii_to_bytes_array((input_data->access_point_list[best_idx]->mac_address), mac_address_bytes);
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
 #endif
-            // Fill payload.
-            for (byte_idx = 0; byte_idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES; byte_idx++) {
-                ul_payload[(SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES * (*nb_mac_ul_payload)) + byte_idx] = mac_address_bytes[byte_idx];
-            }
-            // Update access point status.
-            input_data->access_point_list[best_idx]->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_SENT;
-            // Update MAC address count.
-            (*nb_mac_ul_payload)++;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if (context == SIGFOX_NULL) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+    if ((history_mode >= SIGFOX_EP_ADDON_AW_API_HISTORY_MODE_LAST) || (history_age_max == 0)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_HISTORY);
+    }
+#endif
+    // Update context.
+    context->history_mode = history_mode;
+    context->history_age_max = history_age_max;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_get_history_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_u8 *history_data) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    sfx_u8 entry_idx = 0;
+    sfx_u8 byte_idx = 0;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((context == SIGFOX_NULL) || (history_data == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Write the key bytes then the age of each entry (independent of the structure layout).
+    for (entry_idx = 0; entry_idx < SIGFOX_EP_ADDON_AW_API_HISTORY_SIZE; entry_idx++) {
+        for (byte_idx = 0; byte_idx < SIGFOX_EP_ADDON_AW_API_HISTORY_KEY_SIZE_BYTES; byte_idx++) {
+            (*(history_data++)) = (context->history[entry_idx].key[byte_idx]);
         }
+        (*(history_data++)) = (context->history[entry_idx].age);
     }
-    // Check if at least one valid MAC address has been found.
-    if ((*nb_mac_ul_payload) == 0) {
-        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NONE_VALID_ACCESS_POINT);
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+errors:
+#endif
+    SIGFOX_RETURN();
+}
+
+/*******************************************************************/
+SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_API_set_history_ctx(SIGFOX_EP_ADDON_AW_API_context_t *context, const sfx_u8 *history_data) {
+    // Local variables.
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    sfx_u8 entry_idx = 0;
+    sfx_u8 byte_idx = 0;
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    // Check parameters.
+    if ((context == SIGFOX_NULL) || (history_data == SIGFOX_NULL)) {
+        SIGFOX_EXIT_ERROR(SIGFOX_EP_ADDON_AW_API_ERROR_NULL_PARAMETER);
+    }
+#endif
+    // Read the entries in the same order (the ages above the maximum age are expired).
+    for (entry_idx = 0; entry_idx < SIGFOX_EP_ADDON_AW_API_HISTORY_SIZE; entry_idx++) {
+        for (byte_idx = 0; byte_idx < SIGFOX_EP_ADDON_AW_API_HISTORY_KEY_SIZE_BYTES; byte_idx++) {
+            context->history[entry_idx].key[byte_idx] = (*(history_data++));
+        }
+        context->history[entry_idx].age = (*(history_data++));
     }
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
 errors:
+#endif
     SIGFOX_RETURN();
 }
+#endif
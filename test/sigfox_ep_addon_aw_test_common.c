@@ -0,0 +1,123 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_aw_test_common.c
+ * \brief   Sigfox End-Point Atlas WiFi addon tests and benchmark common functions.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2025, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#include "sigfox_ep_addon_aw_test_common.h"
+
+#include <string.h>
+
+#include "sigfox_types.h"
+
+/*** SIGFOX EP ADDON AW TEST COMMON local global variables ***/
+
+static const char SIGFOX_EP_ADDON_AW_TEST_COMMON_HEX_DIGITS_LOWER[] = "0123456789abcdef";
+static const char SIGFOX_EP_ADDON_AW_TEST_COMMON_HEX_DIGITS_UPPER[] = "0123456789ABCDEF";
+
+static sfx_u32 sigfox_ep_addon_aw_test_common_random = 1;
+
+/*** SIGFOX EP ADDON AW TEST COMMON functions ***/
+
+/*******************************************************************/
+void SIGFOX_EP_ADDON_AW_TEST_COMMON_set_seed(sfx_u32 seed) {
+    sigfox_ep_addon_aw_test_common_random = seed;
+}
+
+/*******************************************************************/
+sfx_u32 SIGFOX_EP_ADDON_AW_TEST_COMMON_random(void) {
+    // Xorshift generator, to get the same lists on all hosts.
+    sigfox_ep_addon_aw_test_common_random ^= (sigfox_ep_addon_aw_test_common_random << 13);
+    sigfox_ep_addon_aw_test_common_random ^= (sigfox_ep_addon_aw_test_common_random >> 17);
+    sigfox_ep_addon_aw_test_common_random ^= (sigfox_ep_addon_aw_test_common_random << 5);
+    return sigfox_ep_addon_aw_test_common_random;
+}
+
+/*******************************************************************/
+void SIGFOX_EP_ADDON_AW_TEST_COMMON_write_mac_address(const sfx_u8 *mac_address_bytes, sfx_bool upper_case, sfx_u8 *mac_address) {
+    // Local variables.
+    const char *hex_digits = (upper_case == SIGFOX_TRUE) ? SIGFOX_EP_ADDON_AW_TEST_COMMON_HEX_DIGITS_UPPER : SIGFOX_EP_ADDON_AW_TEST_COMMON_HEX_DIGITS_LOWER;
+    sfx_u8 byte_idx = 0;
+    for (byte_idx = 0; byte_idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES; byte_idx++) {
+        mac_address[3 * byte_idx] = (sfx_u8) hex_digits[mac_address_bytes[byte_idx] >> 4];
+        mac_address[(3 * byte_idx) + 1] = (sfx_u8) hex_digits[mac_address_bytes[byte_idx] & 0x0F];
+        if (byte_idx < (SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES - 1)) {
+            mac_address[(3 * byte_idx) + 2] = ':';
+        }
+    }
+}
+
+/*******************************************************************/
+void SIGFOX_EP_ADDON_AW_TEST_COMMON_init_access_point(SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, const sfx_u8 *mac_address_bytes, sfx_bool upper_case, const char *ssid, sfx_s16 rssi_dbm) {
+    // Local variables.
+    size_t ssid_length = 0;
+    memset(access_point, 0, sizeof(SIGFOX_EP_ADDON_AW_API_access_point_t));
+    SIGFOX_EP_ADDON_AW_TEST_COMMON_write_mac_address(mac_address_bytes, upper_case, (access_point->mac_address));
+    // The SSID field has no null character when it is full.
+    if (ssid != SIGFOX_NULL) {
+        ssid_length = strlen(ssid);
+        memcpy((access_point->ssid), ssid, ((ssid_length < SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR) ? ssid_length : SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR));
+    }
+    access_point->rssi_dbm = rssi_dbm;
+    access_point->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_NEW;
+}
+
+/*******************************************************************/
+void SIGFOX_EP_ADDON_AW_TEST_COMMON_init_list(SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, SIGFOX_EP_ADDON_AW_API_access_point_t *access_points, SIGFOX_EP_ADDON_AW_API_access_point_t **access_point_list, SIGFOX_EP_ADDON_AW_API_index_t list_size) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_index_t idx = 0;
+    for (idx = 0; idx < list_size; idx++) {
+        access_point_list[idx] = &(access_points[idx]);
+        access_points[idx].status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_NEW;
+    }
+    input_data->access_point_list = access_point_list;
+    input_data->access_point_list_size = list_size;
+}
+
+/*******************************************************************/
+void SIGFOX_EP_ADDON_AW_TEST_COMMON_configure(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_u8 filters, SIGFOX_EP_ADDON_AW_API_sorting_t sorting, sfx_s16 rssi_min_dbm, const SIGFOX_EP_ADDON_AW_API_oui_table_t *oui_black_list) {
+    SIGFOX_EP_ADDON_AW_API_init_context(context);
+    SIGFOX_EP_ADDON_AW_API_set_filter_ctx(context, filters, sorting);
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_RSSI_MIN))
+    SIGFOX_EP_ADDON_AW_API_set_rssi_min_ctx(context, rssi_min_dbm);
+#else
+    SIGFOX_UNUSED(rssi_min_dbm);
+#endif
+#if (!(defined SIGFOX_EP_ADDON_AW_STATIC_FILTERS) || (defined SIGFOX_EP_ADDON_AW_FILTER_OUI_BLACK_LIST))
+    if (oui_black_list != SIGFOX_NULL) {
+        SIGFOX_EP_ADDON_AW_API_set_oui_black_list_ctx(context, oui_black_list);
+    }
+#else
+    SIGFOX_UNUSED(oui_black_list);
+#endif
+}
@@ -0,0 +1,107 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_aw_test_common.h
+ * \brief   Sigfox End-Point Atlas WiFi addon tests and benchmark common functions.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2025, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#ifndef __SIGFOX_EP_ADDON_AW_TEST_COMMON_H__
+#define __SIGFOX_EP_ADDON_AW_TEST_COMMON_H__
+
+#include "sigfox_ep_addon_aw_api.h"
+
+/*** SIGFOX EP ADDON AW TEST COMMON functions ***/
+
+/*!******************************************************************
+ * \fn void SIGFOX_EP_ADDON_AW_TEST_COMMON_set_seed(sfx_u32 seed)
+ * \brief Restart the pseudo-random sequence, to get the same lists on all hosts and for all flags builds.
+ * \param[in]   seed: Non-zero seed of the sequence.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_EP_ADDON_AW_TEST_COMMON_set_seed(sfx_u32 seed);
+
+/*!******************************************************************
+ * \fn sfx_u32 SIGFOX_EP_ADDON_AW_TEST_COMMON_random(void)
+ * \brief Get the next value of the pseudo-random sequence (xorshift generator, not thread-safe).
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Next pseudo-random value.
+ *******************************************************************/
+sfx_u32 SIGFOX_EP_ADDON_AW_TEST_COMMON_random(void);
+
+/*!******************************************************************
+ * \fn void SIGFOX_EP_ADDON_AW_TEST_COMMON_write_mac_address(const sfx_u8 *mac_address_bytes, sfx_bool upper_case, sfx_u8 *mac_address)
+ * \brief Write a MAC address as reported by the WiFi modules (17 characters, without null character).
+ * \param[in]   mac_address_bytes: 6-bytes MAC address.
+ * \param[in]   upper_case: Use upper case hexadecimal digits if SIGFOX_TRUE, lower case otherwise.
+ * \param[out]  mac_address: Buffer of at least SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR characters.
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_EP_ADDON_AW_TEST_COMMON_write_mac_address(const sfx_u8 *mac_address_bytes, sfx_bool upper_case, sfx_u8 *mac_address);
+
+/*!******************************************************************
+ * \fn void SIGFOX_EP_ADDON_AW_TEST_COMMON_init_access_point(SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, const sfx_u8 *mac_address_bytes, sfx_bool upper_case, const char *ssid, sfx_s16 rssi_dbm)
+ * \brief Reset an access point with a new scan result.
+ * \param[in]   mac_address_bytes: 6-bytes MAC address.
+ * \param[in]   upper_case: Use upper case hexadecimal digits in the MAC address if SIGFOX_TRUE, lower case otherwise.
+ * \param[in]   ssid: Null terminated SSID, truncated to SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR characters (SIGFOX_NULL for an empty SSID).
+ * \param[in]   rssi_dbm: RSSI in dBm.
+ * \param[out]  access_point: Pointer to the access point.
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_EP_ADDON_AW_TEST_COMMON_init_access_point(SIGFOX_EP_ADDON_AW_API_access_point_t *access_point, const sfx_u8 *mac_address_bytes, sfx_bool upper_case, const char *ssid, sfx_s16 rssi_dbm);
+
+/*!******************************************************************
+ * \fn void SIGFOX_EP_ADDON_AW_TEST_COMMON_init_list(SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, SIGFOX_EP_ADDON_AW_API_access_point_t *access_points, SIGFOX_EP_ADDON_AW_API_access_point_t **access_point_list, SIGFOX_EP_ADDON_AW_API_index_t list_size)
+ * \brief Build the list of an access points array, and set all the access points as new (as after a new scan).
+ * \param[in]   access_points: Access points array.
+ * \param[in]   access_point_list: Caller-owned list of list_size pointers.
+ * \param[in]   list_size: Number of access points.
+ * \param[out]  input_data: Pointer to the input data referencing the list.
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_EP_ADDON_AW_TEST_COMMON_init_list(SIGFOX_EP_ADDON_AW_API_input_data_t *input_data, SIGFOX_EP_ADDON_AW_API_access_point_t *access_points, SIGFOX_EP_ADDON_AW_API_access_point_t **access_point_list, SIGFOX_EP_ADDON_AW_API_index_t list_size);
+
+/*!******************************************************************
+ * \fn void SIGFOX_EP_ADDON_AW_TEST_COMMON_configure(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_u8 filters, SIGFOX_EP_ADDON_AW_API_sorting_t sorting, sfx_s16 rssi_min_dbm, const SIGFOX_EP_ADDON_AW_API_oui_table_t *oui_black_list)
+ * \brief Initialize a context and set its filters (the settings of the filters which are not compiled are ignored).
+ * \param[in]   filters: Filters mask given to @ref SIGFOX_EP_ADDON_AW_API_set_filter_ctx.
+ * \param[in]   sorting: Sorting method.
+ * \param[in]   rssi_min_dbm: Minimum RSSI.
+ * \param[in]   oui_black_list: OUI black list (SIGFOX_NULL to keep the default one).
+ * \param[out]  context: Pointer to the context.
+ * \retval      none
+ *******************************************************************/
+void SIGFOX_EP_ADDON_AW_TEST_COMMON_configure(SIGFOX_EP_ADDON_AW_API_context_t *context, sfx_u8 filters, SIGFOX_EP_ADDON_AW_API_sorting_t sorting, sfx_s16 rssi_min_dbm, const SIGFOX_EP_ADDON_AW_API_oui_table_t *oui_black_list);
+
+#endif /* __SIGFOX_EP_ADDON_AW_TEST_COMMON_H__ */
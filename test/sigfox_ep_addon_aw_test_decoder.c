@@ -0,0 +1,284 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_aw_test_decoder.c
+ * \brief   Sigfox End-Point Atlas WiFi addon uplink payloads decoder test.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2025, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sigfox_ep_addon_aw_api.h"
+#include "sigfox_ep_addon_aw_test_common.h"
+#include "sigfox_ep_addon_aw_version.h"
+
+/*** SIGFOX EP ADDON AW TEST DECODER local macros ***/
+
+#define SIGFOX_EP_ADDON_AW_TEST_DECODER_NB_LISTS            20000
+#define SIGFOX_EP_ADDON_AW_TEST_DECODER_LIST_SIZE_MAX       6
+#define SIGFOX_EP_ADDON_AW_TEST_DECODER_SEED                0x2F6E2B1D
+#define SIGFOX_EP_ADDON_AW_TEST_DECODER_NB_ERRORS_MAX       10
+
+/*** SIGFOX EP ADDON AW TEST DECODER local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    const char *name;
+    sfx_u8 ul_payload[SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES];
+    sfx_u8 ul_payload_size_bytes;
+    SIGFOX_EP_ADDON_AW_API_payload_type_t payload_type;
+    sfx_u8 nb_mac;
+    sfx_u8 errors;
+} SIGFOX_EP_ADDON_AW_TEST_DECODER_payload_t;
+
+/*** SIGFOX EP ADDON AW TEST DECODER local global variables ***/
+
+static const SIGFOX_EP_ADDON_AW_TEST_DECODER_payload_t SIGFOX_EP_ADDON_AW_TEST_DECODER_PAYLOADS[] = {
+    // Atlas WiFi payloads.
+    { "1 MAC and padding", { 0xAC, 0x84, 0xC6, 0x11, 0x22, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 12, SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_ATLAS_WIFI, 1, 0 },
+    { "2 MAC", { 0xAC, 0x84, 0xC6, 0x11, 0x22, 0x33, 0xF4, 0xCA, 0xE5, 0x12, 0x34, 0x56 }, 12, SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_ATLAS_WIFI, 2, 0 },
+    { "2 MAC (locally administered)", { 0x02, 0x84, 0xC6, 0x11, 0x22, 0x33, 0xF6, 0xCA, 0xE5, 0x12, 0x34, 0x56 }, 12, SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_ATLAS_WIFI, 2, 0 },
+    { "2 MAC (second one almost padding)", { 0xAC, 0x84, 0xC6, 0x11, 0x22, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 }, 12, SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_ATLAS_WIFI, 2, 0 },
+    // Padding errors and invalid MAC addresses.
+    { "0 MAC (only padding)", { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 12, SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_ATLAS_WIFI, 1, SIGFOX_EP_ADDON_AW_API_DECODER_ERROR_RESERVED_MAC_ADDRESS },
+    { "padding before MAC", { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x84, 0xC6, 0x11, 0x22, 0x33 }, 12, SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_ATLAS_WIFI, 2, SIGFOX_EP_ADDON_AW_API_DECODER_ERROR_RESERVED_MAC_ADDRESS },
+    { "broadcast padding", { 0xAC, 0x84, 0xC6, 0x11, 0x22, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF }, 12, SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_ATLAS_WIFI, 2, SIGFOX_EP_ADDON_AW_API_DECODER_ERROR_RESERVED_MAC_ADDRESS },
+    { "partial padding", { 0xAC, 0x84, 0xC6, 0x11, 0x22, 0x33, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF }, 12, SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_ATLAS_WIFI, 2, SIGFOX_EP_ADDON_AW_API_DECODER_ERROR_RESERVED_MAC_ADDRESS },
+    { "multicast second MAC", { 0xAC, 0x84, 0xC6, 0x11, 0x22, 0x33, 0x01, 0x00, 0x5E, 0x00, 0x00, 0xFB }, 12, SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_ATLAS_WIFI, 2, SIGFOX_EP_ADDON_AW_API_DECODER_ERROR_MULTICAST_MAC_ADDRESS },
+    { "duplicate MAC", { 0xAC, 0x84, 0xC6, 0x11, 0x22, 0x33, 0xAC, 0x84, 0xC6, 0x11, 0x22, 0x33 }, 12, SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_ATLAS_WIFI, 2, SIGFOX_EP_ADDON_AW_API_DECODER_ERROR_DUPLICATE_MAC_ADDRESS },
+    { "reserved and multicast", { 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x33, 0x33, 0x00, 0x00, 0x00, 0x01 }, 12, SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_ATLAS_WIFI, 2, (SIGFOX_EP_ADDON_AW_API_DECODER_ERROR_RESERVED_MAC_ADDRESS | SIGFOX_EP_ADDON_AW_API_DECODER_ERROR_MULTICAST_MAC_ADDRESS) },
+    // Other payload types.
+    { "reserved", { 0x01, 0x84, 0xC6, 0x11, 0x22, 0x33, 0xF4, 0xCA, 0xE5, 0x12, 0x34, 0x56 }, 12, SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_RESERVED, 0, 0 },
+    { "reserved (padding)", { 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 12, SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_RESERVED, 0, 0 },
+    { "custom", { 0x03, 0x84, 0xC6, 0x11, 0x22, 0x33, 0xF4, 0xCA, 0xE5, 0x12, 0x34, 0x56 }, 12, SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_CUSTOM, 0, 0 },
+    { "custom (broadcast)", { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF }, 12, SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_CUSTOM, 0, 0 },
+    { "custom (short)", { 0xAC, 0x84, 0xC6, 0x11, 0x22, 0x33, 0xF4, 0xCA, 0xE5, 0x12, 0x34, 0x00 }, 11, SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_CUSTOM, 0, 0 },
+    { "custom (1 byte)", { 0xAC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, 1, SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_CUSTOM, 0, 0 },
+};
+
+#define SIGFOX_EP_ADDON_AW_TEST_DECODER_NB_PAYLOADS (sizeof(SIGFOX_EP_ADDON_AW_TEST_DECODER_PAYLOADS) / sizeof(SIGFOX_EP_ADDON_AW_TEST_DECODER_payload_t))
+
+// First bytes of the random MAC addresses: valid, locally administered, multicast and reserved addresses.
+static const sfx_u8 SIGFOX_EP_ADDON_AW_TEST_DECODER_FIRST_BYTES[] = {
+    0xAC, 0xF4, 0x3C, 0x00, 0x02, 0x01, 0xFF,
+};
+
+static sfx_u32 sigfox_ep_addon_aw_test_decoder_nb_cases = 0;
+static sfx_u32 sigfox_ep_addon_aw_test_decoder_nb_errors = 0;
+
+/*** SIGFOX EP ADDON AW TEST DECODER local functions ***/
+
+/*******************************************************************/
+static void _check(sfx_bool condition, const char *check, const char *name) {
+    sigfox_ep_addon_aw_test_decoder_nb_cases++;
+    if (condition == SIGFOX_FALSE) {
+        sigfox_ep_addon_aw_test_decoder_nb_errors++;
+        if (sigfox_ep_addon_aw_test_decoder_nb_errors <= SIGFOX_EP_ADDON_AW_TEST_DECODER_NB_ERRORS_MAX) {
+            printf("ERROR: %s (%s)\n", check, name);
+        }
+    }
+}
+
+/*******************************************************************/
+static void _check_decoded_payload(sfx_u8 *ul_payload, SIGFOX_EP_ADDON_AW_API_decoded_payload_t *decoded_payload, SIGFOX_EP_ADDON_AW_API_payload_type_t payload_type, sfx_u8 nb_mac, sfx_u8 errors, const char *name) {
+    // Local variables.
+    sfx_u8 mac_idx = 0;
+    _check(((decoded_payload->payload_type) == payload_type) ? SIGFOX_TRUE : SIGFOX_FALSE, "payload type", name);
+    _check(((decoded_payload->nb_mac) == nb_mac) ? SIGFOX_TRUE : SIGFOX_FALSE, "number of MAC addresses", name);
+    _check(((decoded_payload->errors) == errors) ? SIGFOX_TRUE : SIGFOX_FALSE, "errors", name);
+    // The decoded MAC addresses are the bytes of the payload.
+    for (mac_idx = 0; (mac_idx < (decoded_payload->nb_mac)) && (mac_idx < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD); mac_idx++) {
+        _check((memcmp((decoded_payload->mac_address_bytes[mac_idx]), &(ul_payload[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES * mac_idx]), SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES) == 0) ? SIGFOX_TRUE : SIGFOX_FALSE, "MAC address bytes", name);
+    }
+}
+
+/*******************************************************************/
+static void _test_payloads(void) {
+    // Local variables.
+    const SIGFOX_EP_ADDON_AW_TEST_DECODER_payload_t *payload = SIGFOX_NULL;
+    SIGFOX_EP_ADDON_AW_API_decoded_payload_t decoded_payload;
+    sfx_u32 idx = 0;
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_TEST_DECODER_NB_PAYLOADS; idx++) {
+        payload = &(SIGFOX_EP_ADDON_AW_TEST_DECODER_PAYLOADS[idx]);
+        // Result of a previous payload must not be kept.
+        memset(&decoded_payload, 0xA5, sizeof(SIGFOX_EP_ADDON_AW_API_decoded_payload_t));
+#ifdef SIGFOX_EP_ERROR_CODES
+        status = SIGFOX_EP_ADDON_AW_API_decode_ul_payload((sfx_u8*) (payload->ul_payload), (payload->ul_payload_size_bytes), &decoded_payload);
+        _check((status == SIGFOX_EP_ADDON_AW_API_SUCCESS) ? SIGFOX_TRUE : SIGFOX_FALSE, "decoder status", (payload->name));
+#else
+        SIGFOX_EP_ADDON_AW_API_decode_ul_payload((sfx_u8*) (payload->ul_payload), (payload->ul_payload_size_bytes), &decoded_payload);
+#endif
+        _check_decoded_payload((sfx_u8*) (payload->ul_payload), &decoded_payload, (payload->payload_type), (payload->nb_mac), (payload->errors), (payload->name));
+    }
+}
+
+/*******************************************************************/
+static void _test_batch(void) {
+    // Local variables.
+    sfx_u8 ul_payloads[SIGFOX_EP_ADDON_AW_TEST_DECODER_NB_PAYLOADS * SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES];
+    SIGFOX_EP_ADDON_AW_API_decoded_payload_t decoded_payloads[SIGFOX_EP_ADDON_AW_TEST_DECODER_NB_PAYLOADS];
+    SIGFOX_EP_ADDON_AW_API_decoder_summary_t summary;
+    SIGFOX_EP_ADDON_AW_API_decoder_summary_t summary_only;
+    SIGFOX_EP_ADDON_AW_API_decoder_summary_t expected_summary;
+    const SIGFOX_EP_ADDON_AW_TEST_DECODER_payload_t *payload = SIGFOX_NULL;
+    sfx_u32 nb_ul_payloads = 0;
+    sfx_u32 idx = 0;
+    sfx_u8 type_idx = 0;
+    memset(&expected_summary, 0, sizeof(SIGFOX_EP_ADDON_AW_API_decoder_summary_t));
+    // Contiguous array of the 12-bytes payloads.
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_TEST_DECODER_NB_PAYLOADS; idx++) {
+        payload = &(SIGFOX_EP_ADDON_AW_TEST_DECODER_PAYLOADS[idx]);
+        if ((payload->ul_payload_size_bytes) != SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES) continue;
+        memcpy(&(ul_payloads[SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES * nb_ul_payloads]), (payload->ul_payload), SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES);
+        expected_summary.nb_payloads[payload->payload_type]++;
+        expected_summary.nb_mac_addresses += (payload->nb_mac);
+        expected_summary.nb_invalid += ((payload->errors) != 0) ? 1 : 0;
+        nb_ul_payloads++;
+    }
+    memset(&summary, 0xA5, sizeof(SIGFOX_EP_ADDON_AW_API_decoder_summary_t));
+    memset(&summary_only, 0xA5, sizeof(SIGFOX_EP_ADDON_AW_API_decoder_summary_t));
+    SIGFOX_EP_ADDON_AW_API_decode_ul_payload_batch(ul_payloads, nb_ul_payloads, decoded_payloads, &summary);
+    SIGFOX_EP_ADDON_AW_API_decode_ul_payload_batch(ul_payloads, nb_ul_payloads, SIGFOX_NULL, &summary_only);
+    // Same results as the single payload decoder.
+    nb_ul_payloads = 0;
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_TEST_DECODER_NB_PAYLOADS; idx++) {
+        payload = &(SIGFOX_EP_ADDON_AW_TEST_DECODER_PAYLOADS[idx]);
+        if ((payload->ul_payload_size_bytes) != SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES) continue;
+        _check_decoded_payload((sfx_u8*) (payload->ul_payload), &(decoded_payloads[nb_ul_payloads]), (payload->payload_type), (payload->nb_mac), (payload->errors), (payload->name));
+        nb_ul_payloads++;
+    }
+    for (type_idx = 0; type_idx < SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_LAST; type_idx++) {
+        _check((summary.nb_payloads[type_idx] == expected_summary.nb_payloads[type_idx]) ? SIGFOX_TRUE : SIGFOX_FALSE, "summary payloads", "batch");
+        _check((summary_only.nb_payloads[type_idx] == expected_summary.nb_payloads[type_idx]) ? SIGFOX_TRUE : SIGFOX_FALSE, "summary payloads", "batch without decoded payloads");
+    }
+    _check(((summary.nb_mac_addresses == expected_summary.nb_mac_addresses) && (summary.nb_invalid == expected_summary.nb_invalid)) ? SIGFOX_TRUE : SIGFOX_FALSE, "summary counters", "batch");
+    _check(((summary_only.nb_mac_addresses == expected_summary.nb_mac_addresses) && (summary_only.nb_invalid == expected_summary.nb_invalid)) ? SIGFOX_TRUE : SIGFOX_FALSE, "summary counters", "batch without decoded payloads");
+}
+
+/*******************************************************************/
+static void _test_round_trip(void) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_context_t context;
+    SIGFOX_EP_ADDON_AW_API_input_data_t input_data;
+    SIGFOX_EP_ADDON_AW_API_access_point_t access_points[SIGFOX_EP_ADDON_AW_TEST_DECODER_LIST_SIZE_MAX];
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_point_list[SIGFOX_EP_ADDON_AW_TEST_DECODER_LIST_SIZE_MAX];
+    SIGFOX_EP_ADDON_AW_API_decoded_payload_t decoded_payload;
+    sfx_u8 ul_payload[SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES];
+    SIGFOX_EP_ADDON_AW_API_sorting_t sorting = SIGFOX_EP_ADDON_AW_API_SORTING_NONE;
+    sfx_u8 filters = 0;
+    sfx_u8 nb_mac_ul_payload = 0;
+    sfx_u8 nb_sent = 0;
+    sfx_u32 nb_payloads[SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD + 1];
+    sfx_u8 mac_address_bytes[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES];
+    sfx_u32 list_idx = 0;
+    sfx_u8 list_size = 0;
+    sfx_u8 ap_idx = 0;
+    sfx_u8 byte_idx = 0;
+    sfx_u8 mac_idx = 0;
+    sfx_bool is_sent = SIGFOX_FALSE;
+    memset(mac_address_bytes, 0, sizeof(mac_address_bytes));
+    memset(nb_payloads, 0, sizeof(nb_payloads));
+    for (list_idx = 0; list_idx < SIGFOX_EP_ADDON_AW_TEST_DECODER_NB_LISTS; list_idx++) {
+        // Random list with invalid and duplicated addresses, giving 0, 1 or 2 MAC addresses in the payload.
+        list_size = (sfx_u8) (1 + (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % SIGFOX_EP_ADDON_AW_TEST_DECODER_LIST_SIZE_MAX));
+        for (ap_idx = 0; ap_idx < list_size; ap_idx++) {
+            if ((ap_idx == 0) || ((SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 4) != 0)) {
+                mac_address_bytes[0] = SIGFOX_EP_ADDON_AW_TEST_DECODER_FIRST_BYTES[SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % sizeof(SIGFOX_EP_ADDON_AW_TEST_DECODER_FIRST_BYTES)];
+                for (byte_idx = 1; byte_idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES; byte_idx++) {
+                    mac_address_bytes[byte_idx] = (((mac_address_bytes[0] == 0x00) || (mac_address_bytes[0] == 0xFF)) && ((SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 2) == 0)) ? mac_address_bytes[0] : (sfx_u8) (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() & 0xFF);
+                }
+            }
+            SIGFOX_EP_ADDON_AW_TEST_COMMON_init_access_point(&(access_points[ap_idx]), mac_address_bytes, SIGFOX_FALSE, SIGFOX_NULL, (sfx_s16) (-100 + (sfx_s32) (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 70)));
+        }
+        SIGFOX_EP_ADDON_AW_TEST_COMMON_init_list(&input_data, access_points, access_point_list, list_size);
+        filters = (sfx_u8) (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % (1 << SIGFOX_EP_ADDON_AW_API_FILTER_LAST));
+        sorting = (((SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 2) == 0) ? SIGFOX_EP_ADDON_AW_API_SORTING_RSSI : SIGFOX_EP_ADDON_AW_API_SORTING_NONE);
+        SIGFOX_EP_ADDON_AW_TEST_COMMON_configure(&context, filters, sorting, -80, SIGFOX_NULL);
+        memset(ul_payload, 0xA5, sizeof(ul_payload));
+        nb_mac_ul_payload = 0xFF;
+        SIGFOX_EP_ADDON_AW_API_build_ul_payload_ctx(&context, &input_data, ul_payload, &nb_mac_ul_payload);
+        SIGFOX_EP_ADDON_AW_API_decode_ul_payload(ul_payload, SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES, &decoded_payload);
+        if (nb_mac_ul_payload > SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD) {
+            _check(SIGFOX_FALSE, "number of MAC addresses", "round trip");
+            continue;
+        }
+        nb_payloads[nb_mac_ul_payload]++;
+        if (nb_mac_ul_payload == 0) {
+            // Payload without access point: never processed by the geolocation service.
+            _check_decoded_payload(ul_payload, &decoded_payload, SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_ATLAS_WIFI, 1, SIGFOX_EP_ADDON_AW_API_DECODER_ERROR_RESERVED_MAC_ADDRESS, "round trip without access point");
+            continue;
+        }
+        _check_decoded_payload(ul_payload, &decoded_payload, SIGFOX_EP_ADDON_AW_API_PAYLOAD_TYPE_ATLAS_WIFI, nb_mac_ul_payload, 0, "round trip");
+        // Each decoded MAC address is one of the sent access points.
+        nb_sent = 0;
+        for (ap_idx = 0; ap_idx < list_size; ap_idx++) {
+            nb_sent += (access_points[ap_idx].status == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_SENT) ? 1 : 0;
+        }
+        _check((nb_sent == (decoded_payload.nb_mac)) ? SIGFOX_TRUE : SIGFOX_FALSE, "number of sent access points", "round trip");
+        for (mac_idx = 0; (mac_idx < (decoded_payload.nb_mac)) && (mac_idx < SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD); mac_idx++) {
+            is_sent = SIGFOX_FALSE;
+            for (ap_idx = 0; ap_idx < list_size; ap_idx++) {
+                if ((access_points[ap_idx].status == SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_SENT) && (memcmp(access_points[ap_idx].mac_address_bytes, decoded_payload.mac_address_bytes[mac_idx], SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES) == 0)) {
+                    is_sent = SIGFOX_TRUE;
+                }
+            }
+            _check(is_sent, "decoded MAC address sent", "round trip");
+        }
+    }
+    // The random lists must give all the payload sizes.
+    for (mac_idx = 0; mac_idx <= SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD; mac_idx++) {
+        _check((nb_payloads[mac_idx] != 0) ? SIGFOX_TRUE : SIGFOX_FALSE, "payload size coverage", "round trip");
+    }
+    printf("round trip payloads: %lu without access point, %lu with 1 MAC address, %lu with 2 MAC addresses\n",
+        (unsigned long) nb_payloads[0], (unsigned long) nb_payloads[1], (unsigned long) nb_payloads[2]);
+}
+
+/*** SIGFOX EP ADDON AW TEST DECODER functions ***/
+
+/*******************************************************************/
+int main(void) {
+    printf("sigfox-ep-addon-aw %s uplink payloads decoder test\n", SIGFOX_EP_ADDON_AW_VERSION);
+    SIGFOX_EP_ADDON_AW_TEST_COMMON_set_seed(SIGFOX_EP_ADDON_AW_TEST_DECODER_SEED);
+    _test_payloads();
+    _test_batch();
+    _test_round_trip();
+    printf("%lu checks, %lu error(s)\n", (unsigned long) sigfox_ep_addon_aw_test_decoder_nb_cases, (unsigned long) sigfox_ep_addon_aw_test_decoder_nb_errors);
+    if (sigfox_ep_addon_aw_test_decoder_nb_errors != 0) {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("PASSED\n");
+    return 0;
+}
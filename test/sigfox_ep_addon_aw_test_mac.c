@@ -0,0 +1,247 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_aw_test_mac.c
+ * \brief   Sigfox End-Point Atlas WiFi addon MAC address decoder test.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2025, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sigfox_ep_addon_aw_api.h"
+#include "sigfox_ep_addon_aw_version.h"
+
+/*** SIGFOX EP ADDON AW TEST MAC local macros ***/
+
+#define SIGFOX_EP_ADDON_AW_TEST_MAC_SEPARATOR_CHAR  ':'
+#define SIGFOX_EP_ADDON_AW_TEST_MAC_NB_ERRORS_MAX   10
+
+/*** SIGFOX EP ADDON AW TEST MAC local structures ***/
+
+/*******************************************************************/
+typedef enum {
+    SIGFOX_EP_ADDON_AW_TEST_MAC_RESULT_SUCCESS = 0,
+    SIGFOX_EP_ADDON_AW_TEST_MAC_RESULT_SEPARATOR,
+    SIGFOX_EP_ADDON_AW_TEST_MAC_RESULT_FORMAT
+} SIGFOX_EP_ADDON_AW_TEST_MAC_result_t;
+
+/*** SIGFOX EP ADDON AW TEST MAC local global variables ***/
+
+static const char *SIGFOX_EP_ADDON_AW_TEST_MAC_BASES[] = {
+    "00:1a:2B:3c:4D:5e",
+    "F4:e9:D4:a7:6C:b0",
+    "98:76:54:32:10:fe",
+};
+
+#ifdef SIGFOX_EP_ERROR_CODES
+static const SIGFOX_EP_ADDON_AW_API_status_t SIGFOX_EP_ADDON_AW_TEST_MAC_STATUS[] = {
+    SIGFOX_EP_ADDON_AW_API_SUCCESS,
+    SIGFOX_EP_ADDON_AW_API_ERROR_MAC_ADDRESS_SEPARATOR,
+    SIGFOX_EP_ADDON_AW_API_ERROR_MAC_ADDRESS_FORMAT,
+};
+#endif
+
+static unsigned long sigfox_ep_addon_aw_test_mac_nb_cases = 0;
+static unsigned long sigfox_ep_addon_aw_test_mac_nb_errors = 0;
+
+/*** SIGFOX EP ADDON AW TEST MAC local functions ***/
+
+/*******************************************************************/
+static SIGFOX_EP_ADDON_AW_TEST_MAC_result_t _reference_decode(const sfx_u8 *mac_address, sfx_u8 *mac_address_bytes) {
+    // Local variables.
+    sfx_u8 digit_value = 0;
+    sfx_u8 char_idx = 0;
+    sfx_u8 digit_idx = 0;
+    sfx_u8 c = 0;
+    // Straightforward decoder: separators are only checked with the parameters check, and any error gives a zeroed (reserved) address.
+    memset(mac_address_bytes, 0, SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES);
+#ifdef SIGFOX_EP_PARAMETERS_CHECK
+    for (char_idx = 2; char_idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR; char_idx += 3) {
+        if (mac_address[char_idx] != SIGFOX_EP_ADDON_AW_TEST_MAC_SEPARATOR_CHAR) {
+            return SIGFOX_EP_ADDON_AW_TEST_MAC_RESULT_SEPARATOR;
+        }
+    }
+#endif
+    for (digit_idx = 0; digit_idx < (2 * SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES); digit_idx++) {
+        char_idx = (sfx_u8) ((3 * (digit_idx / 2)) + (digit_idx % 2));
+        c = mac_address[char_idx];
+        if ((c >= '0') && (c <= '9')) {
+            digit_value = (sfx_u8) (c - '0');
+        }
+        else if ((c >= 'a') && (c <= 'f')) {
+            digit_value = (sfx_u8) (c - 'a' + 10);
+        }
+        else if ((c >= 'A') && (c <= 'F')) {
+            digit_value = (sfx_u8) (c - 'A' + 10);
+        }
+        else {
+            memset(mac_address_bytes, 0, SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES);
+            return SIGFOX_EP_ADDON_AW_TEST_MAC_RESULT_FORMAT;
+        }
+        mac_address_bytes[digit_idx / 2] |= (sfx_u8) (digit_value << (((digit_idx % 2) == 0) ? 4 : 0));
+    }
+    return SIGFOX_EP_ADDON_AW_TEST_MAC_RESULT_SUCCESS;
+}
+
+/*******************************************************************/
+static void _print_error(const char *check, const sfx_u8 *mac_address) {
+    // Local variables.
+    sfx_u8 char_idx = 0;
+    sigfox_ep_addon_aw_test_mac_nb_errors++;
+    if (sigfox_ep_addon_aw_test_mac_nb_errors > SIGFOX_EP_ADDON_AW_TEST_MAC_NB_ERRORS_MAX) return;
+    printf("ERROR: %s mismatch on", check);
+    for (char_idx = 0; char_idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR; char_idx++) {
+        printf(" %02X", mac_address[char_idx]);
+    }
+    printf("\n");
+}
+
+/*******************************************************************/
+static void _check_decoder(sfx_u8 *mac_address) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_packed_access_point_t packed_access_point;
+    sfx_u8 mac_address_bytes[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES];
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_TEST_MAC_result_t result = SIGFOX_EP_ADDON_AW_TEST_MAC_RESULT_SUCCESS;
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    sigfox_ep_addon_aw_test_mac_nb_cases++;
+#ifdef SIGFOX_EP_ERROR_CODES
+    result = _reference_decode(mac_address, mac_address_bytes);
+#else
+    _reference_decode(mac_address, mac_address_bytes);
+#endif
+    // The packing function gives the decoded address and the decoder status.
+    memset(&packed_access_point, 0xA5, sizeof(packed_access_point));
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = SIGFOX_EP_ADDON_AW_API_pack_access_point(mac_address, SIGFOX_NULL, 0, &packed_access_point);
+    if (status != SIGFOX_EP_ADDON_AW_TEST_MAC_STATUS[result]) {
+        _print_error("status", mac_address);
+        return;
+    }
+#else
+    SIGFOX_EP_ADDON_AW_API_pack_access_point(mac_address, SIGFOX_NULL, 0, &packed_access_point);
+#endif
+    if (memcmp(packed_access_point.mac_address_bytes, mac_address_bytes, SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES) != 0) {
+        _print_error("bytes", mac_address);
+    }
+}
+
+/*******************************************************************/
+static void _check_payload(sfx_u8 *mac_address) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_access_point_t access_point;
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_point_list[1];
+    SIGFOX_EP_ADDON_AW_API_input_data_t input_data;
+    sfx_u8 mac_address_bytes[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES];
+    sfx_u8 ul_payload[SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES];
+    sfx_u8 nb_mac_ul_payload = 0;
+    sfx_u8 nb_mac_expected = 0;
+    SIGFOX_EP_ADDON_AW_TEST_MAC_result_t result = SIGFOX_EP_ADDON_AW_TEST_MAC_RESULT_SUCCESS;
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+#endif
+    sfx_u8 idx = 0;
+    // An invalid address must never be sent, whatever the flags.
+    result = _reference_decode(mac_address, mac_address_bytes);
+    if ((result == SIGFOX_EP_ADDON_AW_TEST_MAC_RESULT_SUCCESS) && ((mac_address_bytes[0] & 0x01) == 0)) {
+        for (idx = 0; idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES; idx++) {
+            if ((mac_address_bytes[idx] != 0x00) && (mac_address_bytes[idx] != 0xFF)) {
+                nb_mac_expected = 1;
+            }
+        }
+    }
+    memset(&access_point, 0, sizeof(access_point));
+    memcpy(access_point.mac_address, mac_address, SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR);
+    access_point.rssi_dbm = -50;
+    access_point.status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_NEW;
+    access_point_list[0] = &access_point;
+    input_data.access_point_list = access_point_list;
+    input_data.access_point_list_size = 1;
+#ifdef SIGFOX_EP_ERROR_CODES
+    status = SIGFOX_EP_ADDON_AW_API_build_ul_payload(&input_data, ul_payload, &nb_mac_ul_payload);
+    if ((result != SIGFOX_EP_ADDON_AW_TEST_MAC_RESULT_SUCCESS) && (status != SIGFOX_EP_ADDON_AW_TEST_MAC_STATUS[result])) {
+        _print_error("payload status", mac_address);
+        return;
+    }
+    if (status != SIGFOX_EP_ADDON_AW_API_SUCCESS) {
+        nb_mac_ul_payload = 0;
+    }
+#else
+    SIGFOX_EP_ADDON_AW_API_build_ul_payload(&input_data, ul_payload, &nb_mac_ul_payload);
+#endif
+    if ((nb_mac_ul_payload != nb_mac_expected) || ((nb_mac_expected != 0) && (memcmp(ul_payload, mac_address_bytes, SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES) != 0))) {
+        _print_error("payload", mac_address);
+    }
+}
+
+/*** SIGFOX EP ADDON AW TEST MAC functions ***/
+
+/*******************************************************************/
+int main(void) {
+    // Local variables.
+    sfx_u8 mac_address[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR];
+    sfx_u32 base_idx = 0;
+    sfx_u32 value = 0;
+    sfx_u8 char_idx = 0;
+    printf("sigfox-ep-addon-aw %s MAC address decoder test\n", SIGFOX_EP_ADDON_AW_VERSION);
+    for (base_idx = 0; base_idx < (sizeof(SIGFOX_EP_ADDON_AW_TEST_MAC_BASES) / sizeof(char*)); base_idx++) {
+        memcpy(mac_address, SIGFOX_EP_ADDON_AW_TEST_MAC_BASES[base_idx], SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR);
+        _check_decoder(mac_address);
+        // Every value of every single character, also checked through the payload builder.
+        for (char_idx = 0; char_idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR; char_idx++) {
+            for (value = 0; value <= 0xFF; value++) {
+                mac_address[char_idx] = (sfx_u8) value;
+                _check_decoder(mac_address);
+                _check_payload(mac_address);
+            }
+            mac_address[char_idx] = (sfx_u8) SIGFOX_EP_ADDON_AW_TEST_MAC_BASES[base_idx][char_idx];
+        }
+        // Every value of every pair of adjacent characters (digit pairs, and digits next to separators).
+        for (char_idx = 0; char_idx < (SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR - 1); char_idx++) {
+            for (value = 0; value <= 0xFFFF; value++) {
+                mac_address[char_idx] = (sfx_u8) (value >> 8);
+                mac_address[char_idx + 1] = (sfx_u8) (value & 0xFF);
+                _check_decoder(mac_address);
+            }
+            mac_address[char_idx] = (sfx_u8) SIGFOX_EP_ADDON_AW_TEST_MAC_BASES[base_idx][char_idx];
+            mac_address[char_idx + 1] = (sfx_u8) SIGFOX_EP_ADDON_AW_TEST_MAC_BASES[base_idx][char_idx + 1];
+        }
+    }
+    printf("%lu cases, %lu error(s)\n", sigfox_ep_addon_aw_test_mac_nb_cases, sigfox_ep_addon_aw_test_mac_nb_errors);
+    if (sigfox_ep_addon_aw_test_mac_nb_errors != 0) {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("PASSED\n");
+    return 0;
+}
@@ -0,0 +1,446 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_aw_test_stream.c
+ * \brief   Sigfox End-Point Atlas WiFi addon stream functions test.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2025, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sigfox_ep_addon_aw_api.h"
+#include "sigfox_ep_addon_aw_test_common.h"
+#include "sigfox_ep_addon_aw_version.h"
+
+/*** SIGFOX EP ADDON AW TEST STREAM local macros ***/
+
+#define SIGFOX_EP_ADDON_AW_TEST_STREAM_NB_SCANS             200
+#define SIGFOX_EP_ADDON_AW_TEST_STREAM_NB_RECORDS_MAX       64
+#define SIGFOX_EP_ADDON_AW_TEST_STREAM_NB_SPLITS            8
+#define SIGFOX_EP_ADDON_AW_TEST_STREAM_OUTPUT_SIZE_MAX      16384
+#define SIGFOX_EP_ADDON_AW_TEST_STREAM_SSID_LENGTH_MAX      40
+#define SIGFOX_EP_ADDON_AW_TEST_STREAM_SEED                 0x6B43A9E1
+#define SIGFOX_EP_ADDON_AW_TEST_STREAM_NB_ERRORS_MAX        10
+
+/*** SIGFOX EP ADDON AW TEST STREAM local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    const char *line; // Line reported by the WiFi module.
+    const char *mac_address; // Expected record (SIGFOX_NULL if the line must be ignored).
+    const char *ssid;
+    sfx_s16 rssi_dbm;
+} SIGFOX_EP_ADDON_AW_TEST_STREAM_line_t;
+
+/*******************************************************************/
+typedef struct {
+    sfx_u8 filters;
+    SIGFOX_EP_ADDON_AW_API_sorting_t sorting;
+    sfx_s16 rssi_min_dbm;
+} SIGFOX_EP_ADDON_AW_TEST_STREAM_configuration_t;
+
+/*******************************************************************/
+typedef struct {
+    char output[SIGFOX_EP_ADDON_AW_TEST_STREAM_OUTPUT_SIZE_MAX];
+    sfx_u32 output_size;
+    SIGFOX_EP_ADDON_AW_API_access_point_t access_points[SIGFOX_EP_ADDON_AW_TEST_STREAM_NB_RECORDS_MAX];
+    SIGFOX_EP_ADDON_AW_API_index_t nb_access_points;
+} SIGFOX_EP_ADDON_AW_TEST_STREAM_scan_t;
+
+/*** SIGFOX EP ADDON AW TEST STREAM local global variables ***/
+
+// Output captured from an ESP-AT module, completed with the corner cases of the parser.
+static const SIGFOX_EP_ADDON_AW_TEST_STREAM_line_t SIGFOX_EP_ADDON_AW_TEST_STREAM_CAPTURE[] = {
+    { "AT+CWLAP\r\n", SIGFOX_NULL, SIGFOX_NULL, 0 },
+    { "+CWLAP:(3,\"Livebox-4F2A\",-67,\"f4:ca:e5:12:34:56\",6,-22,0,4,3,7,1)\r\n", "f4:ca:e5:12:34:56", "Livebox-4F2A", -67 },
+    { "+CWLAP:(0,\"FreeWifi\",-71,\"f6:ca:e5:12:34:57\",6,-22,0,0,0,7,0)\r\n", "f6:ca:e5:12:34:57", "FreeWifi", -71 },
+    // Separators and escaped characters in quoted SSIDs.
+    { "+CWLAP:(3,\"Bar\\, Guest) \\\"5G\\\"\",-58,\"3c:7c:3f:aa:bb:01\",11,12,0,4,4,7,1)\r\n", "3c:7c:3f:aa:bb:01", "Bar, Guest) \"5G\"", -58 },
+    { "+CWLAP:(4,\"Home,Net)(\",-62,\"3C:7C:3F:AA:BB:02\",1,0,0,4,4,7,1)\r\n", "3C:7C:3F:AA:BB:02", "Home,Net)(", -62 },
+    { "+CWLAP:(3,\"C:\\\\Users\\\\\",-75,\"a0:b1:c2:d3:e4:f5\",1,0,0,4,4,7,1)\r\n", "a0:b1:c2:d3:e4:f5", "C:\\Users\\", -75 },
+    { "+CWLAP:(3,\"Marie's iPhone\",-45,\"ac:84:c6:11:22:33\",1,0,0,4,4,7,1)\r\n", "ac:84:c6:11:22:33", "Marie's iPhone", -45 },
+    { "+CWLAP:(0,\"\",-60,\"ac:84:c6:11:22:34\",1,0,0,0,0,7,0)\r\n", "ac:84:c6:11:22:34", "", -60 },
+    // Truncated lines (the module was reset or the UART buffer overflowed).
+    { "+CWLAP:(3,\"Office\",-40,\"ac:84:c6:11:22\r\n", SIGFOX_NULL, SIGFOX_NULL, 0 },
+    { "+CWLAP:(3,\"Office\",-40,\"ac:84:c6:11:22:35\",1\r\n", SIGFOX_NULL, SIGFOX_NULL, 0 },
+    { "+CWLAP:(3,\"Off", SIGFOX_NULL, SIGFOX_NULL, 0 },
+    { "\r\n", SIGFOX_NULL, SIGFOX_NULL, 0 },
+    // Line feed only.
+    { "+CWLAP:(3,\"Office\",-52,\"ac:84:c6:11:22:36\",1,0,0,4,4,7,1)\n", "ac:84:c6:11:22:36", "Office", -52 },
+    // Out of range and malformed RSSI.
+    { "+CWLAP:(3,\"Far\",-1000,\"ac:84:c6:11:22:37\",1,0,0,4,4,7,1)\r\n", "ac:84:c6:11:22:37", "Far", -1000 },
+    { "+CWLAP:(3,\"Near\",9999,\"ac:84:c6:11:22:38\",1,0,0,4,4,7,1)\r\n", "ac:84:c6:11:22:38", "Near", 9999 },
+    { "+CWLAP:(3,\"Zero\",0,\"ac:84:c6:11:22:39\",1,0,0,4,4,7,1)\r\n", "ac:84:c6:11:22:39", "Zero", 0 },
+    { "+CWLAP:(3,\"Office\",-,\"ac:84:c6:11:22:3a\",1,0,0,4,4,7,1)\r\n", SIGFOX_NULL, SIGFOX_NULL, 0 },
+    { "+CWLAP:(3,\"Office\",,\"ac:84:c6:11:22:3b\",1,0,0,4,4,7,1)\r\n", SIGFOX_NULL, SIGFOX_NULL, 0 },
+    { "+CWLAP:(3,\"Office\",-6x,\"ac:84:c6:11:22:3c\",1,0,0,4,4,7,1)\r\n", SIGFOX_NULL, SIGFOX_NULL, 0 },
+    // Duplicated BSSIDs.
+    { "+CWLAP:(3,\"Livebox-4F2A\",-50,\"F4:CA:E5:12:34:56\",6,-22,0,4,3,7,1)\r\n", "F4:CA:E5:12:34:56", "Livebox-4F2A", -50 },
+    { "+CWLAP:(3,\"Bar\\, Guest) \\\"5G\\\"\",-90,\"3c:7c:3f:aa:bb:01\",11,12,0,4,4,7,1)\r\n", "3c:7c:3f:aa:bb:01", "Bar, Guest) \"5G\"", -90 },
+    // Reserved, multicast and locally administered addresses.
+    { "+CWLAP:(3,\"Office\",-41,\"00:00:00:00:00:00\",1,0,0,4,4,7,1)\r\n", "00:00:00:00:00:00", "Office", -41 },
+    { "+CWLAP:(3,\"Office\",-42,\"01:00:5e:00:00:fb\",1,0,0,4,4,7,1)\r\n", "01:00:5e:00:00:fb", "Office", -42 },
+    { "+CWLAP:(3,\"Repeater\",-43,\"02:84:c6:11:22:3d\",1,0,0,4,4,7,1)\r\n", "02:84:c6:11:22:3d", "Repeater", -43 },
+    // Malformed MAC addresses and other lines.
+    { "+CWLAP:(3,\"Office\",-44,\"ac:84:c6:11:22:3\",1,0,0,4,4,7,1)\r\n", SIGFOX_NULL, SIGFOX_NULL, 0 },
+    { "+CWLAP:(3,\"Office\",-44,\"ac:84:c6:11:22:3e:\",1,0,0,4,4,7,1)\r\n", SIGFOX_NULL, SIGFOX_NULL, 0 },
+    { "+CWLAP:(3,\"Office\",-44)\r\n", SIGFOX_NULL, SIGFOX_NULL, 0 },
+    { "+CWLAPOPT:(3,\"Office\",-44,\"ac:84:c6:11:22:3f\")\r\n", SIGFOX_NULL, SIGFOX_NULL, 0 },
+    { "\r\nOK\r\n", SIGFOX_NULL, SIGFOX_NULL, 0 },
+};
+
+static const SIGFOX_EP_ADDON_AW_TEST_STREAM_configuration_t SIGFOX_EP_ADDON_AW_TEST_STREAM_CONFIGURATIONS[] = {
+    { 0x00, SIGFOX_EP_ADDON_AW_API_SORTING_RSSI, -90 },
+    { 0x1F, SIGFOX_EP_ADDON_AW_API_SORTING_RSSI, -90 },
+    { 0x1F, SIGFOX_EP_ADDON_AW_API_SORTING_RSSI, -60 },
+    { 0x01, SIGFOX_EP_ADDON_AW_API_SORTING_RSSI, -90 },
+    { 0x06, SIGFOX_EP_ADDON_AW_API_SORTING_RSSI, -75 },
+    { 0x18, SIGFOX_EP_ADDON_AW_API_SORTING_RSSI, -70 },
+};
+
+// Characters of the random SSIDs, including the separators and the escaped characters.
+static const char SIGFOX_EP_ADDON_AW_TEST_STREAM_SSID_CHARACTERS[] = "abcXYZ019 _-,)(\"\\'";
+
+static const char *SIGFOX_EP_ADDON_AW_TEST_STREAM_SSID_WORDS[] = {
+    "", "Livebox", "eduroam", "iPhone", "AndroidAP", "Guest, 5G", "(\"x\")",
+};
+
+static const sfx_u8 SIGFOX_EP_ADDON_AW_TEST_STREAM_OUI_TABLE[] = {
+    0xAC, 0x84, 0xC6,
+};
+
+static const SIGFOX_EP_ADDON_AW_API_oui_table_t SIGFOX_EP_ADDON_AW_TEST_STREAM_OUI_BLACK_LIST = {
+    .oui_table = SIGFOX_EP_ADDON_AW_TEST_STREAM_OUI_TABLE,
+    .nb_ouis = 1,
+};
+
+static SIGFOX_EP_ADDON_AW_TEST_STREAM_scan_t sigfox_ep_addon_aw_test_stream_scan;
+static sfx_u32 sigfox_ep_addon_aw_test_stream_nb_cases = 0;
+static sfx_u32 sigfox_ep_addon_aw_test_stream_nb_errors = 0;
+
+/*** SIGFOX EP ADDON AW TEST STREAM local functions ***/
+
+/*******************************************************************/
+static void _append(SIGFOX_EP_ADDON_AW_TEST_STREAM_scan_t *scan, const char *text) {
+    // Local variables.
+    sfx_u32 text_size = (sfx_u32) strlen(text);
+    if (((scan->output_size) + text_size) > SIGFOX_EP_ADDON_AW_TEST_STREAM_OUTPUT_SIZE_MAX) return;
+    memcpy(&(scan->output[scan->output_size]), text, text_size);
+    scan->output_size += text_size;
+}
+
+/*******************************************************************/
+static void _add_record(SIGFOX_EP_ADDON_AW_TEST_STREAM_scan_t *scan, const char *mac_address, const char *ssid, sfx_s16 rssi_dbm) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_point = &(scan->access_points[scan->nb_access_points]);
+    sfx_u32 ssid_length = (sfx_u32) strlen(ssid);
+    if ((scan->nb_access_points) >= SIGFOX_EP_ADDON_AW_TEST_STREAM_NB_RECORDS_MAX) return;
+    // Same access point as the one built by the parser (longer SSIDs are truncated).
+    memset(access_point, 0, sizeof(SIGFOX_EP_ADDON_AW_API_access_point_t));
+    memcpy(access_point->mac_address, mac_address, SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR);
+    memcpy(access_point->ssid, ssid, ((ssid_length < SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR) ? ssid_length : SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR));
+    access_point->rssi_dbm = rssi_dbm;
+    access_point->status = SIGFOX_EP_ADDON_AW_API_ACCESS_POINT_STATUS_NEW;
+    scan->nb_access_points++;
+}
+
+/*******************************************************************/
+static void _generate_capture(SIGFOX_EP_ADDON_AW_TEST_STREAM_scan_t *scan) {
+    // Local variables.
+    const SIGFOX_EP_ADDON_AW_TEST_STREAM_line_t *line = SIGFOX_NULL;
+    sfx_u32 idx = 0;
+    scan->output_size = 0;
+    scan->nb_access_points = 0;
+    for (idx = 0; idx < (sizeof(SIGFOX_EP_ADDON_AW_TEST_STREAM_CAPTURE) / sizeof(SIGFOX_EP_ADDON_AW_TEST_STREAM_line_t)); idx++) {
+        line = &(SIGFOX_EP_ADDON_AW_TEST_STREAM_CAPTURE[idx]);
+        _append(scan, (line->line));
+        if ((line->mac_address) != SIGFOX_NULL) {
+            _add_record(scan, (line->mac_address), (line->ssid), (line->rssi_dbm));
+        }
+    }
+}
+
+/*******************************************************************/
+static void _generate_ssid(char *ssid, char *quoted_ssid) {
+    // Local variables.
+    sfx_u32 length = 0;
+    sfx_u32 idx = 0;
+    sfx_u32 quoted_idx = 0;
+    char c = 0;
+    if ((SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 2) == 0) {
+        strcpy(ssid, SIGFOX_EP_ADDON_AW_TEST_STREAM_SSID_WORDS[SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % (sizeof(SIGFOX_EP_ADDON_AW_TEST_STREAM_SSID_WORDS) / sizeof(char*))]);
+    }
+    else {
+        length = (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % (SIGFOX_EP_ADDON_AW_TEST_STREAM_SSID_LENGTH_MAX + 1));
+        for (idx = 0; idx < length; idx++) {
+            ssid[idx] = SIGFOX_EP_ADDON_AW_TEST_STREAM_SSID_CHARACTERS[SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % (sizeof(SIGFOX_EP_ADDON_AW_TEST_STREAM_SSID_CHARACTERS) - 1)];
+        }
+        ssid[length] = '\0';
+    }
+    // Quotes and backslashes are escaped by the module, commas may also be escaped.
+    quoted_ssid[quoted_idx++] = '"';
+    for (idx = 0; ssid[idx] != '\0'; idx++) {
+        c = ssid[idx];
+        if ((c == '"') || (c == '\\') || ((c == ',') && ((SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 2) == 0))) {
+            quoted_ssid[quoted_idx++] = '\\';
+        }
+        quoted_ssid[quoted_idx++] = c;
+    }
+    quoted_ssid[quoted_idx++] = '"';
+    quoted_ssid[quoted_idx] = '\0';
+}
+
+/*******************************************************************/
+static void _generate_scan(SIGFOX_EP_ADDON_AW_TEST_STREAM_scan_t *scan) {
+    // Local variables.
+    char line[256];
+    char ssid[SIGFOX_EP_ADDON_AW_TEST_STREAM_SSID_LENGTH_MAX + 1];
+    char quoted_ssid[(2 * SIGFOX_EP_ADDON_AW_TEST_STREAM_SSID_LENGTH_MAX) + 3];
+    char mac_address[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR + 1];
+    char rssi[16];
+    sfx_u8 mac_address_bytes[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES];
+    sfx_s16 rssi_dbm = 0;
+    sfx_bool is_valid = SIGFOX_TRUE;
+    sfx_u32 nb_lines = (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % SIGFOX_EP_ADDON_AW_TEST_STREAM_NB_RECORDS_MAX);
+    sfx_u32 line_size = 0;
+    sfx_u32 idx = 0;
+    sfx_u8 byte_idx = 0;
+    scan->output_size = 0;
+    scan->nb_access_points = 0;
+    memset(mac_address_bytes, 0, sizeof(mac_address_bytes));
+    _append(scan, "AT+CWLAP\r\n");
+    for (idx = 0; idx < nb_lines; idx++) {
+        is_valid = SIGFOX_TRUE;
+        // Duplicated BSSIDs (with another case), multicast and locally administered addresses.
+        if ((idx == 0) || ((SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 6) != 0)) {
+            for (byte_idx = 0; byte_idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES; byte_idx++) {
+                mac_address_bytes[byte_idx] = (sfx_u8) (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() & 0xFF);
+            }
+            mac_address_bytes[0] &= (((SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 4) == 0) ? 0xFF : 0xFC);
+            if ((SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 4) == 0) {
+                memcpy(mac_address_bytes, SIGFOX_EP_ADDON_AW_TEST_STREAM_OUI_TABLE, sizeof(SIGFOX_EP_ADDON_AW_TEST_STREAM_OUI_TABLE));
+            }
+        }
+        SIGFOX_EP_ADDON_AW_TEST_COMMON_write_mac_address(mac_address_bytes, (((SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 2) == 0) ? SIGFOX_FALSE : SIGFOX_TRUE), (sfx_u8*) mac_address);
+        mac_address[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR] = '\0';
+        _generate_ssid(ssid, quoted_ssid);
+        // Nominal, out of range and malformed RSSI.
+        switch (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 16) {
+        case 0:
+            rssi_dbm = (sfx_s16) (-1000 - (sfx_s32) (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 9000));
+            break;
+        case 1:
+            rssi_dbm = (sfx_s16) (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 10000);
+            break;
+        case 2:
+            rssi_dbm = 0;
+            is_valid = SIGFOX_FALSE;
+            break;
+        default:
+            rssi_dbm = (sfx_s16) (-100 + (sfx_s32) (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 75));
+            break;
+        }
+        if (is_valid == SIGFOX_TRUE) {
+            sprintf(rssi, "%d", rssi_dbm);
+        }
+        else {
+            strcpy(rssi, (((SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 2) == 0) ? "-" : "-5a"));
+        }
+        sprintf(line, "+CWLAP:(%u,%s,%s,\"%s\",%u,-22,0,4,3,7,1)", (unsigned int) (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 5), quoted_ssid, rssi, mac_address, (unsigned int) (1 + (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 13)));
+        // Truncated line (before the closing parenthesis).
+        if ((SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 10) == 0) {
+            line_size = (sfx_u32) strlen(line);
+            line[SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % line_size] = '\0';
+            is_valid = SIGFOX_FALSE;
+        }
+        _append(scan, line);
+        _append(scan, (((SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 4) == 0) ? "\n" : "\r\n"));
+        if (is_valid == SIGFOX_TRUE) {
+            _add_record(scan, mac_address, ssid, rssi_dbm);
+        }
+        // Other lines.
+        if ((SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 16) == 0) {
+            _append(scan, "busy p...\r\n");
+        }
+    }
+    _append(scan, "\r\nOK\r\n");
+}
+
+/*******************************************************************/
+static void _configure(SIGFOX_EP_ADDON_AW_API_context_t *context, const SIGFOX_EP_ADDON_AW_TEST_STREAM_configuration_t *configuration) {
+    SIGFOX_EP_ADDON_AW_TEST_COMMON_configure(context, (configuration->filters), (configuration->sorting), (configuration->rssi_min_dbm), &SIGFOX_EP_ADDON_AW_TEST_STREAM_OUI_BLACK_LIST);
+}
+
+/*******************************************************************/
+static void _build_list_payload(const SIGFOX_EP_ADDON_AW_TEST_STREAM_configuration_t *configuration, SIGFOX_EP_ADDON_AW_API_output_data_t *output_data) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_context_t context;
+    SIGFOX_EP_ADDON_AW_API_input_data_t input_data;
+    SIGFOX_EP_ADDON_AW_API_access_point_t access_points[SIGFOX_EP_ADDON_AW_TEST_STREAM_NB_RECORDS_MAX];
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_point_list[SIGFOX_EP_ADDON_AW_TEST_STREAM_NB_RECORDS_MAX];
+    // Copy of the expected records, as the list statuses are updated by the payload builder.
+    memcpy(access_points, (sigfox_ep_addon_aw_test_stream_scan.access_points), sizeof(access_points));
+    SIGFOX_EP_ADDON_AW_TEST_COMMON_init_list(&input_data, access_points, access_point_list, (sigfox_ep_addon_aw_test_stream_scan.nb_access_points));
+    _configure(&context, configuration);
+    memset(output_data, 0, sizeof(SIGFOX_EP_ADDON_AW_API_output_data_t));
+    // An empty list is rejected by the parameters check, while an empty scan has no valid access point.
+    if ((input_data.access_point_list_size) == 0) {
+#ifdef SIGFOX_EP_ERROR_CODES
+        output_data->status = SIGFOX_EP_ADDON_AW_API_ERROR_NONE_VALID_ACCESS_POINT;
+#endif
+        return;
+    }
+#ifdef SIGFOX_EP_ERROR_CODES
+    output_data->status = SIGFOX_EP_ADDON_AW_API_build_ul_payload_ctx(&context, &input_data, (output_data->ul_payload), &(output_data->nb_mac_ul_payload));
+#else
+    SIGFOX_EP_ADDON_AW_API_build_ul_payload_ctx(&context, &input_data, (output_data->ul_payload), &(output_data->nb_mac_ul_payload));
+#endif
+}
+
+/*******************************************************************/
+static void _build_stream_payload(const SIGFOX_EP_ADDON_AW_TEST_STREAM_configuration_t *configuration, sfx_u32 max_chunk_size, SIGFOX_EP_ADDON_AW_API_output_data_t *output_data) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_context_t context;
+    SIGFOX_EP_ADDON_AW_API_stream_t stream;
+    sfx_u32 offset = 0;
+    sfx_u32 chunk_size = 0;
+    _configure(&context, configuration);
+    SIGFOX_EP_ADDON_AW_API_stream_init_ctx(&context, &stream);
+    // Random chunks (including empty ones), so that the records are cut anywhere.
+    while (offset < (sigfox_ep_addon_aw_test_stream_scan.output_size)) {
+        chunk_size = (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % (max_chunk_size + 1));
+        if (chunk_size > ((sigfox_ep_addon_aw_test_stream_scan.output_size) - offset)) {
+            chunk_size = ((sigfox_ep_addon_aw_test_stream_scan.output_size) - offset);
+        }
+        SIGFOX_EP_ADDON_AW_API_stream_parse_cwlap(&stream, (const sfx_u8*) &(sigfox_ep_addon_aw_test_stream_scan.output[offset]), chunk_size);
+        offset += chunk_size;
+    }
+    memset(output_data, 0, sizeof(SIGFOX_EP_ADDON_AW_API_output_data_t));
+#ifdef SIGFOX_EP_ERROR_CODES
+    output_data->status = SIGFOX_EP_ADDON_AW_API_stream_build_ul_payload(&stream, (output_data->ul_payload), &(output_data->nb_mac_ul_payload));
+#else
+    SIGFOX_EP_ADDON_AW_API_stream_build_ul_payload(&stream, (output_data->ul_payload), &(output_data->nb_mac_ul_payload));
+#endif
+}
+
+/*******************************************************************/
+static void _build_push_payload(const SIGFOX_EP_ADDON_AW_TEST_STREAM_configuration_t *configuration, SIGFOX_EP_ADDON_AW_API_output_data_t *output_data) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_context_t context;
+    SIGFOX_EP_ADDON_AW_API_stream_t stream;
+    SIGFOX_EP_ADDON_AW_API_access_point_t access_point;
+    SIGFOX_EP_ADDON_AW_API_index_t idx = 0;
+    _configure(&context, configuration);
+    SIGFOX_EP_ADDON_AW_API_stream_init_ctx(&context, &stream);
+    memset(output_data, 0, sizeof(SIGFOX_EP_ADDON_AW_API_output_data_t));
+    // Copy of each expected record, pushed in the scan order.
+    for (idx = 0; idx < (sigfox_ep_addon_aw_test_stream_scan.nb_access_points); idx++) {
+        access_point = sigfox_ep_addon_aw_test_stream_scan.access_points[idx];
+#ifdef SIGFOX_EP_ERROR_CODES
+        output_data->status = SIGFOX_EP_ADDON_AW_API_stream_push(&stream, &access_point);
+        if ((output_data->status) != SIGFOX_EP_ADDON_AW_API_SUCCESS) return;
+#else
+        SIGFOX_EP_ADDON_AW_API_stream_push(&stream, &access_point);
+#endif
+    }
+#ifdef SIGFOX_EP_ERROR_CODES
+    output_data->status = SIGFOX_EP_ADDON_AW_API_stream_build_ul_payload(&stream, (output_data->ul_payload), &(output_data->nb_mac_ul_payload));
+#else
+    SIGFOX_EP_ADDON_AW_API_stream_build_ul_payload(&stream, (output_data->ul_payload), &(output_data->nb_mac_ul_payload));
+#endif
+}
+
+/*******************************************************************/
+static void _compare(const char *check, sfx_u32 scan_idx, sfx_u32 configuration_idx, SIGFOX_EP_ADDON_AW_API_output_data_t *expected, SIGFOX_EP_ADDON_AW_API_output_data_t *result) {
+    sigfox_ep_addon_aw_test_stream_nb_cases++;
+#ifdef SIGFOX_EP_ERROR_CODES
+    if ((result->status) != (expected->status)) {
+        sigfox_ep_addon_aw_test_stream_nb_errors++;
+        if (sigfox_ep_addon_aw_test_stream_nb_errors <= SIGFOX_EP_ADDON_AW_TEST_STREAM_NB_ERRORS_MAX) {
+            printf("ERROR: %s status mismatch on scan %lu configuration %lu (%d/%d)\n", check, (unsigned long) scan_idx, (unsigned long) configuration_idx, (int) expected->status, (int) result->status);
+        }
+        return;
+    }
+#endif
+    if (((result->nb_mac_ul_payload) != (expected->nb_mac_ul_payload)) || (memcmp((result->ul_payload), (expected->ul_payload), SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES) != 0)) {
+        sigfox_ep_addon_aw_test_stream_nb_errors++;
+        if (sigfox_ep_addon_aw_test_stream_nb_errors <= SIGFOX_EP_ADDON_AW_TEST_STREAM_NB_ERRORS_MAX) {
+            printf("ERROR: %s payload mismatch on scan %lu configuration %lu\n", check, (unsigned long) scan_idx, (unsigned long) configuration_idx);
+        }
+    }
+}
+
+/*******************************************************************/
+static void _test_scan(sfx_u32 scan_idx) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_output_data_t expected;
+    SIGFOX_EP_ADDON_AW_API_output_data_t result;
+    sfx_u32 configuration_idx = 0;
+    sfx_u32 split_idx = 0;
+    for (configuration_idx = 0; configuration_idx < (sizeof(SIGFOX_EP_ADDON_AW_TEST_STREAM_CONFIGURATIONS) / sizeof(SIGFOX_EP_ADDON_AW_TEST_STREAM_configuration_t)); configuration_idx++) {
+        _build_list_payload(&(SIGFOX_EP_ADDON_AW_TEST_STREAM_CONFIGURATIONS[configuration_idx]), &expected);
+        // Whole output in a single chunk, single characters, then random chunks up to a few lines.
+        _build_stream_payload(&(SIGFOX_EP_ADDON_AW_TEST_STREAM_CONFIGURATIONS[configuration_idx]), SIGFOX_EP_ADDON_AW_TEST_STREAM_OUTPUT_SIZE_MAX, &result);
+        _compare("parser (single chunk)", scan_idx, configuration_idx, &expected, &result);
+        for (split_idx = 0; split_idx < SIGFOX_EP_ADDON_AW_TEST_STREAM_NB_SPLITS; split_idx++) {
+            _build_stream_payload(&(SIGFOX_EP_ADDON_AW_TEST_STREAM_CONFIGURATIONS[configuration_idx]), (1 + (split_idx * split_idx * 8)), &result);
+            _compare("parser (random chunks)", scan_idx, configuration_idx, &expected, &result);
+        }
+        // Same records given one by one.
+        _build_push_payload(&(SIGFOX_EP_ADDON_AW_TEST_STREAM_CONFIGURATIONS[configuration_idx]), &result);
+        _compare("push", scan_idx, configuration_idx, &expected, &result);
+    }
+}
+
+/*** SIGFOX EP ADDON AW TEST STREAM functions ***/
+
+/*******************************************************************/
+int main(void) {
+    // Local variables.
+    sfx_u32 scan_idx = 0;
+    printf("sigfox-ep-addon-aw %s stream functions test\n", SIGFOX_EP_ADDON_AW_VERSION);
+    SIGFOX_EP_ADDON_AW_TEST_COMMON_set_seed(SIGFOX_EP_ADDON_AW_TEST_STREAM_SEED);
+    // Captured output first, then random scans.
+    _generate_capture(&sigfox_ep_addon_aw_test_stream_scan);
+    _test_scan(0);
+    for (scan_idx = 1; scan_idx <= SIGFOX_EP_ADDON_AW_TEST_STREAM_NB_SCANS; scan_idx++) {
+        _generate_scan(&sigfox_ep_addon_aw_test_stream_scan);
+        _test_scan(scan_idx);
+    }
+    printf("%lu cases, %lu error(s)\n", (unsigned long) sigfox_ep_addon_aw_test_stream_nb_cases, (unsigned long) sigfox_ep_addon_aw_test_stream_nb_errors);
+    if (sigfox_ep_addon_aw_test_stream_nb_errors != 0) {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("PASSED\n");
+    return 0;
+}
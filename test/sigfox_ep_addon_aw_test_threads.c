@@ -0,0 +1,275 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_aw_test_threads.c
+ * \brief   Sigfox End-Point Atlas WiFi addon contexts used by concurrent threads.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2025, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L
+#endif
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sigfox_ep_addon_aw_api.h"
+#include "sigfox_ep_addon_aw_test_common.h"
+#include "sigfox_ep_addon_aw_version.h"
+
+/*** SIGFOX EP ADDON AW TEST THREADS local macros ***/
+
+#define SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_LISTS        512
+#define SIGFOX_EP_ADDON_AW_TEST_THREADS_LIST_SIZE_MAX   64
+#define SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_THREADS_MAX  8
+#define SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_ROUNDS       20
+#define SIGFOX_EP_ADDON_AW_TEST_THREADS_SEED            0x3A7C19E5
+#define SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_ACCESS_POINTS    (SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_LISTS * SIGFOX_EP_ADDON_AW_TEST_THREADS_LIST_SIZE_MAX)
+
+/*** SIGFOX EP ADDON AW TEST THREADS local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    sfx_u8 filters;
+    SIGFOX_EP_ADDON_AW_API_sorting_t sorting;
+    sfx_s16 rssi_min_dbm;
+} SIGFOX_EP_ADDON_AW_TEST_THREADS_configuration_t;
+
+/*******************************************************************/
+typedef struct {
+    pthread_t thread;
+    const SIGFOX_EP_ADDON_AW_TEST_THREADS_configuration_t *configuration;
+    SIGFOX_EP_ADDON_AW_API_context_t context;
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_points;
+    SIGFOX_EP_ADDON_AW_API_access_point_t **access_point_list;
+    SIGFOX_EP_ADDON_AW_API_output_data_t *results;
+    sfx_u32 nb_rounds;
+} SIGFOX_EP_ADDON_AW_TEST_THREADS_worker_t;
+
+/*** SIGFOX EP ADDON AW TEST THREADS local global variables ***/
+
+static const SIGFOX_EP_ADDON_AW_TEST_THREADS_configuration_t SIGFOX_EP_ADDON_AW_TEST_THREADS_CONFIGURATIONS[] = {
+    { 0x00, SIGFOX_EP_ADDON_AW_API_SORTING_NONE, -90 },
+    { 0x1F, SIGFOX_EP_ADDON_AW_API_SORTING_RSSI, -75 },
+    { 0x01, SIGFOX_EP_ADDON_AW_API_SORTING_RSSI, -90 },
+    { 0x06, SIGFOX_EP_ADDON_AW_API_SORTING_SCANS, -90 },
+    { 0x0B, SIGFOX_EP_ADDON_AW_API_SORTING_DEVICES, -80 },
+    { 0x03, SIGFOX_EP_ADDON_AW_API_SORTING_NONE, -70 },
+    { 0x08, SIGFOX_EP_ADDON_AW_API_SORTING_RSSI, -60 },
+    { 0x17, SIGFOX_EP_ADDON_AW_API_SORTING_DEVICES, -90 },
+};
+
+static const char *SIGFOX_EP_ADDON_AW_TEST_THREADS_SSIDS[] = {
+    "", "Livebox-4F2A", "eduroam", "iPhone de Marie", "AndroidAP_4521", "NETGEAR47",
+};
+
+static SIGFOX_EP_ADDON_AW_API_access_point_t sigfox_ep_addon_aw_test_threads_access_points[SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_ACCESS_POINTS];
+static SIGFOX_EP_ADDON_AW_API_index_t sigfox_ep_addon_aw_test_threads_list_size[SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_LISTS];
+
+/*** SIGFOX EP ADDON AW TEST THREADS local functions ***/
+
+/*******************************************************************/
+static void _generate_lists(void) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_point = SIGFOX_NULL;
+    const char *ssid = SIGFOX_NULL;
+    sfx_u8 mac_address[SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES];
+    sfx_u32 list_idx = 0;
+    sfx_u32 idx = 0;
+    sfx_u8 byte_idx = 0;
+    for (list_idx = 0; list_idx < SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_LISTS; list_idx++) {
+        sigfox_ep_addon_aw_test_threads_list_size[list_idx] = (SIGFOX_EP_ADDON_AW_API_index_t) (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % (SIGFOX_EP_ADDON_AW_TEST_THREADS_LIST_SIZE_MAX + 1));
+        for (idx = 0; idx < sigfox_ep_addon_aw_test_threads_list_size[list_idx]; idx++) {
+            access_point = &(sigfox_ep_addon_aw_test_threads_access_points[(list_idx * SIGFOX_EP_ADDON_AW_TEST_THREADS_LIST_SIZE_MAX) + idx]);
+            // Duplicates, multicast and locally administered addresses are kept to go through all the filters.
+            if ((idx > 0) && ((SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 8) == 0)) {
+                mac_address[5] = (sfx_u8) (mac_address[5] + (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 2));
+            }
+            else {
+                for (byte_idx = 0; byte_idx < SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_BYTES; byte_idx++) {
+                    mac_address[byte_idx] = (sfx_u8) (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() & 0xFF);
+                }
+                mac_address[0] &= (((SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 4) == 0) ? 0xFF : 0xFC);
+            }
+            ssid = SIGFOX_EP_ADDON_AW_TEST_THREADS_SSIDS[SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % (sizeof(SIGFOX_EP_ADDON_AW_TEST_THREADS_SSIDS) / sizeof(char*))];
+            SIGFOX_EP_ADDON_AW_TEST_COMMON_init_access_point(access_point, mac_address, SIGFOX_TRUE, ssid, (sfx_s16) (-100 + (sfx_s32) (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 70)));
+            access_point->nb_scans = (sfx_u8) (1 + (SIGFOX_EP_ADDON_AW_TEST_COMMON_random() % 4));
+        }
+    }
+}
+
+/*******************************************************************/
+static void _configure(SIGFOX_EP_ADDON_AW_API_context_t *context, const SIGFOX_EP_ADDON_AW_TEST_THREADS_configuration_t *configuration) {
+    SIGFOX_EP_ADDON_AW_TEST_COMMON_configure(context, (configuration->filters), (configuration->sorting), (configuration->rssi_min_dbm), SIGFOX_NULL);
+}
+
+/*******************************************************************/
+static void _build_lists(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_access_point_t *access_points, SIGFOX_EP_ADDON_AW_API_access_point_t **access_point_list, SIGFOX_EP_ADDON_AW_API_output_data_t *results) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_input_data_t input_data;
+    SIGFOX_EP_ADDON_AW_API_output_data_t *result = SIGFOX_NULL;
+    sfx_u32 list_idx = 0;
+    for (list_idx = 0; list_idx < SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_LISTS; list_idx++) {
+        // The list is reset before each payload, as it would be after a new scan.
+        SIGFOX_EP_ADDON_AW_TEST_COMMON_init_list(&input_data, &(access_points[list_idx * SIGFOX_EP_ADDON_AW_TEST_THREADS_LIST_SIZE_MAX]), access_point_list, sigfox_ep_addon_aw_test_threads_list_size[list_idx]);
+        result = &(results[list_idx]);
+        memset(result, 0, sizeof(SIGFOX_EP_ADDON_AW_API_output_data_t));
+#ifdef SIGFOX_EP_ERROR_CODES
+        result->status = SIGFOX_EP_ADDON_AW_API_build_ul_payload_ctx(context, &input_data, (result->ul_payload), &(result->nb_mac_ul_payload));
+#else
+        SIGFOX_EP_ADDON_AW_API_build_ul_payload_ctx(context, &input_data, (result->ul_payload), &(result->nb_mac_ul_payload));
+#endif
+    }
+}
+
+/*******************************************************************/
+static void *_worker(void *argument) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_TEST_THREADS_worker_t *worker = (SIGFOX_EP_ADDON_AW_TEST_THREADS_worker_t *) argument;
+    sfx_u32 round = 0;
+    // Each thread configures its own context, so that the contexts are also configured concurrently.
+    _configure(&(worker->context), (worker->configuration));
+    for (round = 0; round < (worker->nb_rounds); round++) {
+        _build_lists(&(worker->context), (worker->access_points), (worker->access_point_list), (worker->results));
+    }
+    return SIGFOX_NULL;
+}
+
+/*******************************************************************/
+static double _get_time_s(void) {
+    // Local variables.
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((double) now.tv_sec) + (((double) now.tv_nsec) / 1e9);
+}
+
+/*******************************************************************/
+static sfx_u32 _compare_results(const SIGFOX_EP_ADDON_AW_API_output_data_t *results, const SIGFOX_EP_ADDON_AW_API_output_data_t *reference) {
+    // Local variables.
+    sfx_u32 nb_errors = 0;
+    sfx_u32 list_idx = 0;
+    for (list_idx = 0; list_idx < SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_LISTS; list_idx++) {
+        if ((results[list_idx].nb_mac_ul_payload != reference[list_idx].nb_mac_ul_payload) ||
+#ifdef SIGFOX_EP_ERROR_CODES
+            (results[list_idx].status != reference[list_idx].status) ||
+#endif
+            (memcmp(results[list_idx].ul_payload, reference[list_idx].ul_payload, SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES) != 0)) {
+            nb_errors++;
+        }
+    }
+    return nb_errors;
+}
+
+/*** SIGFOX EP ADDON AW TEST THREADS functions ***/
+
+/*******************************************************************/
+int main(void) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_TEST_THREADS_worker_t *workers = SIGFOX_NULL;
+    SIGFOX_EP_ADDON_AW_TEST_THREADS_worker_t *worker = SIGFOX_NULL;
+    SIGFOX_EP_ADDON_AW_API_output_data_t *reference = SIGFOX_NULL;
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_point_list[SIGFOX_EP_ADDON_AW_TEST_THREADS_LIST_SIZE_MAX];
+    SIGFOX_EP_ADDON_AW_API_context_t context;
+    const sfx_u32 nb_configurations = (sizeof(SIGFOX_EP_ADDON_AW_TEST_THREADS_CONFIGURATIONS) / sizeof(SIGFOX_EP_ADDON_AW_TEST_THREADS_configuration_t));
+    double start_s = 0.0;
+    double time_s = 0.0;
+    double payloads_per_s = 0.0;
+    sfx_u32 nb_threads = 0;
+    sfx_u32 nb_errors = 0;
+    sfx_u32 idx = 0;
+    int ret = 1;
+    printf("sigfox-ep-addon-aw %s contexts test (%u lists of up to %u access points)\n",
+        SIGFOX_EP_ADDON_AW_VERSION, (unsigned int) SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_LISTS, (unsigned int) SIGFOX_EP_ADDON_AW_TEST_THREADS_LIST_SIZE_MAX);
+    SIGFOX_EP_ADDON_AW_TEST_COMMON_set_seed(SIGFOX_EP_ADDON_AW_TEST_THREADS_SEED);
+    _generate_lists();
+    // Single-threaded reference of each configuration.
+    reference = calloc(nb_configurations * SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_LISTS, sizeof(SIGFOX_EP_ADDON_AW_API_output_data_t));
+    workers = calloc(SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_THREADS_MAX, sizeof(SIGFOX_EP_ADDON_AW_TEST_THREADS_worker_t));
+    if ((reference == SIGFOX_NULL) || (workers == SIGFOX_NULL)) goto errors;
+    for (idx = 0; idx < nb_configurations; idx++) {
+        _configure(&context, &(SIGFOX_EP_ADDON_AW_TEST_THREADS_CONFIGURATIONS[idx]));
+        _build_lists(&context, sigfox_ep_addon_aw_test_threads_access_points, access_point_list, &(reference[idx * SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_LISTS]));
+    }
+    // Each thread owns a context and a copy of the lists, since the addon writes the access points status.
+    for (idx = 0; idx < SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_THREADS_MAX; idx++) {
+        worker = &(workers[idx]);
+        worker->configuration = &(SIGFOX_EP_ADDON_AW_TEST_THREADS_CONFIGURATIONS[idx % nb_configurations]);
+        worker->access_points = malloc(sizeof(sigfox_ep_addon_aw_test_threads_access_points));
+        worker->access_point_list = calloc(SIGFOX_EP_ADDON_AW_TEST_THREADS_LIST_SIZE_MAX, sizeof(SIGFOX_EP_ADDON_AW_API_access_point_t *));
+        worker->results = calloc(SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_LISTS, sizeof(SIGFOX_EP_ADDON_AW_API_output_data_t));
+        if ((worker->access_points == SIGFOX_NULL) || (worker->access_point_list == SIGFOX_NULL) || (worker->results == SIGFOX_NULL)) goto errors;
+        memcpy(worker->access_points, sigfox_ep_addon_aw_test_threads_access_points, sizeof(sigfox_ep_addon_aw_test_threads_access_points));
+        worker->nb_rounds = SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_ROUNDS;
+    }
+    printf("threads,payloads_per_s,payloads_per_s_per_thread,mismatches\n");
+    for (nb_threads = 1; nb_threads <= SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_THREADS_MAX; nb_threads *= 2) {
+        start_s = _get_time_s();
+        for (idx = 0; idx < nb_threads; idx++) {
+            if (pthread_create(&(workers[idx].thread), SIGFOX_NULL, &_worker, &(workers[idx])) != 0) {
+                fprintf(stderr, "ERROR: cannot create thread\n");
+                nb_threads = idx;
+                break;
+            }
+        }
+        for (idx = 0; idx < nb_threads; idx++) {
+            pthread_join(workers[idx].thread, SIGFOX_NULL);
+        }
+        time_s = (_get_time_s() - start_s);
+        if (nb_threads == 0) goto errors;
+        // The last round of each thread must give the single-threaded results of its configuration.
+        nb_errors = 0;
+        for (idx = 0; idx < nb_threads; idx++) {
+            worker = &(workers[idx]);
+            nb_errors += _compare_results((worker->results), &(reference[(idx % nb_configurations) * SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_LISTS]));
+        }
+        payloads_per_s = (time_s > 0.0) ? (((double) nb_threads * SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_ROUNDS * SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_LISTS) / time_s) : 0.0;
+        printf("%u,%.0f,%.0f,%u\n", (unsigned int) nb_threads, payloads_per_s, (payloads_per_s / nb_threads), (unsigned int) nb_errors);
+        if (nb_errors != 0) goto errors;
+    }
+    printf("PASSED\n");
+    ret = 0;
+errors:
+    if (ret != 0) {
+        printf("FAILED\n");
+    }
+    if (workers != SIGFOX_NULL) {
+        for (idx = 0; idx < SIGFOX_EP_ADDON_AW_TEST_THREADS_NB_THREADS_MAX; idx++) {
+            free(workers[idx].access_points);
+            free(workers[idx].access_point_list);
+            free(workers[idx].results);
+        }
+        free(workers);
+    }
+    free(reference);
+    return ret;
+}
@@ -0,0 +1,253 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_aw_test_timing.c
+ * \brief   Sigfox End-Point Atlas WiFi addon timing hooks test.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2025, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sigfox_ep_addon_aw_api.h"
+#include "sigfox_ep_addon_aw_test_common.h"
+#include "sigfox_ep_addon_aw_version.h"
+
+/*** SIGFOX EP ADDON AW TEST TIMING local macros ***/
+
+#define SIGFOX_EP_ADDON_AW_TEST_TIMING_NB_ACCESS_POINTS 10
+#define SIGFOX_EP_ADDON_AW_TEST_TIMING_RSSI_MIN_DBM     (-80)
+// Timestamp just before the 32-bits wrapping, to check the unsigned differences.
+#define SIGFOX_EP_ADDON_AW_TEST_TIMING_WRAPPING_START   0xFFFFFFF0UL
+
+/*** SIGFOX EP ADDON AW TEST TIMING local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    const char *mac_address;
+    const char *ssid;
+    sfx_s16 rssi_dbm;
+} SIGFOX_EP_ADDON_AW_TEST_TIMING_access_point_t;
+
+/*** SIGFOX EP ADDON AW TEST TIMING local global variables ***/
+
+// Each access point stops at a known stage, so that the number of calls of each stage is known.
+static const SIGFOX_EP_ADDON_AW_TEST_TIMING_access_point_t SIGFOX_EP_ADDON_AW_TEST_TIMING_ACCESS_POINTS[SIGFOX_EP_ADDON_AW_TEST_TIMING_NB_ACCESS_POINTS] = {
+    { "00:00:00:00:00:00", "Office", -50 }, // Reserved.
+    { "01:23:45:67:89:ab", "Office", -50 }, // Multicast.
+    { "ac:84:c6:11:22:32", "Office", -85 }, // Minimum RSSI filter.
+    { "02:84:c6:11:22:33", "Office", -60 }, // Locally administered filter.
+    { "ac:84:c6:11:22:34", "", -60 }, // Empty SSID filter.
+    { "f4:f5:e8:11:22:35", "Office", -60 }, // OUI black list filter.
+    { "ac:84:c6:11:22:36", "My Phone", -60 }, // SSID black list filter.
+    { "ac:84:c6:11:22:37", "Office", -55 }, // Valid.
+    { "ac:84:c6:11:22:38", "Office", -65 }, // Valid.
+    { "AC:84:C6:11:22:37", "Office", -70 }, // Duplicate of the first valid access point.
+};
+
+static const sfx_u8 SIGFOX_EP_ADDON_AW_TEST_TIMING_UL_PAYLOAD[SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES] = {
+    0xAC, 0x84, 0xC6, 0x11, 0x22, 0x37, 0xAC, 0x84, 0xC6, 0x11, 0x22, 0x38,
+};
+
+static const sfx_u8 SIGFOX_EP_ADDON_AW_TEST_TIMING_OUI_TABLE[] = {
+    0xF4, 0xF5, 0xE8,
+};
+
+static const SIGFOX_EP_ADDON_AW_API_oui_table_t SIGFOX_EP_ADDON_AW_TEST_TIMING_OUI_BLACK_LIST = {
+    .oui_table = SIGFOX_EP_ADDON_AW_TEST_TIMING_OUI_TABLE,
+    .nb_ouis = 1,
+};
+
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+// Number of calls of each stage when building the first payload of the list with all the filters.
+static const sfx_u32 SIGFOX_EP_ADDON_AW_TEST_TIMING_FIRST_PAYLOAD_STAGES[SIGFOX_EP_ADDON_AW_API_STAGE_LAST] = {
+    10, // MAC address decoding: all access points.
+    10, // Mandatory filters: all access points.
+    7,  // Locally administered filter: after the minimum RSSI filter.
+    6,  // Empty SSID filter.
+    4,  // SSID black list filter: last filter.
+    8,  // Minimum RSSI filter: first filter, after the mandatory filters.
+    5,  // OUI black list filter.
+    1,  // Deduplication.
+    1,  // Sorting.
+    1,  // Encoding.
+};
+
+// Number of calls of each stage when building the next payload: no new access point is evaluated.
+static const sfx_u32 SIGFOX_EP_ADDON_AW_TEST_TIMING_NEXT_PAYLOAD_STAGES[SIGFOX_EP_ADDON_AW_API_STAGE_LAST] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+};
+
+static sfx_u32 sigfox_ep_addon_aw_test_timing_clock = 0;
+static sfx_u32 sigfox_ep_addon_aw_test_timing_step = 0;
+#endif
+
+static SIGFOX_EP_ADDON_AW_API_access_point_t sigfox_ep_addon_aw_test_timing_access_points[SIGFOX_EP_ADDON_AW_TEST_TIMING_NB_ACCESS_POINTS];
+static SIGFOX_EP_ADDON_AW_API_access_point_t *sigfox_ep_addon_aw_test_timing_access_point_list[SIGFOX_EP_ADDON_AW_TEST_TIMING_NB_ACCESS_POINTS];
+static sfx_u32 sigfox_ep_addon_aw_test_timing_nb_errors = 0;
+
+/*** SIGFOX EP ADDON AW TEST TIMING local functions ***/
+
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+/*******************************************************************/
+static sfx_u32 _fake_clock(void) {
+    // Deterministic counter: each call lasts exactly one step.
+    sigfox_ep_addon_aw_test_timing_clock += sigfox_ep_addon_aw_test_timing_step;
+    return sigfox_ep_addon_aw_test_timing_clock;
+}
+#endif
+
+/*******************************************************************/
+static void _reset_list(SIGFOX_EP_ADDON_AW_API_input_data_t *input_data) {
+    // Local variables.
+    const SIGFOX_EP_ADDON_AW_TEST_TIMING_access_point_t *reference = SIGFOX_NULL;
+    SIGFOX_EP_ADDON_AW_API_access_point_t *access_point = SIGFOX_NULL;
+    sfx_u8 ap_idx = 0;
+    for (ap_idx = 0; ap_idx < SIGFOX_EP_ADDON_AW_TEST_TIMING_NB_ACCESS_POINTS; ap_idx++) {
+        reference = &(SIGFOX_EP_ADDON_AW_TEST_TIMING_ACCESS_POINTS[ap_idx]);
+        access_point = &(sigfox_ep_addon_aw_test_timing_access_points[ap_idx]);
+        memset(access_point, 0, sizeof(SIGFOX_EP_ADDON_AW_API_access_point_t));
+        memcpy(access_point->mac_address, reference->mac_address, SIGFOX_EP_ADDON_AW_API_MAC_ADDRESS_SIZE_CHAR);
+        strncpy((char*) access_point->ssid, reference->ssid, (SIGFOX_EP_ADDON_AW_API_SSID_SIZE_CHAR - 1));
+        access_point->rssi_dbm = (reference->rssi_dbm);
+    }
+    SIGFOX_EP_ADDON_AW_TEST_COMMON_init_list(input_data, sigfox_ep_addon_aw_test_timing_access_points, sigfox_ep_addon_aw_test_timing_access_point_list, SIGFOX_EP_ADDON_AW_TEST_TIMING_NB_ACCESS_POINTS);
+}
+
+/*******************************************************************/
+static void _check(sfx_bool condition, const char *check) {
+    if (condition == SIGFOX_FALSE) {
+        printf("ERROR: %s\n", check);
+        sigfox_ep_addon_aw_test_timing_nb_errors++;
+    }
+}
+
+/*******************************************************************/
+static void _configure(SIGFOX_EP_ADDON_AW_API_context_t *context) {
+    SIGFOX_EP_ADDON_AW_TEST_COMMON_configure(context, ((1 << SIGFOX_EP_ADDON_AW_API_FILTER_LAST) - 1), SIGFOX_EP_ADDON_AW_API_SORTING_RSSI, SIGFOX_EP_ADDON_AW_TEST_TIMING_RSSI_MIN_DBM, &SIGFOX_EP_ADDON_AW_TEST_TIMING_OUI_BLACK_LIST);
+}
+
+/*******************************************************************/
+static void _build_first_payload(SIGFOX_EP_ADDON_AW_API_context_t *context, SIGFOX_EP_ADDON_AW_API_input_data_t *input_data) {
+    // Local variables.
+    sfx_u8 ul_payload[SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES];
+    sfx_u8 nb_mac_ul_payload = 0;
+#ifdef SIGFOX_EP_ERROR_CODES
+    SIGFOX_EP_ADDON_AW_API_status_t status = SIGFOX_EP_ADDON_AW_API_SUCCESS;
+    status = SIGFOX_EP_ADDON_AW_API_build_ul_payload_ctx(context, input_data, ul_payload, &nb_mac_ul_payload);
+    _check((status == SIGFOX_EP_ADDON_AW_API_SUCCESS), "first payload status");
+#else
+    SIGFOX_EP_ADDON_AW_API_build_ul_payload_ctx(context, input_data, ul_payload, &nb_mac_ul_payload);
+#endif
+    _check((nb_mac_ul_payload == SIGFOX_EP_ADDON_AW_API_NB_MAC_UL_PAYLOAD), "first payload MAC addresses count");
+    _check((memcmp(ul_payload, SIGFOX_EP_ADDON_AW_TEST_TIMING_UL_PAYLOAD, SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES) == 0), "first payload content");
+}
+
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+/*******************************************************************/
+static void _check_timing(SIGFOX_EP_ADDON_AW_API_context_t *context, const sfx_u32 *nb_calls, sfx_u32 step, const char *check) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_timing_t timing;
+    sfx_u8 stage = 0;
+    SIGFOX_EP_ADDON_AW_API_get_timing_ctx(context, &timing);
+    // Each stage boundary reads the clock once, so that each call of a stage lasts exactly one step.
+    for (stage = 0; stage < SIGFOX_EP_ADDON_AW_API_STAGE_LAST; stage++) {
+        if (timing.stage_total[stage] != (nb_calls[stage] * step)) {
+            printf("ERROR: %s stage %u total %lu (%lu expected)\n", check, stage, (unsigned long) timing.stage_total[stage], (unsigned long) (nb_calls[stage] * step));
+            sigfox_ep_addon_aw_test_timing_nb_errors++;
+        }
+    }
+}
+
+/*******************************************************************/
+static void _test_timing(sfx_u32 clock_start, sfx_u32 step) {
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_context_t context;
+    SIGFOX_EP_ADDON_AW_API_input_data_t input_data;
+    sfx_u8 ul_payload[SIGFOX_EP_ADDON_AW_API_UL_PAYLOAD_SIZE_BYTES];
+    sfx_u8 nb_mac_ul_payload = 0;
+    sfx_u32 no_calls[SIGFOX_EP_ADDON_AW_API_STAGE_LAST];
+    memset(no_calls, 0, sizeof(no_calls));
+    sigfox_ep_addon_aw_test_timing_clock = clock_start;
+    sigfox_ep_addon_aw_test_timing_step = step;
+    _configure(&context);
+    SIGFOX_EP_ADDON_AW_API_set_timestamp_callback_ctx(&context, &_fake_clock);
+    // First payload: all stages.
+    _reset_list(&input_data);
+    _build_first_payload(&context, &input_data);
+    _check_timing(&context, SIGFOX_EP_ADDON_AW_TEST_TIMING_FIRST_PAYLOAD_STAGES, step, "first payload");
+    // The getter resets the totals.
+    _check_timing(&context, no_calls, step, "reset by getter");
+    // Next payload of the same list: only sorting and encoding (no valid access point remains).
+    SIGFOX_EP_ADDON_AW_API_build_ul_payload_ctx(&context, &input_data, ul_payload, &nb_mac_ul_payload);
+    _check((nb_mac_ul_payload == 0), "next payload MAC addresses count");
+    _check_timing(&context, SIGFOX_EP_ADDON_AW_TEST_TIMING_NEXT_PAYLOAD_STAGES, step, "next payload");
+    // Several payloads accumulate until the getter is called.
+    _reset_list(&input_data);
+    _build_first_payload(&context, &input_data);
+    _reset_list(&input_data);
+    _build_first_payload(&context, &input_data);
+    _check_timing(&context, SIGFOX_EP_ADDON_AW_TEST_TIMING_FIRST_PAYLOAD_STAGES, (2 * step), "accumulated payloads");
+    // No measurement without callback.
+    SIGFOX_EP_ADDON_AW_API_set_timestamp_callback_ctx(&context, SIGFOX_NULL);
+    _reset_list(&input_data);
+    _build_first_payload(&context, &input_data);
+    _check_timing(&context, no_calls, step, "no callback");
+}
+#endif
+
+/*** SIGFOX EP ADDON AW TEST TIMING functions ***/
+
+/*******************************************************************/
+int main(void) {
+#ifndef SIGFOX_EP_ADDON_AW_TIMING
+    // Local variables.
+    SIGFOX_EP_ADDON_AW_API_context_t context;
+    SIGFOX_EP_ADDON_AW_API_input_data_t input_data;
+#endif
+    printf("sigfox-ep-addon-aw %s timing hooks test\n", SIGFOX_EP_ADDON_AW_VERSION);
+#ifdef SIGFOX_EP_ADDON_AW_TIMING
+    _test_timing(0, 1);
+    _test_timing(SIGFOX_EP_ADDON_AW_TEST_TIMING_WRAPPING_START, 7);
+#else
+    // Without the flag, the hooks are removed and the payload is unchanged.
+    printf("timing hooks disabled\n");
+    _configure(&context);
+    _reset_list(&input_data);
+    _build_first_payload(&context, &input_data);
+#endif
+    if (sigfox_ep_addon_aw_test_timing_nb_errors != 0) {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("PASSED\n");
+    return 0;
+}
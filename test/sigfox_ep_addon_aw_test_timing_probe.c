@@ -0,0 +1,48 @@
+/*!*****************************************************************
+ * \file    sigfox_ep_addon_aw_test_timing_probe.c
+ * \brief   Sigfox End-Point Atlas WiFi addon timing fields compilation probe.
+ *******************************************************************
+ * \copyright
+ *
+ * Copyright (c) 2025, UnaBiz SAS
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1 Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  2 Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *  3 Neither the name of UnaBiz SAS nor the names of its contributors may be
+ *    used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *******************************************************************/
+
+#include "sigfox_ep_addon_aw_api.h"
+
+// This file only compiles when the timing types and context fields exist, it is expected to fail without the SIGFOX_EP_ADDON_AW_TIMING flag.
+#ifdef SIGFOX_EP_ADDON_AW_TEST_TIMING_PROBE_TYPES
+SIGFOX_EP_ADDON_AW_API_timing_t sigfox_ep_addon_aw_test_timing_probe_timing;
+SIGFOX_EP_ADDON_AW_API_stage_t sigfox_ep_addon_aw_test_timing_probe_stage;
+#endif
+#ifdef SIGFOX_EP_ADDON_AW_TEST_TIMING_PROBE_FIELDS
+SIGFOX_EP_ADDON_AW_API_context_t sigfox_ep_addon_aw_test_timing_probe_context;
+const void *sigfox_ep_addon_aw_test_timing_probe_timestamp_cb = &(sigfox_ep_addon_aw_test_timing_probe_context.timestamp_cb);
+const void *sigfox_ep_addon_aw_test_timing_probe_totals = &(sigfox_ep_addon_aw_test_timing_probe_context.timing);
+#endif